@@ -19,6 +19,7 @@ HEADERS += \
     include/buffer.h \
     include/complex.h \
     include/examples.h \
+    include/fft.h \
     include/fir.h \
     include/iir.h \
     include/logical.h \
@@ -27,6 +28,7 @@ HEADERS += \
     include/recursive_mean.h \
     include/recursive_rms.h \
     include/sgen.h \
+    include/simd.h \
     include/special_functions.h \
     include/transfer_functions.h \
     include/transformations.h
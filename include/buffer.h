@@ -14,7 +14,23 @@
 // identify if the compilation is for ProsoftSystems IDE
 #ifndef __ALG_PLATFORM
 #include "malloc.h"
+#include "string.h"
 #include <iostream>
+#include <utility>
+#include <type_traits>
+#include <stddef.h>
+#endif
+
+// virtual memory mapping headers for the double-mapped ring buffers:
+#if !defined( __ALG_PLATFORM ) && defined( __linux__ )
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// atomics for the inter-thread buffers:
+#ifndef __ALG_PLATFORM
+#include <atomic>
 #endif
 
 /*! \defgroup <BUFFERS> ( Buffers )
@@ -62,11 +78,104 @@
 #define __fx64 double
 #endif
 
+/*!
+  \brief ring buffers capacity policies enumeration:
+  \param[ exact_capacity  ] the buffer capacity is equal to the requested size , the filling position is wrapped by comparison
+  \param[ pow2_capacity   ] the buffer capacity is rounded up to a power of two , the filling position is wrapped by a mask
+  \param[ mapped_capacity ] the buffer capacity is rounded up to the memory page size , both buffer halves are
+                             mapped onto the same physical pages ( Linux only )
+*/
+enum buff_capacity { exact_capacity , pow2_capacity , mapped_capacity };
+
+/*! \brief defines the capacity policy of the FIR filters and quadrature demodulators delay lines */
+#ifndef __DELAY_LINE_CAPACITY
+#define __DELAY_LINE_CAPACITY exact_capacity
+#endif
+
 /*! \brief mirror ring buffer template class */
-template< typename T > class mirror_ring_buffer;
+template< typename T , buff_capacity C = exact_capacity > class mirror_ring_buffer;
 
 /*! \brief classic ring buffer template class */
-template< typename T > class ring_buffer;
+template< typename T , buff_capacity C = exact_capacity > class ring_buffer;
+
+/*! \brief single producer / single consumer lock-free ring buffer template class */
+template< typename T > class spsc_ring_buffer;
+
+/*! \brief multichannel mirror ring buffer template class ( C = 0 - the channels number is set at the memory allocation ) */
+template< typename T , __ix32 C = 0 > class multichannel_ring_buffer;
+
+/*! \brief fractional delay reader template structure */
+template< typename T , __ix32 P = 3 > struct frac_delay;
+
+/*!
+  \brief buffer contiguous view template data structure
+  \param[data] pointer to the oldest sample of the view
+  \param[size] number of samples within the view
+*/
+template< typename T > struct buff_view { T *data; __ix32 size; };
+
+/*!
+ *  \brief  mirror ring buffer block filling function
+ *  \param[data  ] pointer to the buffer memory ( two halves of nelem samples )
+ *  \param[nelem ] buffer half size
+ *  \param[pos   ] buffer filling position
+ *  \param[input ] pointer to the input data block
+ *  \param[n     ] input data block size
+ *  \param[mirror] the upper half filling flag ( the mapped buffers mirror the lower half by themselves )
+ *  \return The function returns the new filling position. Every half is filled by means of not more than two
+ *          contiguous copies , only the last nelem samples of the block remain within the buffer.
+*/
+template< typename T > inline __ix32 __mirror_fill__( T *data , __ix32 nelem , __ix32 pos , const T *input , __ix32 n , __ix32 mirror = 1 )
+{
+    if( n > nelem )
+    {
+        pos    = ( pos + n - nelem ) % nelem;
+        input += n - nelem;
+        n      = nelem;
+    }
+
+    // copying up to the end of the half and from the beginning of the half:
+    __ix32 n1 = ( n < nelem - pos ) ? n : ( nelem - pos );
+    __ix32 n2 = n - n1;
+    memcpy( &data[ pos ] , input      , n1 * sizeof ( T ) );
+    memcpy( &data[ 0   ] , input + n1 , n2 * sizeof ( T ) );
+    if( mirror )
+    {
+        memcpy( &data[ pos + nelem ] , input      , n1 * sizeof ( T ) );
+        memcpy( &data[ nelem       ] , input + n1 , n2 * sizeof ( T ) );
+    }
+
+    pos = ( n2 > 0 ) ? n2 : ( pos + n1 );
+    return ( pos >= nelem ) ? 0 : pos;
+}
+
+/*!
+ *  \brief  mirror ring buffer contiguous history view function
+ *  \param[data ] pointer to the buffer memory ( two halves of nelem samples )
+ *  \param[nelem] buffer half size
+ *  \param[pos  ] buffer filling position
+ *  \param[n    ] the number of the most recent samples
+ *  \return The function returns the contiguous view of the last n samples ( n is limited by the buffer size ) ,
+ *          that ends just before the filling position within the upper half
+*/
+template< typename T > inline buff_view< T > __mirror_view__( T *data , __ix32 nelem , __ix32 pos , __ix32 n )
+{
+    if( n > nelem ) n = nelem;
+    return buff_view< T >{ &data[ pos + nelem - n ] , n };
+}
+
+/*!
+ *  \brief  buffer multi-tap gathering function
+ *  \param[buff] the buffer to read
+ *  \param[taps] pointer to the taps list ( sample numbers counted from the most recent sample )
+ *  \param[out ] pointer to the output samples array
+ *  \param[n   ] number of the taps
+ *  \details the function reads all the taps in one call: out[ i ] = buff[ taps[ i ] ]
+*/
+template< typename B , typename T > inline void __buff_gather__( B &buff , const __ix32 *taps , T *out , __ix32 n )
+{
+    for( __ix32 i = 0 ; i < n ; i++ ) out[i] = buff[ taps[i] ];
+}
 
 /*! \brief 32-bit floating point mirror ring buffer */
 template<> class mirror_ring_buffer< __fx32 >
@@ -83,6 +192,8 @@ public:
     __ix32  m_nelem;
      /*! \brief mirror ring buffer position */
     __ix32  m_buffpos;
+     /*! \brief mirror ring buffer memory ownership flag */
+    __ix32  m_owner;
 
     /*! \brief mirror ring buffer memory allocation function
      *  \param[nelem] the mirror ring buffer size
@@ -93,6 +204,7 @@ public:
         {
             m_nelem = nelem;
             m_data = ( __type* ) calloc( ( 2 * m_nelem ) , sizeof ( __type ) );
+            m_owner = 1;
             if( m_data )
             {
                m_lower = &m_data[0];
@@ -109,9 +221,31 @@ public:
     {
         if( m_data != 0 )
         {
-            free( m_data );
-            m_data = 0;
+            if( m_owner ) free( m_data );
+            m_data  = 0;
+            m_owner = 0;
+        }
+    }
+
+    /*! \brief mirror ring buffer external memory attaching function
+     *  \param[memory] pointer to the external memory block of 2 * nelem samples
+     *  \param[nelem ] the mirror ring buffer size
+     *  \details the buffer does not own the attached memory , so deallocate() function only
+     *           detaches the buffer from it. The memory block is expected to be zeroed.
+    */
+    __ix32 attach( __type *memory , __ix32 nelem )
+    {
+        if( ( nelem > 0 ) && !m_data && memory )
+        {
+            m_nelem   = nelem;
+            m_data    = memory;
+            m_lower   = &m_data[0];
+            m_upper   = &m_data[m_nelem];
+            m_buffpos = 0;
+            m_owner   = 0;
+            return 1;
         }
+        else return 0;
     }
 
     /*! \brief mirror ring buffer default constructor */
@@ -122,11 +256,25 @@ public:
         m_data    = 0;
         m_nelem   = 0;
         m_buffpos = 0;
+        m_owner   = 0;
     }
 
     /*! \brief mirror ring buffer destructor */
     ~mirror_ring_buffer() { deallocate(); }
 
+    /*! \brief mirror ring buffer swapping function
+     *  \param[buff] the buffer to exchange the memory and the filling state with
+    */
+    inline void swap( mirror_ring_buffer &buff )
+    {
+        std::swap( m_upper   , buff.m_upper );
+        std::swap( m_lower   , buff.m_lower );
+        std::swap( m_data    , buff.m_data );
+        std::swap( m_nelem   , buff.m_nelem );
+        std::swap( m_buffpos , buff.m_buffpos );
+        std::swap( m_owner   , buff.m_owner );
+    }
+
     /*! \brief mirror ring buffer template filling function
      * \param[input] pointer to the input data
     */
@@ -147,6 +295,37 @@ public:
         }
     }
 
+    /*! \brief mirror ring buffer block filling function
+     * \param[input] pointer to the input data block
+     * \param[n    ] input data block size
+     * \details the function puts the whole block into both halves of the buffer. Every half
+     *          is filled by means of not more than two contiguous copies
+    */
+    inline void fill_block( const __type *input , __ix32 n )
+    {
+        m_buffpos = __mirror_fill__( m_data , m_nelem , m_buffpos , input , n );
+        m_lower   = &m_data[ m_buffpos ];
+        m_upper   = &m_data[ m_buffpos + m_nelem ];
+    }
+
+    /*! \brief mirror ring buffer template block filling function
+     * \param[input] pointer to the input data block
+     * \param[n    ] input data block size
+     * \details the function is used if the input data type differs from the buffer data type
+    */
+    template< typename T > inline void fill_block( const T *input , __ix32 n )
+    {
+        for( __ix32 i = 0 ; i < n ; i++ ) fill_buff( &input[i] );
+    }
+
+    /*!
+     *  \brief  mirror ring buffer contiguous history view function
+     *  \param[n] the number of the most recent samples
+     *  \return The function returns the contiguous view of the last n samples ( n is limited by the buffer size ).
+     *          The view is ordered from the oldest sample to the most recent one: view.data[ view.size - 1 ] = ( *this )[ 0 ]
+    */
+    inline buff_view< __type > view( __ix32 n ) { return __mirror_view__( m_data , m_nelem , m_buffpos , n ); }
+
     /*!
      *  \brief  mirror ring buffer position function
      *  \return The function returns the buffer filling pointer position
@@ -166,6 +345,24 @@ public:
     */
     inline __type operator [] ( __ix32 n ) { return *( m_upper - n - 1 ); }
 
+    /*! \brief mirror ring buffer gathering function
+     * \param[taps] pointer to the taps list ( sample numbers counted from the most recent sample )
+     * \param[out ] pointer to the output samples array
+     * \param[n   ] number of the taps
+     * \details the function reads all the taps in one call: out[ i ] = ( *this )[ taps[ i ] ]
+    */
+    inline void gather( const __ix32 *taps , __type *out , __ix32 n ) { __buff_gather__( *this , taps , out , n ); }
+
+    /*! \brief mirror ring buffer compile-time taps gathering function
+     * \param[out] pointer to the output samples array
+     * \details the function reads the taps defined by the template parameters list: out[ i ] = ( *this )[ Taps[ i ] ]
+    */
+    template< __ix32... Taps > inline void gather( __type *out )
+    {
+        const __ix32 taps[] = { Taps... };
+        __buff_gather__( *this , taps , out , sizeof...( Taps ) );
+    }
+
     /*! \brief mirror ring buffer () operator
      * \param[input] pointer to the input data
      * \return the operator call puts the data into the buffer by
@@ -196,6 +393,8 @@ public:
     __ix32  m_nelem;
      /*! \brief mirror ring buffer position */
     __ix32  m_buffpos;
+     /*! \brief mirror ring buffer memory ownership flag */
+    __ix32  m_owner;
 
     /*! \brief mirror ring buffer memory allocation function
      *  \param[nelem] the mirror ring buffer size
@@ -206,6 +405,7 @@ public:
         {
             m_nelem = nelem;
             m_data = ( __type* ) calloc( ( 2 * m_nelem ) , sizeof ( __type ) );
+            m_owner = 1;
             if( m_data )
             {
                m_lower = &m_data[0];
@@ -222,9 +422,31 @@ public:
     {
         if( m_data != 0 )
         {
-            free( m_data );
-            m_data = 0;
+            if( m_owner ) free( m_data );
+            m_data  = 0;
+            m_owner = 0;
+        }
+    }
+
+    /*! \brief mirror ring buffer external memory attaching function
+     *  \param[memory] pointer to the external memory block of 2 * nelem samples
+     *  \param[nelem ] the mirror ring buffer size
+     *  \details the buffer does not own the attached memory , so deallocate() function only
+     *           detaches the buffer from it. The memory block is expected to be zeroed.
+    */
+    __ix32 attach( __type *memory , __ix32 nelem )
+    {
+        if( ( nelem > 0 ) && !m_data && memory )
+        {
+            m_nelem   = nelem;
+            m_data    = memory;
+            m_lower   = &m_data[0];
+            m_upper   = &m_data[m_nelem];
+            m_buffpos = 0;
+            m_owner   = 0;
+            return 1;
         }
+        else return 0;
     }
 
     /*! \brief mirror ring buffer default constructor */
@@ -235,11 +457,25 @@ public:
         m_data    = 0;
         m_nelem   = 0;
         m_buffpos = 0;
+        m_owner   = 0;
     }
 
     /*! \brief mirror ring buffer destructor */
     ~mirror_ring_buffer() { deallocate(); }
 
+    /*! \brief mirror ring buffer swapping function
+     *  \param[buff] the buffer to exchange the memory and the filling state with
+    */
+    inline void swap( mirror_ring_buffer &buff )
+    {
+        std::swap( m_upper   , buff.m_upper );
+        std::swap( m_lower   , buff.m_lower );
+        std::swap( m_data    , buff.m_data );
+        std::swap( m_nelem   , buff.m_nelem );
+        std::swap( m_buffpos , buff.m_buffpos );
+        std::swap( m_owner   , buff.m_owner );
+    }
+
     // biffer filling function:
 
     /*! \brief mirror ring buffer template filling function
@@ -262,6 +498,37 @@ public:
         }
     }
 
+    /*! \brief mirror ring buffer block filling function
+     * \param[input] pointer to the input data block
+     * \param[n    ] input data block size
+     * \details the function puts the whole block into both halves of the buffer. Every half
+     *          is filled by means of not more than two contiguous copies
+    */
+    inline void fill_block( const __type *input , __ix32 n )
+    {
+        m_buffpos = __mirror_fill__( m_data , m_nelem , m_buffpos , input , n );
+        m_lower   = &m_data[ m_buffpos ];
+        m_upper   = &m_data[ m_buffpos + m_nelem ];
+    }
+
+    /*! \brief mirror ring buffer template block filling function
+     * \param[input] pointer to the input data block
+     * \param[n    ] input data block size
+     * \details the function is used if the input data type differs from the buffer data type
+    */
+    template< typename T > inline void fill_block( const T *input , __ix32 n )
+    {
+        for( __ix32 i = 0 ; i < n ; i++ ) fill_buff( &input[i] );
+    }
+
+    /*!
+     *  \brief  mirror ring buffer contiguous history view function
+     *  \param[n] the number of the most recent samples
+     *  \return The function returns the contiguous view of the last n samples ( n is limited by the buffer size ).
+     *          The view is ordered from the oldest sample to the most recent one: view.data[ view.size - 1 ] = ( *this )[ 0 ]
+    */
+    inline buff_view< __type > view( __ix32 n ) { return __mirror_view__( m_data , m_nelem , m_buffpos , n ); }
+
     /*!
      *  \brief  mirror ring buffer position function
      *  \return The function returns the buffer filling pointer position
@@ -281,6 +548,24 @@ public:
     */
     inline __type operator [] ( __ix32 n ) { return *( m_upper - n - 1 ); }
 
+    /*! \brief mirror ring buffer gathering function
+     * \param[taps] pointer to the taps list ( sample numbers counted from the most recent sample )
+     * \param[out ] pointer to the output samples array
+     * \param[n   ] number of the taps
+     * \details the function reads all the taps in one call: out[ i ] = ( *this )[ taps[ i ] ]
+    */
+    inline void gather( const __ix32 *taps , __type *out , __ix32 n ) { __buff_gather__( *this , taps , out , n ); }
+
+    /*! \brief mirror ring buffer compile-time taps gathering function
+     * \param[out] pointer to the output samples array
+     * \details the function reads the taps defined by the template parameters list: out[ i ] = ( *this )[ Taps[ i ] ]
+    */
+    template< __ix32... Taps > inline void gather( __type *out )
+    {
+        const __ix32 taps[] = { Taps... };
+        __buff_gather__( *this , taps , out , sizeof...( Taps ) );
+    }
+
     /*! \brief mirror ring buffer () operator
      * \param[input] pointer to the input data
      * \return the operator call puts the data into the buffer by
@@ -304,6 +589,8 @@ public:
     __ix32  m_nelem;
      /*! \brief mirror ring buffer position */
     __ix32  m_buffpos;
+     /*! \brief mirror ring buffer memory ownership flag */
+    __ix32  m_owner;
 
     /*! \brief mirror ring buffer memory allocation function
      *  \param[nelem] the mirror ring buffer size
@@ -314,6 +601,7 @@ public:
         {
             m_nelem = nelem;
             m_data = ( __type* ) calloc( ( 2 * m_nelem ) , sizeof ( __type ) );
+            m_owner = 1;
             if( m_data )
             {
                m_lower = &m_data[0];
@@ -330,9 +618,31 @@ public:
     {
         if( m_data != 0 )
         {
-            free( m_data );
-            m_data = 0;
+            if( m_owner ) free( m_data );
+            m_data  = 0;
+            m_owner = 0;
+        }
+    }
+
+    /*! \brief mirror ring buffer external memory attaching function
+     *  \param[memory] pointer to the external memory block of 2 * nelem samples
+     *  \param[nelem ] the mirror ring buffer size
+     *  \details the buffer does not own the attached memory , so deallocate() function only
+     *           detaches the buffer from it. The memory block is expected to be zeroed.
+    */
+    __ix32 attach( __type *memory , __ix32 nelem )
+    {
+        if( ( nelem > 0 ) && !m_data && memory )
+        {
+            m_nelem   = nelem;
+            m_data    = memory;
+            m_lower   = &m_data[0];
+            m_upper   = &m_data[m_nelem];
+            m_buffpos = 0;
+            m_owner   = 0;
+            return 1;
         }
+        else return 0;
     }
 
     /*! \brief mirror ring buffer default constructor */
@@ -343,11 +653,25 @@ public:
         m_data    = 0;
         m_nelem   = 0;
         m_buffpos = 0;
+        m_owner   = 0;
     }
 
     /*! \brief mirror ring buffer destructor */
     ~mirror_ring_buffer() { deallocate(); }
 
+    /*! \brief mirror ring buffer swapping function
+     *  \param[buff] the buffer to exchange the memory and the filling state with
+    */
+    inline void swap( mirror_ring_buffer &buff )
+    {
+        std::swap( m_upper   , buff.m_upper );
+        std::swap( m_lower   , buff.m_lower );
+        std::swap( m_data    , buff.m_data );
+        std::swap( m_nelem   , buff.m_nelem );
+        std::swap( m_buffpos , buff.m_buffpos );
+        std::swap( m_owner   , buff.m_owner );
+    }
+
     // biffer filling function:
 
     /*! \brief mirror ring buffer template filling function
@@ -370,6 +694,37 @@ public:
         }
     }
 
+    /*! \brief mirror ring buffer block filling function
+     * \param[input] pointer to the input data block
+     * \param[n    ] input data block size
+     * \details the function puts the whole block into both halves of the buffer. Every half
+     *          is filled by means of not more than two contiguous copies
+    */
+    inline void fill_block( const __type *input , __ix32 n )
+    {
+        m_buffpos = __mirror_fill__( m_data , m_nelem , m_buffpos , input , n );
+        m_lower   = &m_data[ m_buffpos ];
+        m_upper   = &m_data[ m_buffpos + m_nelem ];
+    }
+
+    /*! \brief mirror ring buffer template block filling function
+     * \param[input] pointer to the input data block
+     * \param[n    ] input data block size
+     * \details the function is used if the input data type differs from the buffer data type
+    */
+    template< typename T > inline void fill_block( const T *input , __ix32 n )
+    {
+        for( __ix32 i = 0 ; i < n ; i++ ) fill_buff( &input[i] );
+    }
+
+    /*!
+     *  \brief  mirror ring buffer contiguous history view function
+     *  \param[n] the number of the most recent samples
+     *  \return The function returns the contiguous view of the last n samples ( n is limited by the buffer size ).
+     *          The view is ordered from the oldest sample to the most recent one: view.data[ view.size - 1 ] = ( *this )[ 0 ]
+    */
+    inline buff_view< __type > view( __ix32 n ) { return __mirror_view__( m_data , m_nelem , m_buffpos , n ); }
+
     /*!
      *  \brief  mirror ring buffer position function
      *  \return The function returns the buffer filling pointer position
@@ -389,6 +744,24 @@ public:
     */
     inline __type operator [] ( __ix32 n ) { return *( m_upper - n - 1 ); }
 
+    /*! \brief mirror ring buffer gathering function
+     * \param[taps] pointer to the taps list ( sample numbers counted from the most recent sample )
+     * \param[out ] pointer to the output samples array
+     * \param[n   ] number of the taps
+     * \details the function reads all the taps in one call: out[ i ] = ( *this )[ taps[ i ] ]
+    */
+    inline void gather( const __ix32 *taps , __type *out , __ix32 n ) { __buff_gather__( *this , taps , out , n ); }
+
+    /*! \brief mirror ring buffer compile-time taps gathering function
+     * \param[out] pointer to the output samples array
+     * \details the function reads the taps defined by the template parameters list: out[ i ] = ( *this )[ Taps[ i ] ]
+    */
+    template< __ix32... Taps > inline void gather( __type *out )
+    {
+        const __ix32 taps[] = { Taps... };
+        __buff_gather__( *this , taps , out , sizeof...( Taps ) );
+    }
+
     /*! \brief mirror ring buffer () operator
      * \param[input] pointer to the input data
      * \return the operator call puts the data into the buffer by
@@ -419,6 +792,8 @@ public:
     __ix32  m_nelem;
      /*! \brief mirror ring buffer position */
     __ix32  m_buffpos;
+     /*! \brief mirror ring buffer memory ownership flag */
+    __ix32  m_owner;
 
     /*! \brief mirror ring buffer memory allocation function
      *  \param[nelem] the mirror ring buffer size
@@ -429,6 +804,7 @@ public:
         {
             m_nelem = nelem;
             m_data = ( __type* ) calloc( ( 2 * m_nelem ) , sizeof ( __type ) );
+            m_owner = 1;
             if( m_data )
             {
                m_lower = &m_data[0];
@@ -445,9 +821,31 @@ public:
     {
         if( m_data != 0 )
         {
-            free( m_data );
-            m_data = 0;
+            if( m_owner ) free( m_data );
+            m_data  = 0;
+            m_owner = 0;
+        }
+    }
+
+    /*! \brief mirror ring buffer external memory attaching function
+     *  \param[memory] pointer to the external memory block of 2 * nelem samples
+     *  \param[nelem ] the mirror ring buffer size
+     *  \details the buffer does not own the attached memory , so deallocate() function only
+     *           detaches the buffer from it. The memory block is expected to be zeroed.
+    */
+    __ix32 attach( __type *memory , __ix32 nelem )
+    {
+        if( ( nelem > 0 ) && !m_data && memory )
+        {
+            m_nelem   = nelem;
+            m_data    = memory;
+            m_lower   = &m_data[0];
+            m_upper   = &m_data[m_nelem];
+            m_buffpos = 0;
+            m_owner   = 0;
+            return 1;
         }
+        else return 0;
     }
 
     /*! \brief mirror ring buffer default constructor */
@@ -458,11 +856,25 @@ public:
         m_data    = 0;
         m_nelem   = 0;
         m_buffpos = 0;
+        m_owner   = 0;
     }
 
     /*! \brief mirror ring buffer destructor */
     ~mirror_ring_buffer() { deallocate(); }
 
+    /*! \brief mirror ring buffer swapping function
+     *  \param[buff] the buffer to exchange the memory and the filling state with
+    */
+    inline void swap( mirror_ring_buffer &buff )
+    {
+        std::swap( m_upper   , buff.m_upper );
+        std::swap( m_lower   , buff.m_lower );
+        std::swap( m_data    , buff.m_data );
+        std::swap( m_nelem   , buff.m_nelem );
+        std::swap( m_buffpos , buff.m_buffpos );
+        std::swap( m_owner   , buff.m_owner );
+    }
+
     // biffer filling function:
 
     /*! \brief mirror ring buffer template filling function
@@ -485,6 +897,37 @@ public:
         }
     }
 
+    /*! \brief mirror ring buffer block filling function
+     * \param[input] pointer to the input data block
+     * \param[n    ] input data block size
+     * \details the function puts the whole block into both halves of the buffer. Every half
+     *          is filled by means of not more than two contiguous copies
+    */
+    inline void fill_block( const __type *input , __ix32 n )
+    {
+        m_buffpos = __mirror_fill__( m_data , m_nelem , m_buffpos , input , n );
+        m_lower   = &m_data[ m_buffpos ];
+        m_upper   = &m_data[ m_buffpos + m_nelem ];
+    }
+
+    /*! \brief mirror ring buffer template block filling function
+     * \param[input] pointer to the input data block
+     * \param[n    ] input data block size
+     * \details the function is used if the input data type differs from the buffer data type
+    */
+    template< typename T > inline void fill_block( const T *input , __ix32 n )
+    {
+        for( __ix32 i = 0 ; i < n ; i++ ) fill_buff( &input[i] );
+    }
+
+    /*!
+     *  \brief  mirror ring buffer contiguous history view function
+     *  \param[n] the number of the most recent samples
+     *  \return The function returns the contiguous view of the last n samples ( n is limited by the buffer size ).
+     *          The view is ordered from the oldest sample to the most recent one: view.data[ view.size - 1 ] = ( *this )[ 0 ]
+    */
+    inline buff_view< __type > view( __ix32 n ) { return __mirror_view__( m_data , m_nelem , m_buffpos , n ); }
+
     /*!
      *  \brief  mirror ring buffer position function
      *  \return The function returns the buffer filling pointer position
@@ -504,6 +947,24 @@ public:
     */
     inline __type operator [] ( __ix32 n ) { return *( m_upper - n - 1 ); }
 
+    /*! \brief mirror ring buffer gathering function
+     * \param[taps] pointer to the taps list ( sample numbers counted from the most recent sample )
+     * \param[out ] pointer to the output samples array
+     * \param[n   ] number of the taps
+     * \details the function reads all the taps in one call: out[ i ] = ( *this )[ taps[ i ] ]
+    */
+    inline void gather( const __ix32 *taps , __type *out , __ix32 n ) { __buff_gather__( *this , taps , out , n ); }
+
+    /*! \brief mirror ring buffer compile-time taps gathering function
+     * \param[out] pointer to the output samples array
+     * \details the function reads the taps defined by the template parameters list: out[ i ] = ( *this )[ Taps[ i ] ]
+    */
+    template< __ix32... Taps > inline void gather( __type *out )
+    {
+        const __ix32 taps[] = { Taps... };
+        __buff_gather__( *this , taps , out , sizeof...( Taps ) );
+    }
+
     /*! \brief mirror ring buffer () operator
      * \param[input] pointer to the input data
      * \return the operator call puts the data into the buffer by
@@ -512,11 +973,19 @@ public:
     inline void operator () ( __type *input ){ fill_buff< __type >( input ); }
 };
 
-/*! \brief 32-bit floating point ring buffer */
-template<> class ring_buffer<__fx32>
+/*!
+ *  \brief 16-bit integer ( Q15 ) mirror ring buffer
+ *  \details The buffer keeps the history as 16-bit integers. Floating point input samples are scaled by
+ *           32768 / m_scale , rounded and saturated , so m_scale is the full scale of the stored signal.
+ *           The raw integers are available for integer kernels via [] operator and view() function ,
+ *           value() function converts them back on read. 16-bit integer input ( raw ADC data ) is stored as is.
+*/
+template<> class mirror_ring_buffer< __ix16 >
 {
-    typedef __fx32 __type;
+    typedef __ix16 __type;
 public:
+    /*! \brief mirror ring buffer upper half pointer */
+    __type *m_upper;
     /*! \brief mirror ring buffer lower half pointer */
     __type *m_lower;
     /*! \brief mirror ring buffer data pointer */
@@ -525,17 +994,28 @@ public:
     __ix32  m_nelem;
      /*! \brief mirror ring buffer position */
     __ix32  m_buffpos;
+     /*! \brief stored signal full scale */
+    __fx64  m_scale;
+     /*! \brief input samples scaling factor */
+    __fx64  m_kq;
 
     /*! \brief mirror ring buffer memory allocation function
      *  \param[nelem] the mirror ring buffer size
+     *  \param[scale] the stored signal full scale
     */
-    __ix32 allocate( __ix32 nelem )
+    __ix32 allocate( __ix32 nelem , __fx64 scale = 1.0 )
     {
         if( ( nelem > 0 ) && !m_data )
         {
+            setScale( scale );
             m_nelem = nelem;
-            m_data  = ( __type* ) calloc( ( m_nelem ) , sizeof ( __type ) );
-            m_lower = ( m_data ) ? &m_data[0] : 0;
+            m_data = ( __type* ) calloc( ( 2 * m_nelem ) , sizeof ( __type ) );
+            if( m_data )
+            {
+               m_lower = &m_data[0];
+               m_upper = &m_data[m_nelem];
+            }
+
             return ( m_data != 0 );
         }
         else return 0;
@@ -552,36 +1032,96 @@ public:
     }
 
     /*! \brief mirror ring buffer default constructor */
-    ring_buffer()
+    mirror_ring_buffer()
     {
+        m_upper   = 0;
         m_lower   = 0;
         m_data    = 0;
         m_nelem   = 0;
         m_buffpos = 0;
+        m_scale   = 1.0;
+        m_kq      = 32768.0;
     }
 
     /*! \brief mirror ring buffer destructor */
-    ~ring_buffer() { deallocate(); }
+    ~mirror_ring_buffer() { deallocate(); }
+
+    /*! \brief mirror ring buffer swapping function
+     *  \param[buff] the buffer to exchange the memory and the filling state with
+    */
+    inline void swap( mirror_ring_buffer &buff )
+    {
+        std::swap( m_upper   , buff.m_upper );
+        std::swap( m_lower   , buff.m_lower );
+        std::swap( m_data    , buff.m_data );
+        std::swap( m_nelem   , buff.m_nelem );
+        std::swap( m_buffpos , buff.m_buffpos );
+        std::swap( m_scale   , buff.m_scale );
+        std::swap( m_kq      , buff.m_kq );
+    }
+
+    /*! \brief stored signal full scale setting function
+     *  \param[scale] the stored signal full scale
+    */
+    inline void setScale( __fx64 scale ) { m_scale = scale; m_kq = 32768.0 / scale; }
+
+    /*! \brief Q15 conversion function
+     *  \param[x] input sample
+     *  \return The function returns the rounded and saturated Q15 representation of the input sample ( 0 for NaN )
+    */
+    inline __type quantize( __fx64 x )
+    {
+        x *= m_kq;
+        if( x != x ) return 0;
+        if( x >=  32767.0 ) return  32767;
+        if( x <= -32768.0 ) return -32768;
+        return ( __type )( ( x >= 0 ) ? ( x + 0.5 ) : ( x - 0.5 ) );
+    }
 
     // biffer filling function:
 
+    /*! \brief mirror ring buffer raw filling function
+     * \param[input] pointer to the input 16-bit integer data
+    */
+    inline void fill_buff( const __type *input ) { put( *input ); }
+
     /*! \brief mirror ring buffer template filling function
      * \param[input] pointer to the input data
+     * \details the input sample is converted into Q15 format
     */
-    template< typename T > inline void fill_buff( T *input )
+    template< typename T > inline void fill_buff( const T *input ) { put( quantize( *input ) ); }
+
+    /*! \brief mirror ring buffer raw block filling function
+     * \param[input] pointer to the input 16-bit integer data block
+     * \param[n    ] input data block size
+     * \details the function puts the whole block into both halves of the buffer. Every half
+     *          is filled by means of not more than two contiguous copies
+    */
+    inline void fill_block( const __type *input , __ix32 n )
     {
-        *m_lower = *input;
-        if( ++m_buffpos >= m_nelem )
-        {
-            m_lower   = &m_data[0];
-            m_buffpos = 0;
-        }
-        else
-        {
-            m_lower++;
-        }
+        m_buffpos = __mirror_fill__( m_data , m_nelem , m_buffpos , input , n );
+        m_lower   = &m_data[ m_buffpos ];
+        m_upper   = &m_data[ m_buffpos + m_nelem ];
+    }
+
+    /*! \brief mirror ring buffer template block filling function
+     * \param[input] pointer to the input data block
+     * \param[n    ] input data block size
+     * \details the input samples are converted into Q15 format
+    */
+    template< typename T > inline void fill_block( const T *input , __ix32 n )
+    {
+        for( __ix32 i = 0 ; i < n ; i++ ) fill_buff( &input[i] );
     }
 
+    /*!
+     *  \brief  mirror ring buffer contiguous history view function
+     *  \param[n] the number of the most recent samples
+     *  \return The function returns the contiguous view of the last n raw samples ( n is limited by the buffer size ).
+     *          The view is ordered from the oldest sample to the most recent one: view.data[ view.size - 1 ] = ( *this )[ 0 ]
+    */
+    inline buff_view< __type > view( __ix32 n ) { return __mirror_view__( m_data , m_nelem , m_buffpos , n ); }
+
     /*!
      *  \brief  mirror ring buffer position function
      *  \return The function returns the buffer filling pointer position
@@ -594,32 +1134,71 @@ public:
     */
     inline __ix32 getBuffSize(){ return m_nelem;   }
 
+    /*!
+     *  \brief  mirror ring buffer scaled sample reading function
+     *  \param[n] sample number
+     *  \return The function returns a sample that is on the left from the current
+     *          mirror ring buffer position converted back into the input signal scale
+    */
+    inline __fx64 value( __ix32 n ) { return *( m_upper - n - 1 ) * m_scale * ( 1.0 / 32768.0 ); }
+
     /*! \brief mirror ring buffer [] operator
      * \param[n] sample number
-     * \return the operator call returns a sample that is on the left from the current
+     * \return the operator call returns a raw Q15 sample that is on the left from the current
      *         mirror ring buffer position
     */
-    inline __type operator [] ( __ix32 n ) { return m_data[n]; }
+    inline __type operator [] ( __ix32 n ) { return *( m_upper - n - 1 ); }
 
-    /*! \brief mirror ring buffer () operator
-     * \param[input] pointer to the input data
-     * \return the operator call puts the data into the buffer by
-     *         means of calling fill_buff( __type *input ) function
+    /*! \brief mirror ring buffer gathering function
+     * \param[taps] pointer to the taps list ( sample numbers counted from the most recent sample )
+     * \param[out ] pointer to the output samples array
+     * \param[n   ] number of the taps
+     * \details the function reads all the taps in one call: out[ i ] = ( *this )[ taps[ i ] ]
     */
-    inline void operator () ( __type *input ){ fill_buff< __type >( input ); }
+    inline void gather( const __ix32 *taps , __type *out , __ix32 n ) { __buff_gather__( *this , taps , out , n ); }
+
+    /*! \brief mirror ring buffer compile-time taps gathering function
+     * \param[out] pointer to the output samples array
+     * \details the function reads the taps defined by the template parameters list: out[ i ] = ( *this )[ Taps[ i ] ]
+    */
+    template< __ix32... Taps > inline void gather( __type *out )
+    {
+        const __ix32 taps[] = { Taps... };
+        __buff_gather__( *this , taps , out , sizeof...( Taps ) );
+    }
 
     /*! \brief mirror ring buffer () operator
      * \param[input] pointer to the input data
      * \return the operator call puts the data into the buffer by
-     *         means of calling fill_buff( __type *input ) function
+     *         means of calling fill_buff( T *input ) function
     */
-    inline void operator () ( __fx64 *input ){ fill_buff< __fx64 >( input ); }
+    template< typename T > inline void operator () ( T *input ){ fill_buff( ( const T* )input ); }
+
+private:
+
+    /*! \brief mirror ring buffer sample storing function */
+    inline void put( __type x )
+    {
+        *m_lower = x;
+        *m_upper = x;
+        if( ++m_buffpos >= m_nelem )
+        {
+            m_lower = &m_data[0];
+            m_upper = &m_data[m_nelem];
+            m_buffpos = 0;
+        }
+        else
+        {
+            m_lower++;
+            m_upper++;
+        }
+    }
 };
 
-/*! \brief 64-bit floating point ring buffer */
-template<> class ring_buffer<__fx64>
+/*! \brief 32-bit floating point ring buffer */
+template<> class ring_buffer<__fx32>
 {
-    typedef __fx64 __type;
+    typedef __fx32 __type;
 public:
     /*! \brief mirror ring buffer lower half pointer */
     __type *m_lower;
@@ -705,8 +1284,126 @@ public:
     */
     inline __type operator [] ( __ix32 n ) { return m_data[n]; }
 
-    /*! \brief mirror ring buffer () operator
-     * \param[input] pointer to the input data
+    /*!
+     *  \brief  ring buffer recent sample reading function
+     *  \param[n] sample number ( n = 0 - the newest sample , n < buffer size )
+     *  \return The function returns the n-th sample before the last written one
+    */
+    inline __type recent( __ix32 n ) { __ix32 k = m_buffpos - n - 1; return m_data[ ( k < 0 ) ? k + m_nelem : k ]; }
+
+    /*! \brief mirror ring buffer () operator
+     * \param[input] pointer to the input data
+     * \return the operator call puts the data into the buffer by
+     *         means of calling fill_buff( __type *input ) function
+    */
+    inline void operator () ( __type *input ){ fill_buff< __type >( input ); }
+
+    /*! \brief mirror ring buffer () operator
+     * \param[input] pointer to the input data
+     * \return the operator call puts the data into the buffer by
+     *         means of calling fill_buff( __type *input ) function
+    */
+    inline void operator () ( __fx64 *input ){ fill_buff< __fx64 >( input ); }
+};
+
+/*! \brief 64-bit floating point ring buffer */
+template<> class ring_buffer<__fx64>
+{
+    typedef __fx64 __type;
+public:
+    /*! \brief mirror ring buffer lower half pointer */
+    __type *m_lower;
+    /*! \brief mirror ring buffer data pointer */
+    __type *m_data;
+     /*! \brief mirror ring buffer size */
+    __ix32  m_nelem;
+     /*! \brief mirror ring buffer position */
+    __ix32  m_buffpos;
+
+    /*! \brief mirror ring buffer memory allocation function
+     *  \param[nelem] the mirror ring buffer size
+    */
+    __ix32 allocate( __ix32 nelem )
+    {
+        if( ( nelem > 0 ) && !m_data )
+        {
+            m_nelem = nelem;
+            m_data  = ( __type* ) calloc( ( m_nelem ) , sizeof ( __type ) );
+            m_lower = ( m_data ) ? &m_data[0] : 0;
+            return ( m_data != 0 );
+        }
+        else return 0;
+    }
+
+    /*! \brief mirror ring buffer memory deallocation function */
+    void deallocate()
+    {
+        if( m_data != 0 )
+        {
+            free( m_data );
+            m_data = 0;
+        }
+    }
+
+    /*! \brief mirror ring buffer default constructor */
+    ring_buffer()
+    {
+        m_lower   = 0;
+        m_data    = 0;
+        m_nelem   = 0;
+        m_buffpos = 0;
+    }
+
+    /*! \brief mirror ring buffer destructor */
+    ~ring_buffer() { deallocate(); }
+
+    // biffer filling function:
+
+    /*! \brief mirror ring buffer template filling function
+     * \param[input] pointer to the input data
+    */
+    template< typename T > inline void fill_buff( T *input )
+    {
+        *m_lower = *input;
+        if( ++m_buffpos >= m_nelem )
+        {
+            m_lower   = &m_data[0];
+            m_buffpos = 0;
+        }
+        else
+        {
+            m_lower++;
+        }
+    }
+
+    /*!
+     *  \brief  mirror ring buffer position function
+     *  \return The function returns the buffer filling pointer position
+    */
+    inline __ix32 getBuffPos() { return m_buffpos; }
+
+    /*!
+     *  \brief  mirror ring buffer size function
+     *  \return The function returns the buffer size
+    */
+    inline __ix32 getBuffSize(){ return m_nelem;   }
+
+    /*! \brief mirror ring buffer [] operator
+     * \param[n] sample number
+     * \return the operator call returns a sample that is on the left from the current
+     *         mirror ring buffer position
+    */
+    inline __type operator [] ( __ix32 n ) { return m_data[n]; }
+
+    /*!
+     *  \brief  ring buffer recent sample reading function
+     *  \param[n] sample number ( n = 0 - the newest sample , n < buffer size )
+     *  \return The function returns the n-th sample before the last written one
+    */
+    inline __type recent( __ix32 n ) { __ix32 k = m_buffpos - n - 1; return m_data[ ( k < 0 ) ? k + m_nelem : k ]; }
+
+    /*! \brief mirror ring buffer () operator
+     * \param[input] pointer to the input data
      * \return the operator call puts the data into the buffer by
      *         means of calling fill_buff( __type *input ) function
     */
@@ -802,6 +1499,13 @@ public:
     */
     inline __type operator [] ( __ix32 n ) { return m_data[n]; }
 
+    /*!
+     *  \brief  ring buffer recent sample reading function
+     *  \param[n] sample number ( n = 0 - the newest sample , n < buffer size )
+     *  \return The function returns the n-th sample before the last written one
+    */
+    inline __type recent( __ix32 n ) { __ix32 k = m_buffpos - n - 1; return m_data[ ( k < 0 ) ? k + m_nelem : k ]; }
+
     /*! \brief mirror ring buffer () operator
      * \param[input] pointer to the input data
      * \return the operator call puts the data into the buffer by
@@ -906,6 +1610,13 @@ public:
     */
     inline __type operator [] ( __ix32 n ) { return m_data[n]; }
 
+    /*!
+     *  \brief  ring buffer recent sample reading function
+     *  \param[n] sample number ( n = 0 - the newest sample , n < buffer size )
+     *  \return The function returns the n-th sample before the last written one
+    */
+    inline __type recent( __ix32 n ) { __ix32 k = m_buffpos - n - 1; return m_data[ ( k < 0 ) ? k + m_nelem : k ]; }
+
     /*! \brief mirror ring buffer () operator
      * \param[input] pointer to the input data
      * \return the operator call puts the data into the buffer by
@@ -914,6 +1625,1124 @@ public:
     inline void operator () ( __type *input ){ fill_buff< __type >( input ); }
 };
 
+/*!
+ *  \brief 16-bit integer ( Q15 ) ring buffer
+ *  \details Floating point input samples are stored as 16-bit integers scaled by 32768 / m_scale ,
+ *           16-bit integer input is stored as is. value() function converts the samples back on read.
+*/
+template<> class ring_buffer<__ix16>
+{
+    typedef __ix16 __type;
+public:
+    /*! \brief mirror ring buffer lower half pointer */
+    __type *m_lower;
+    /*! \brief mirror ring buffer data pointer */
+    __type *m_data;
+     /*! \brief mirror ring buffer size */
+    __ix32  m_nelem;
+     /*! \brief mirror ring buffer position */
+    __ix32  m_buffpos;
+     /*! \brief stored signal full scale */
+    __fx64  m_scale;
+     /*! \brief input samples scaling factor */
+    __fx64  m_kq;
+
+    /*! \brief mirror ring buffer memory allocation function
+     *  \param[nelem] the mirror ring buffer size
+     *  \param[scale] the stored signal full scale
+    */
+    __ix32 allocate( __ix32 nelem , __fx64 scale = 1.0 )
+    {
+        if( ( nelem > 0 ) && !m_data )
+        {
+            setScale( scale );
+            m_nelem = nelem;
+            m_data  = ( __type* ) calloc( ( m_nelem ) , sizeof ( __type ) );
+            m_lower = ( m_data ) ? &m_data[0] : 0;
+            return ( m_data != 0 );
+        }
+        else return 0;
+    }
+
+    /*! \brief mirror ring buffer memory deallocation function */
+    void deallocate()
+    {
+        if( m_data != 0 )
+        {
+            free( m_data );
+            m_data = 0;
+        }
+    }
+
+    /*! \brief mirror ring buffer default constructor */
+    ring_buffer()
+    {
+        m_lower   = 0;
+        m_data    = 0;
+        m_nelem   = 0;
+        m_buffpos = 0;
+        m_scale   = 1.0;
+        m_kq      = 32768.0;
+    }
+
+    /*! \brief mirror ring buffer destructor */
+    ~ring_buffer() { deallocate(); }
+
+    /*! \brief stored signal full scale setting function
+     *  \param[scale] the stored signal full scale
+    */
+    inline void setScale( __fx64 scale ) { m_scale = scale; m_kq = 32768.0 / scale; }
+
+    /*! \brief Q15 conversion function
+     *  \param[x] input sample
+     *  \return The function returns the rounded and saturated Q15 representation of the input sample ( 0 for NaN )
+    */
+    inline __type quantize( __fx64 x )
+    {
+        x *= m_kq;
+        if( x != x ) return 0;
+        if( x >=  32767.0 ) return  32767;
+        if( x <= -32768.0 ) return -32768;
+        return ( __type )( ( x >= 0 ) ? ( x + 0.5 ) : ( x - 0.5 ) );
+    }
+
+    // biffer filling function:
+
+    /*! \brief mirror ring buffer raw filling function
+     * \param[input] pointer to the input 16-bit integer data
+    */
+    inline void fill_buff( const __type *input ) { put( *input ); }
+
+    /*! \brief mirror ring buffer template filling function
+     * \param[input] pointer to the input data
+     * \details the input sample is converted into Q15 format
+    */
+    template< typename T > inline void fill_buff( const T *input ) { put( quantize( *input ) ); }
+
+    /*!
+     *  \brief  mirror ring buffer position function
+     *  \return The function returns the buffer filling pointer position
+    */
+    inline __ix32 getBuffPos() { return m_buffpos; }
+
+    /*!
+     *  \brief  mirror ring buffer size function
+     *  \return The function returns the buffer size
+    */
+    inline __ix32 getBuffSize(){ return m_nelem;   }
+
+    /*!
+     *  \brief  mirror ring buffer scaled sample reading function
+     *  \param[n] sample number
+     *  \return The function returns a sample converted back into the input signal scale
+    */
+    inline __fx64 value( __ix32 n ) { return m_data[n] * m_scale * ( 1.0 / 32768.0 ); }
+
+    /*! \brief mirror ring buffer [] operator
+     * \param[n] sample number
+     * \return the operator call returns a raw Q15 sample
+    */
+    inline __type operator [] ( __ix32 n ) { return m_data[n]; }
+
+    /*!
+     *  \brief  ring buffer recent sample reading function
+     *  \param[n] sample number ( n = 0 - the newest sample , n < buffer size )
+     *  \return The function returns the n-th sample before the last written one as a raw Q15 sample
+    */
+    inline __type recent( __ix32 n ) { __ix32 k = m_buffpos - n - 1; return m_data[ ( k < 0 ) ? k + m_nelem : k ]; }
+
+    /*! \brief mirror ring buffer () operator
+     * \param[input] pointer to the input data
+     * \return the operator call puts the data into the buffer by
+     *         means of calling fill_buff( T *input ) function
+    */
+    template< typename T > inline void operator () ( T *input ){ fill_buff( ( const T* )input ); }
+
+private:
+
+    /*! \brief mirror ring buffer sample storing function */
+    inline void put( __type x )
+    {
+        *m_lower = x;
+        if( ++m_buffpos >= m_nelem )
+        {
+            m_lower   = &m_data[0];
+            m_buffpos = 0;
+        }
+        else
+        {
+            m_lower++;
+        }
+    }
+};
+
+/*!
+ *  \brief power of two capacity mirror ring buffer
+ *  \details The buffer capacity is rounded up to a power of two. So, the filling position is wrapped
+ *           by means of a mask and neither filling function nor [] operator contain branches.
+ *           The buffer keeps the interface of the exact capacity mirror ring buffer.
+*/
+template< typename T > class mirror_ring_buffer< T , pow2_capacity >
+{
+    typedef T __type;
+public:
+    /*! \brief mirror ring buffer data pointer */
+    __type *m_data;
+     /*! \brief mirror ring buffer size ( power of two ) */
+    __ix32  m_nelem;
+     /*! \brief mirror ring buffer position mask */
+    __ix32  m_mask;
+     /*! \brief mirror ring buffer position */
+    __ix32  m_buffpos;
+
+    /*! \brief mirror ring buffer memory allocation function
+     *  \param[nelem] the mirror ring buffer minimum size
+    */
+    __ix32 allocate( __ix32 nelem )
+    {
+        if( ( nelem > 0 ) && !m_data )
+        {
+            for( m_nelem = 1 ; m_nelem < nelem ; m_nelem <<= 1 );
+            m_mask    = m_nelem - 1;
+            m_buffpos = 0;
+            m_data    = ( __type* ) calloc( ( 2 * m_nelem ) , sizeof ( __type ) );
+            return ( m_data != 0 );
+        }
+        else return 0;
+    }
+
+    /*! \brief mirror ring buffer memory deallocation function */
+    void deallocate()
+    {
+        if( m_data != 0 )
+        {
+            free( m_data );
+            m_data = 0;
+        }
+    }
+
+    /*! \brief mirror ring buffer default constructor */
+    mirror_ring_buffer()
+    {
+        m_data    = 0;
+        m_nelem   = 0;
+        m_mask    = 0;
+        m_buffpos = 0;
+    }
+
+    /*! \brief mirror ring buffer destructor */
+    ~mirror_ring_buffer() { deallocate(); }
+
+    /*! \brief mirror ring buffer swapping function
+     *  \param[buff] the buffer to exchange the memory and the filling state with
+    */
+    inline void swap( mirror_ring_buffer &buff )
+    {
+        std::swap( m_data    , buff.m_data );
+        std::swap( m_nelem   , buff.m_nelem );
+        std::swap( m_mask    , buff.m_mask );
+        std::swap( m_buffpos , buff.m_buffpos );
+    }
+
+    /*! \brief mirror ring buffer template filling function
+     * \param[input] pointer to the input data
+    */
+    template< typename T2 > inline void fill_buff( T2 *input )
+    {
+        m_data[ m_buffpos           ] = *input;
+        m_data[ m_buffpos + m_nelem ] = *input;
+        m_buffpos = ( m_buffpos + 1 ) & m_mask;
+    }
+
+    /*! \brief mirror ring buffer block filling function
+     * \param[input] pointer to the input data block
+     * \param[n    ] input data block size
+     * \details the function puts the whole block into both halves of the buffer. Every half
+     *          is filled by means of not more than two contiguous copies
+    */
+    inline void fill_block( const __type *input , __ix32 n ) { m_buffpos = __mirror_fill__( m_data , m_nelem , m_buffpos , input , n ); }
+
+    /*! \brief mirror ring buffer template block filling function
+     * \param[input] pointer to the input data block
+     * \param[n    ] input data block size
+     * \details the function is used if the input data type differs from the buffer data type
+    */
+    template< typename T2 > inline void fill_block( const T2 *input , __ix32 n )
+    {
+        for( __ix32 i = 0 ; i < n ; i++ ) fill_buff( &input[i] );
+    }
+
+    /*!
+     *  \brief  mirror ring buffer contiguous history view function
+     *  \param[n] the number of the most recent samples
+     *  \return The function returns the contiguous view of the last n samples ( n is limited by the buffer size ).
+     *          The view is ordered from the oldest sample to the most recent one: view.data[ view.size - 1 ] = ( *this )[ 0 ]
+    */
+    inline buff_view< __type > view( __ix32 n ) { return __mirror_view__( m_data , m_nelem , m_buffpos , n ); }
+
+    /*!
+     *  \brief  mirror ring buffer position function
+     *  \return The function returns the buffer filling pointer position
+    */
+    inline __ix32 getBuffPos() { return m_buffpos; }
+
+    /*!
+     *  \brief  mirror ring buffer size function
+     *  \return The function returns the buffer size
+    */
+    inline __ix32 getBuffSize(){ return m_nelem;   }
+
+    /*! \brief mirror ring buffer [] operator
+     * \param[n] sample number
+     * \return the operator call returns a sample that is on the left from the current
+     *         mirror ring buffer position
+    */
+    inline __type operator [] ( __ix32 n ) { return m_data[ m_buffpos + m_nelem - n - 1 ]; }
+
+    /*! \brief mirror ring buffer gathering function
+     * \param[taps] pointer to the taps list ( sample numbers counted from the most recent sample )
+     * \param[out ] pointer to the output samples array
+     * \param[n   ] number of the taps
+     * \details the function reads all the taps in one call: out[ i ] = ( *this )[ taps[ i ] ]
+    */
+    inline void gather( const __ix32 *taps , __type *out , __ix32 n ) { __buff_gather__( *this , taps , out , n ); }
+
+    /*! \brief mirror ring buffer compile-time taps gathering function
+     * \param[out] pointer to the output samples array
+     * \details the function reads the taps defined by the template parameters list: out[ i ] = ( *this )[ Taps[ i ] ]
+    */
+    template< __ix32... Taps > inline void gather( __type *out )
+    {
+        const __ix32 taps[] = { Taps... };
+        __buff_gather__( *this , taps , out , sizeof...( Taps ) );
+    }
+
+    /*! \brief mirror ring buffer () operator
+     * \param[input] pointer to the input data
+     * \return the operator call puts the data into the buffer by
+     *         means of calling fill_buff( T2 *input ) function
+    */
+    template< typename T2 > inline void operator () ( T2 *input ){ fill_buff< T2 >( input ); }
+};
+
+/*!
+ *  \brief power of two capacity ring buffer
+ *  \details The buffer capacity is rounded up to a power of two. So, the filling position is wrapped
+ *           by means of a mask and neither filling function nor [] operator contain branches.
+*/
+template< typename T > class ring_buffer< T , pow2_capacity >
+{
+    typedef T __type;
+public:
+    /*! \brief ring buffer data pointer */
+    __type *m_data;
+     /*! \brief ring buffer size ( power of two ) */
+    __ix32  m_nelem;
+     /*! \brief ring buffer position mask */
+    __ix32  m_mask;
+     /*! \brief ring buffer position */
+    __ix32  m_buffpos;
+
+    /*! \brief ring buffer memory allocation function
+     *  \param[nelem] the ring buffer minimum size
+    */
+    __ix32 allocate( __ix32 nelem )
+    {
+        if( ( nelem > 0 ) && !m_data )
+        {
+            for( m_nelem = 1 ; m_nelem < nelem ; m_nelem <<= 1 );
+            m_mask    = m_nelem - 1;
+            m_buffpos = 0;
+            m_data    = ( __type* ) calloc( m_nelem , sizeof ( __type ) );
+            return ( m_data != 0 );
+        }
+        else return 0;
+    }
+
+    /*! \brief ring buffer memory deallocation function */
+    void deallocate()
+    {
+        if( m_data != 0 )
+        {
+            free( m_data );
+            m_data = 0;
+        }
+    }
+
+    /*! \brief ring buffer default constructor */
+    ring_buffer()
+    {
+        m_data    = 0;
+        m_nelem   = 0;
+        m_mask    = 0;
+        m_buffpos = 0;
+    }
+
+    /*! \brief ring buffer destructor */
+    ~ring_buffer() { deallocate(); }
+
+    /*! \brief ring buffer template filling function
+     * \param[input] pointer to the input data
+    */
+    template< typename T2 > inline void fill_buff( T2 *input )
+    {
+        m_data[ m_buffpos ] = *input;
+        m_buffpos = ( m_buffpos + 1 ) & m_mask;
+    }
+
+    /*!
+     *  \brief  ring buffer position function
+     *  \return The function returns the buffer filling pointer position
+    */
+    inline __ix32 getBuffPos() { return m_buffpos; }
+
+    /*!
+     *  \brief  ring buffer size function
+     *  \return The function returns the buffer size
+    */
+    inline __ix32 getBuffSize(){ return m_nelem;   }
+
+    /*! \brief ring buffer [] operator
+     * \param[n] sample number
+     * \return the operator call returns a sample that is on the left from the current
+     *         ring buffer position
+    */
+    inline __type operator [] ( __ix32 n ) { return m_data[ ( m_buffpos - n - 1 ) & m_mask ]; }
+
+    /*!
+     *  \brief  ring buffer recent sample reading function
+     *  \param[n] sample number ( n = 0 - the newest sample , n < buffer size )
+     *  \return The function returns the n-th sample before the last written one ( the same as the [] operator )
+    */
+    inline __type recent( __ix32 n ) { return m_data[ ( m_buffpos - n - 1 ) & m_mask ]; }
+
+    /*! \brief ring buffer () operator
+     * \param[input] pointer to the input data
+     * \return the operator call puts the data into the buffer by
+     *         means of calling fill_buff( T2 *input ) function
+    */
+    template< typename T2 > inline void operator () ( T2 *input ){ fill_buff< T2 >( input ); }
+};
+
+/*! \brief defines multichannel buffers rows alignment , bytes */
+#ifndef __SIMD_ALIGNMENT
+#define __SIMD_ALIGNMENT 64
+#endif
+
+/*!
+ *  \brief multichannel mirror ring buffer
+ *  \details The buffer keeps the history of C channels within a single memory block. Every row holds one
+ *           multichannel frame ( all the channels samples taken at the same instant ) and is padded up to
+ *           __SIMD_ALIGNMENT bytes , so every row starts at an aligned address and a filtering kernel can load
+ *           8 / 16 channels into a single SIMD register. All the channels share a single filling position.
+ *           The rows are stored twice ( mirror layout ) , so the last m_nelem rows are always contiguous.
+ *           The channels number is either fixed by the template parameter C or set at the memory allocation if C = 0.
+*/
+template< typename T , __ix32 C > class multichannel_ring_buffer
+{
+    typedef T __type;
+public:
+    /*! \brief allocated memory pointer */
+    void   *m_raw;
+    /*! \brief aligned data pointer */
+    __type *m_data;
+     /*! \brief buffer size , rows */
+    __ix32  m_nelem;
+     /*! \brief row size including padding , samples */
+    __ix32  m_stride;
+     /*! \brief buffer position */
+    __ix32  m_buffpos;
+     /*! \brief channels number */
+    __ix32  m_channels;
+
+    /*! \brief multichannel buffer memory allocation function
+     *  \param[nelem   ] the buffer size , rows
+     *  \param[channels] the channels number ( must be equal to C if C > 0 )
+    */
+    __ix32 allocate( __ix32 nelem , __ix32 channels = C )
+    {
+        if( ( nelem > 0 ) && ( channels > 0 ) && ( C == 0 || channels == C ) && !m_raw )
+        {
+            __ix32 row = ( ( channels * sizeof ( __type ) + __SIMD_ALIGNMENT - 1 ) / __SIMD_ALIGNMENT ) * __SIMD_ALIGNMENT;
+            m_channels = channels;
+            m_nelem    = nelem;
+            m_stride   = row / sizeof ( __type );
+            m_buffpos  = 0;
+            m_raw      = calloc( 2 * m_nelem * row + __SIMD_ALIGNMENT , 1 );
+            m_data     = ( m_raw ) ? ( __type* )( ( ( size_t )m_raw + __SIMD_ALIGNMENT - 1 ) & ~( size_t )( __SIMD_ALIGNMENT - 1 ) ) : 0;
+            return ( m_raw != 0 );
+        }
+        else return 0;
+    }
+
+    /*! \brief multichannel buffer memory deallocation function */
+    void deallocate()
+    {
+        if( m_raw != 0 )
+        {
+            free( m_raw );
+            m_raw  = 0;
+            m_data = 0;
+        }
+    }
+
+    /*! \brief multichannel buffer default constructor */
+    multichannel_ring_buffer()
+    {
+        m_raw      = 0;
+        m_data     = 0;
+        m_nelem    = 0;
+        m_stride   = 0;
+        m_buffpos  = 0;
+        m_channels = C;
+    }
+
+    /*! \brief multichannel buffer destructor */
+    ~multichannel_ring_buffer() { deallocate(); }
+
+    /*! \brief multichannel buffer swapping function
+     *  \param[buff] the buffer to exchange the memory and the filling state with
+    */
+    inline void swap( multichannel_ring_buffer &buff )
+    {
+        std::swap( m_raw      , buff.m_raw );
+        std::swap( m_data     , buff.m_data );
+        std::swap( m_nelem    , buff.m_nelem );
+        std::swap( m_stride   , buff.m_stride );
+        std::swap( m_buffpos  , buff.m_buffpos );
+        std::swap( m_channels , buff.m_channels );
+    }
+
+    /*! \brief multichannel buffer template filling function
+     * \param[frame] pointer to the input multichannel frame ( getChannels() samples )
+    */
+    template< typename T2 > inline void fill_buff( const T2 *frame )
+    {
+        __type *lower = &m_data[ m_buffpos * m_stride ];
+        __type *upper = &m_data[ ( m_buffpos + m_nelem ) * m_stride ];
+        for( __ix32 ch = 0 ; ch < getChannels() ; ch++ ) lower[ ch ] = upper[ ch ] = frame[ ch ];
+        if( ++m_buffpos >= m_nelem ) m_buffpos = 0;
+    }
+
+    /*! \brief multichannel buffer block filling function
+     * \param[frames] pointer to the input frames ( n frames , getChannels() samples each , frame by frame )
+     * \param[n     ] number of the input frames
+    */
+    template< typename T2 > inline void fill_block( const T2 *frames , __ix32 n )
+    {
+        for( __ix32 i = 0 ; i < n ; i++ ) fill_buff( &frames[ i * getChannels() ] );
+    }
+
+    /*!
+     *  \brief  multichannel buffer contiguous history view function
+     *  \param[n] the number of the most recent rows
+     *  \return The function returns the contiguous view of the last n rows ( n is limited by the buffer size ).
+     *          The view is ordered from the oldest row to the most recent one. The rows are m_stride samples apart.
+    */
+    inline buff_view< __type > view( __ix32 n ) { if( n > m_nelem ) n = m_nelem; return buff_view< __type >{ &m_data[ ( m_buffpos + m_nelem - n ) * m_stride ] , n }; }
+
+    /*!
+     *  \brief  multichannel buffer position function
+     *  \return The function returns the buffer filling pointer position
+    */
+    inline __ix32 getBuffPos() { return m_buffpos; }
+
+    /*!
+     *  \brief  multichannel buffer size function
+     *  \return The function returns the buffer size , rows
+    */
+    inline __ix32 getBuffSize(){ return m_nelem; }
+
+    /*!
+     *  \brief  multichannel buffer row size function
+     *  \return The function returns the row size including padding , samples
+    */
+    inline __ix32 getStride(){ return m_stride; }
+
+    /*!
+     *  \brief  multichannel buffer channels number function
+     *  \return The function returns the channels number
+    */
+    inline __ix32 getChannels(){ return ( C > 0 ) ? C : m_channels; }
+
+    /*! \brief multichannel buffer [] operator
+     * \param[n] row number
+     * \return the operator call returns the aligned row that is on the left from the current
+     *         buffer position: ( *this )[ n ][ ch ] is the sample of the channel ch taken n frames ago
+    */
+    inline __type* operator [] ( __ix32 n ) { return &m_data[ ( m_buffpos + m_nelem - n - 1 ) * m_stride ]; }
+
+    /*! \brief multichannel buffer () operator
+     * \param[frame] pointer to the input multichannel frame
+     * \return the operator call puts the frame into the buffer by
+     *         means of calling fill_buff( T2 *frame ) function
+    */
+    template< typename T2 > inline void operator () ( const T2 *frame ){ fill_buff< T2 >( frame ); }
+};
+
+#if !defined( __ALG_PLATFORM ) && defined( __linux__ )
+
+/*!
+ *  \brief double-mapped mirror ring buffer
+ *  \details The buffer memory is a memory file that is mapped twice into two adjacent virtual memory regions.
+ *           So, every sample is written once, but it is seen within both buffer halves and the last m_nelem
+ *           samples are always stored contiguously. The buffer capacity is rounded up to the memory page size.
+ *           The buffer keeps the interface of the exact capacity mirror ring buffer.
+*/
+template< typename T > class mirror_ring_buffer< T , mapped_capacity >
+{
+    typedef T __type;
+public:
+    /*! \brief mirror ring buffer data pointer ( the beginning of the lower mapping ) */
+    __type *m_data;
+     /*! \brief mirror ring buffer size */
+    __ix32  m_nelem;
+     /*! \brief mirror ring buffer position */
+    __ix32  m_buffpos;
+     /*! \brief size of every mapping , bytes */
+    size_t  m_bytes;
+
+    /*! \brief mirror ring buffer memory allocation function
+     *  \param[nelem] the mirror ring buffer minimum size
+    */
+    __ix32 allocate( __ix32 nelem )
+    {
+        if( ( nelem <= 0 ) || m_data ) return 0;
+
+        // mapping size is a multiple of the memory page size:
+        size_t page = sysconf( _SC_PAGESIZE );
+        m_bytes = ( ( nelem * sizeof ( __type ) + page - 1 ) / page ) * page;
+
+        // memory file:
+        int fd = syscall( SYS_memfd_create , "mirror_ring_buffer" , 0 );
+        if( fd < 0 ) return 0;
+        if( ftruncate( fd , m_bytes ) != 0 ) { close( fd ); return 0; }
+
+        // reserve two adjacent regions and map the memory file onto each of them:
+        void *base = mmap( 0 , 2 * m_bytes , PROT_NONE , MAP_PRIVATE | MAP_ANONYMOUS , -1 , 0 );
+        if( base == MAP_FAILED ) { close( fd ); return 0; }
+
+        void *lower = mmap( base , m_bytes , PROT_READ | PROT_WRITE , MAP_SHARED | MAP_FIXED , fd , 0 );
+        void *upper = mmap( ( char* )base + m_bytes , m_bytes , PROT_READ | PROT_WRITE , MAP_SHARED | MAP_FIXED , fd , 0 );
+        close( fd );
+
+        if( lower == MAP_FAILED || upper == MAP_FAILED )
+        {
+            munmap( base , 2 * m_bytes );
+            return 0;
+        }
+
+        m_data    = ( __type* ) base;
+        m_nelem   = m_bytes / sizeof ( __type );
+        m_buffpos = 0;
+        return 1;
+    }
+
+    /*! \brief mirror ring buffer memory deallocation function */
+    void deallocate()
+    {
+        if( m_data != 0 )
+        {
+            munmap( m_data , 2 * m_bytes );
+            m_data = 0;
+        }
+    }
+
+    /*! \brief mirror ring buffer default constructor */
+    mirror_ring_buffer()
+    {
+        m_data    = 0;
+        m_nelem   = 0;
+        m_buffpos = 0;
+        m_bytes   = 0;
+    }
+
+    /*! \brief mirror ring buffer destructor */
+    ~mirror_ring_buffer() { deallocate(); }
+
+    /*! \brief mirror ring buffer swapping function
+     *  \param[buff] the buffer to exchange the memory and the filling state with
+    */
+    inline void swap( mirror_ring_buffer &buff )
+    {
+        std::swap( m_data    , buff.m_data );
+        std::swap( m_nelem   , buff.m_nelem );
+        std::swap( m_buffpos , buff.m_buffpos );
+        std::swap( m_bytes   , buff.m_bytes );
+    }
+
+    /*! \brief mirror ring buffer template filling function
+     * \param[input] pointer to the input data
+    */
+    template< typename T2 > inline void fill_buff( T2 *input )
+    {
+        m_data[ m_buffpos ] = *input;
+        if( ++m_buffpos >= m_nelem ) m_buffpos = 0;
+    }
+
+    /*! \brief mirror ring buffer block filling function
+     * \param[input] pointer to the input data block
+     * \param[n    ] input data block size
+     * \details the function puts the whole block into the lower mapping , the upper mapping mirrors it
+    */
+    inline void fill_block( const __type *input , __ix32 n ) { m_buffpos = __mirror_fill__( m_data , m_nelem , m_buffpos , input , n , 0 ); }
+
+    /*! \brief mirror ring buffer template block filling function
+     * \param[input] pointer to the input data block
+     * \param[n    ] input data block size
+     * \details the function is used if the input data type differs from the buffer data type
+    */
+    template< typename T2 > inline void fill_block( const T2 *input , __ix32 n )
+    {
+        for( __ix32 i = 0 ; i < n ; i++ ) fill_buff( &input[i] );
+    }
+
+    /*!
+     *  \brief  mirror ring buffer contiguous history view function
+     *  \param[n] the number of the most recent samples
+     *  \return The function returns the contiguous view of the last n samples ( n is limited by the buffer size ).
+     *          The view is ordered from the oldest sample to the most recent one: view.data[ view.size - 1 ] = ( *this )[ 0 ]
+    */
+    inline buff_view< __type > view( __ix32 n ) { return __mirror_view__( m_data , m_nelem , m_buffpos , n ); }
+
+    /*!
+     *  \brief  mirror ring buffer position function
+     *  \return The function returns the buffer filling pointer position
+    */
+    inline __ix32 getBuffPos() { return m_buffpos; }
+
+    /*!
+     *  \brief  mirror ring buffer size function
+     *  \return The function returns the buffer size
+    */
+    inline __ix32 getBuffSize(){ return m_nelem;   }
+
+    /*! \brief mirror ring buffer [] operator
+     * \param[n] sample number
+     * \return the operator call returns a sample that is on the left from the current
+     *         mirror ring buffer position
+    */
+    inline __type operator [] ( __ix32 n ) { return m_data[ m_buffpos + m_nelem - n - 1 ]; }
+
+    /*! \brief mirror ring buffer gathering function
+     * \param[taps] pointer to the taps list ( sample numbers counted from the most recent sample )
+     * \param[out ] pointer to the output samples array
+     * \param[n   ] number of the taps
+     * \details the function reads all the taps in one call: out[ i ] = ( *this )[ taps[ i ] ]
+    */
+    inline void gather( const __ix32 *taps , __type *out , __ix32 n ) { __buff_gather__( *this , taps , out , n ); }
+
+    /*! \brief mirror ring buffer compile-time taps gathering function
+     * \param[out] pointer to the output samples array
+     * \details the function reads the taps defined by the template parameters list: out[ i ] = ( *this )[ Taps[ i ] ]
+    */
+    template< __ix32... Taps > inline void gather( __type *out )
+    {
+        const __ix32 taps[] = { Taps... };
+        __buff_gather__( *this , taps , out , sizeof...( Taps ) );
+    }
+
+    /*! \brief mirror ring buffer () operator
+     * \param[input] pointer to the input data
+     * \return the operator call puts the data into the buffer by
+     *         means of calling fill_buff( T2 *input ) function
+    */
+    template< typename T2 > inline void operator () ( T2 *input ){ fill_buff< T2 >( input ); }
+};
+
+#endif
+
+#ifndef __ALG_PLATFORM
+
+/*! \brief defines the cache line size , bytes */
+#ifndef __CACHE_LINE_SIZE
+#define __CACHE_LINE_SIZE 64
+#endif
+
+/*!
+ *  \brief single producer / single consumer lock-free ring buffer
+ *  \details The buffer passes samples from one thread ( producer ) to another thread ( consumer ) without locks.
+ *           The producer owns the head index , the consumer owns the tail index. Indices are published with
+ *           release stores and observed with acquire loads. They are placed on separate cache lines
+ *           to avoid false sharing between the threads. The buffer capacity is rounded up to a power of two.
+ *           push() must be called by the producer thread only , pop() must be called by the consumer thread only.
+*/
+template< typename T > class spsc_ring_buffer
+{
+    typedef T            __type;
+    typedef unsigned int __index;
+public:
+    /*! \brief ring buffer data pointer */
+    __type *m_data;
+    /*! \brief ring buffer size ( power of two ) */
+    __index m_nelem;
+    /*! \brief ring buffer position mask */
+    __index m_mask;
+
+private:
+    /*! \brief write index ( written by the producer ) */
+    alignas( __CACHE_LINE_SIZE ) std::atomic< __index > m_head;
+    /*! \brief read index copy that is cached by the producer */
+    __index m_tail_cache;
+    /*! \brief read index ( written by the consumer ) */
+    alignas( __CACHE_LINE_SIZE ) std::atomic< __index > m_tail;
+    /*! \brief write index copy that is cached by the consumer */
+    __index m_head_cache;
+
+    /*! \brief copies n samples from the input to the ring buffer starting from the index pos */
+    inline void copy_in( __index pos , const __type *input , __index n )
+    {
+        __index i  = pos & m_mask;
+        __index n1 = ( n < m_nelem - i ) ? n : ( m_nelem - i );
+        memcpy( &m_data[ i ] , input      , n1 * sizeof ( __type ) );
+        memcpy( &m_data[ 0 ] , input + n1 , ( n - n1 ) * sizeof ( __type ) );
+    }
+
+    /*! \brief copies n samples from the ring buffer starting from the index pos to the output */
+    inline void copy_out( __index pos , __type *output , __index n )
+    {
+        __index i  = pos & m_mask;
+        __index n1 = ( n < m_nelem - i ) ? n : ( m_nelem - i );
+        memcpy( output      , &m_data[ i ] , n1 * sizeof ( __type ) );
+        memcpy( output + n1 , &m_data[ 0 ] , ( n - n1 ) * sizeof ( __type ) );
+    }
+
+public:
+
+    /*! \brief ring buffer memory allocation function
+     *  \param[nelem] the ring buffer minimum size
+     *  \details the function must be called before the producer and the consumer threads are started
+    */
+    __ix32 allocate( __ix32 nelem )
+    {
+        if( ( nelem > 0 ) && !m_data )
+        {
+            for( m_nelem = 1 ; m_nelem < ( __index )nelem ; m_nelem <<= 1 );
+            m_mask = m_nelem - 1;
+            m_data = ( __type* ) calloc( m_nelem , sizeof ( __type ) );
+            m_head.store( 0 , std::memory_order_relaxed );
+            m_tail.store( 0 , std::memory_order_relaxed );
+            m_head_cache = 0;
+            m_tail_cache = 0;
+            return ( m_data != 0 );
+        }
+        else return 0;
+    }
+
+    /*! \brief ring buffer memory deallocation function */
+    void deallocate()
+    {
+        if( m_data != 0 )
+        {
+            free( m_data );
+            m_data = 0;
+        }
+    }
+
+    /*! \brief ring buffer default constructor */
+    spsc_ring_buffer()
+    {
+        m_data       = 0;
+        m_nelem      = 0;
+        m_mask       = 0;
+        m_head_cache = 0;
+        m_tail_cache = 0;
+        m_head.store( 0 , std::memory_order_relaxed );
+        m_tail.store( 0 , std::memory_order_relaxed );
+    }
+
+    /*! \brief ring buffer destructor */
+    ~spsc_ring_buffer() { deallocate(); }
+
+    /*! \brief producer batch writing function
+     *  \param[input] pointer to the input data block
+     *  \param[n    ] input data block size
+     *  \return The function puts the whole block into the buffer and returns 1 , or returns 0 without
+     *          writing anything if there is not enough free space. The function never blocks.
+    */
+    __ix32 push( const __type *input , __ix32 n )
+    {
+        __index head = m_head.load( std::memory_order_relaxed );
+        if( m_nelem - ( head - m_tail_cache ) < ( __index )n )
+        {
+            m_tail_cache = m_tail.load( std::memory_order_acquire );
+            if( m_nelem - ( head - m_tail_cache ) < ( __index )n ) return 0;
+        }
+
+        copy_in( head , input , n );
+        m_head.store( head + n , std::memory_order_release );
+        return 1;
+    }
+
+    /*! \brief consumer batch reading function
+     *  \param[output] pointer to the output data block
+     *  \param[n     ] output data block size
+     *  \return The function takes n samples out of the buffer and returns 1 , or returns 0 without
+     *          reading anything if there are less than n samples within the buffer. The function never blocks.
+    */
+    __ix32 pop( __type *output , __ix32 n )
+    {
+        __index tail = m_tail.load( std::memory_order_relaxed );
+        if( m_head_cache - tail < ( __index )n )
+        {
+            m_head_cache = m_head.load( std::memory_order_acquire );
+            if( m_head_cache - tail < ( __index )n ) return 0;
+        }
+
+        copy_out( tail , output , n );
+        m_tail.store( tail + n , std::memory_order_release );
+        return 1;
+    }
+
+    /*! \brief producer single sample writing function
+     *  \param[input] pointer to the input data
+     *  \return The function returns 1 if the sample has been written and 0 if the buffer is full
+    */
+    inline __ix32 fill_buff( const __type *input ) { return push( input , 1 ); }
+
+    /*!
+     *  \brief  ring buffer filling function
+     *  \return The function returns the number of samples that are ready to be read. The result is exact
+     *          when the function is called by the consumer and is a lower estimate otherwise.
+    */
+    inline __ix32 getBuffFill() { return m_head.load( std::memory_order_acquire ) - m_tail.load( std::memory_order_acquire ); }
+
+    /*!
+     *  \brief  ring buffer size function
+     *  \return The function returns the buffer size
+    */
+    inline __ix32 getBuffSize(){ return m_nelem; }
+};
+
+#endif
+
+/*!
+ *  \brief fractional delay reader
+ *  \details The reader implements P-th order Lagrange interpolation ( Farrow structure evaluated for the fixed delay ) over
+ *           the mirror ring buffer history , so the output is the input signal delayed by a fractional number of samples:
+ *           y[ n ] = x( n - delay ). The interpolation polynomial taps are precomputed once for the fixed delay and the
+ *           interpolator is centered around the delay if possible: the samples m_base ... m_base + P are read ,
+ *           m_base = floor( delay ) - ( P - 1 ) / 2 , m_base >= 0.
+*/
+template< typename T , __ix32 P > struct frac_delay
+{
+    /*! \brief Lagrange interpolator taps */
+    T      m_h[ P + 1 ];
+    /*! \brief the first interpolator tap position , samples */
+    __ix32 m_base;
+
+    /*!
+     *  \brief  fractional delay reader initialization function
+     *  \param[delay] - the delay , samples ( delay >= 0 )
+    */
+    void init( __fx64 delay )
+    {
+        m_base = ( __ix32 )delay - ( P - 1 ) / 2;
+        if( m_base < 0 ) m_base = 0;
+
+        __fx64 d = delay - m_base;
+        for( __ix32 k = 0 ; k <= P ; k++ )
+        {
+            __fx64 h = 1;
+            for( __ix32 m = 0 ; m <= P ; m++ ) if( m != k ) h *= ( d - m ) / ( k - m );
+            m_h[k] = h;
+        }
+    }
+
+    /*!
+     *  \brief  fractional delay reader buffer size function
+     *  \return The function returns the minimum buffer size required by the reader
+    */
+    inline __ix32 size() { return m_base + P + 1; }
+
+    /*!
+     *  \brief  fractional delay reading operator
+     *  \param[buff] - mirror ring buffer
+     *  \return The operator returns the buffer history interpolated at the fractional delay
+    */
+    template< typename B > inline T operator () ( B &buff )
+    {
+        T y = 0;
+        for( __ix32 k = 0 ; k <= P ; k++ ) y += m_h[k] * buff[ m_base + k ];
+        return y;
+    }
+};
+
+/*! \brief defines the filter state memory block magic number */
+#ifndef __STATE_MAGIC
+#define __STATE_MAGIC 0x54535044
+#endif
+
+/*! \brief defines the filter state memory block layout version */
+#ifndef __STATE_VERSION
+#define __STATE_VERSION 1
+#endif
+
+/*!
+  \brief filter state memory block header data structure
+  \param[magic  ] __STATE_MAGIC
+  \param[version] __STATE_VERSION
+  \param[size   ] the state memory block size including the header , bytes
+  \param[tag    ] the filter class tag , the state is restored only by the class that has saved it
+*/
+struct state_header { __ix32 magic; __ix32 version; __ix32 size; __ix32 tag; };
+
+/*!
+ *  \brief  filter class tag computation function
+ *  \param[name] - filter class name
+ *  \return the function returns the FNV-1a hash of the class name
+*/
+inline __ix32 __state_tag__( const char *name )
+{
+    __uix32 h = 2166136261u;
+    while( *name ) h = ( h ^ ( unsigned char )*name++ ) * 16777619u;
+    return ( __ix32 )h;
+}
+
+/*!
+ *  \brief  filter state field writing function
+ *  \param[blob] - pointer to the state memory block or null pointer to compute the state size only
+ *  \param[pos ] - current position within the state memory block , bytes
+ *  \param[x   ] - pointer to the field data
+ *  \param[n   ] - number of the field elements
+ *  \details Every field of the state memory block is padded up to 8 bytes , so all the fields
+ *           remain aligned if the block itself is aligned.
+*/
+template< typename T > inline void __state_put__( char *blob , __ix32 &pos , const T *x , __ix32 n = 1 )
+{
+    if( blob && n > 0 ) memcpy( blob + pos , x , n * sizeof ( T ) );
+    pos += ( ( n * sizeof ( T ) + 7 ) / 8 ) * 8;
+}
+
+/*!
+ *  \brief  filter state field room checking function
+ *  \param[end] - the state memory block size , bytes
+ *  \param[pos] - current position within the state memory block , bytes
+ *  \param[n  ] - number of the field elements
+ *  \return the function returns 1 if the field of n elements fits the rest of the state memory block or 0 otherwise.
+ *          The sizes read out of the state are checked before the memory allocation.
+*/
+template< typename T > inline __ix32 __state_room__( __ix32 end , __ix32 pos , __ix32 n )
+{
+    return ( n >= 0 ) && ( pos >= 0 ) && ( pos <= end ) && ( ( ( ( __ix64 )n * ( __ix64 )sizeof ( T ) + 7 ) / 8 ) * 8 <= end - pos );
+}
+
+/*!
+ *  \brief  filter state field reading function
+ *  \param[blob] - pointer to the state memory block
+ *  \param[end ] - the state memory block size , bytes
+ *  \param[pos ] - current position within the state memory block , bytes
+ *  \param[x   ] - pointer to the field data
+ *  \param[n   ] - number of the field elements
+ *  \return the function returns 1 on success or 0 if the field is out of the state memory block. The failure is sticky:
+ *          the position is moved past the end , so all the following fields are not read as well.
+*/
+template< typename T > inline __ix32 __state_get__( const char *blob , __ix32 end , __ix32 &pos , T *x , __ix32 n = 1 )
+{
+    if( !__state_room__< T >( end , pos , n ) ) { pos = end + 1; return 0; }
+    if( n > 0 ) memcpy( x , blob + pos , n * sizeof ( T ) );
+    pos += ( ( n * sizeof ( T ) + 7 ) / 8 ) * 8;
+    return 1;
+}
+
+/*!
+ *  \brief  filter state header writing function
+ *  \param[blob] - pointer to the state memory block or null pointer to compute the state size only
+ *  \param[pos ] - current position within the state memory block , bytes
+ *  \param[name] - filter class name
+ *  \details the header is written at the beginning of the block , the size is set by __state_end__
+*/
+inline void __state_begin__( char *blob , __ix32 &pos , const char *name )
+{
+    state_header h = { __STATE_MAGIC , __STATE_VERSION , 0 , __state_tag__( name ) };
+    pos = 0;
+    __state_put__( blob , pos , &h );
+}
+
+/*!
+ *  \brief  filter state header completion function
+ *  \param[blob] - pointer to the state memory block or null pointer to compute the state size only
+ *  \param[pos ] - the state memory block size , bytes
+ *  \return the function stores the block size into the header and returns it
+*/
+inline __ix32 __state_end__( char *blob , __ix32 pos )
+{
+    if( blob ) memcpy( blob + offsetof( state_header , size ) , &pos , sizeof ( pos ) );
+    return pos;
+}
+
+/*!
+ *  \brief  filter state header reading function
+ *  \param[blob] - pointer to the state memory block
+ *  \param[size] - available memory size , bytes
+ *  \param[pos ] - current position within the state memory block , bytes
+ *  \param[name] - filter class name
+ *  \return the function checks the magic number , the layout version , the class tag and the block size against
+ *          the available memory and returns the state memory block size or 0 if the block is not valid
+*/
+inline __ix32 __state_open__( const char *blob , __ix32 size , __ix32 &pos , const char *name )
+{
+    state_header h;
+    pos = 0;
+    if( blob == 0 || !__state_get__( blob , size , pos , &h ) ) return 0;
+    if( h.magic != __STATE_MAGIC || h.version != __STATE_VERSION || h.tag != __state_tag__( name ) ) return 0;
+    return ( h.size >= pos && h.size <= size ) ? h.size : 0;
+}
+
+/*!
+ *  \brief  nested filter state reading function
+ *  \param[filt] - nested filter
+ *  \param[blob] - pointer to the state memory block
+ *  \param[end ] - the state memory block size , bytes
+ *  \param[pos ] - current position within the state memory block , bytes
+ *  \return the function restores the nested filter state that starts at the current position and returns 1 or returns 0
+ *          if the nested state is not valid. The failure is sticky as well as for __state_get__.
+*/
+template< typename F > inline __ix32 __state_nested__( F &filt , const char *blob , __ix32 end , __ix32 &pos )
+{
+    __ix32 n = ( pos >= 0 && pos < end ) ? filt.load_state( blob + pos , end - pos ) : 0;
+    if( n == 0 ) { pos = end + 1; return 0; }
+    pos += n;
+    return 1;
+}
+
+/*!
+ *  \brief  mirror ring buffer state writing function
+ *  \param[blob] - pointer to the state memory block or null pointer to compute the state size only
+ *  \param[pos ] - current position within the state memory block , bytes
+ *  \param[buff] - mirror ring buffer
+ *  \details the function stores the buffer size and the buffer history from the oldest sample to the most recent one
+*/
+template< typename B > inline void __buff_put__( char *blob , __ix32 &pos , B &buff )
+{
+    __ix32 n = buff.getBuffSize();
+    __state_put__( blob , pos , &n );
+    if( n > 0 ) __state_put__( blob , pos , buff.view( n ).data , n );
+}
+
+/*!
+ *  \brief  mirror ring buffer state reading function
+ *  \param[blob] - pointer to the state memory block
+ *  \param[end ] - the state memory block size , bytes
+ *  \param[pos ] - current position within the state memory block , bytes
+ *  \param[buff] - allocated mirror ring buffer
+ *  \return the function restores the buffer history and returns 1 or returns 0 if the stored
+ *          buffer size does not match the buffer size or the history is out of the state memory block
+*/
+template< typename B > inline __ix32 __buff_get__( const char *blob , __ix32 end , __ix32 &pos , B &buff )
+{
+    typedef typename std::remove_pointer< decltype( buff.view( 0 ).data ) >::type T;
+    __ix32 n = 0;
+    if( !__state_get__( blob , end , pos , &n ) ) return 0;
+    if( n != buff.getBuffSize() || !__state_room__< T >( end , pos , n ) ) { pos = end + 1; return 0; }
+    if( n > 0 )
+    {
+        buff.fill_block( ( const T* )( blob + pos ) , n );
+        pos += ( ( n * sizeof ( T ) + 7 ) / 8 ) * 8;
+    }
+    return 1;
+}
+
 /*! @} */
 
 // customized C data typed exclusion to avoid aliases:
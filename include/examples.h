@@ -15,6 +15,7 @@
 #include <iostream>
 #include <fstream>
 #include "string"
+#include <thread>
 #include <QElapsedTimer>
 
 // DSP template library headers:
@@ -25,6 +26,7 @@
 #include "include/iir.h"
 #include "include/recursive_fourier.h"
 #include "include/quad_mltpx.h"
+#include "include/recursive_rms.h"
 #include "include/transfer_functions.h"
 #include "include/logical.h"
 
@@ -1042,4 +1044,1332 @@ int example9()
     return 0;
 }
 
+/*!
+ *  \brief FIR convolution over the given delay line ( auxiliary function for the buffers benchmark )
+ *  \param[bx    ] - delay line
+ *  \param[cf    ] - FIR coefficients
+ *  \param[order ] - FIR order
+ *  \param[input ] - input signal
+ *  \param[n     ] - input signal length
+ *  \param[sink  ] - accumulated output ( keeps the computations from being optimized out )
+ *  \return The function returns the time spent per sample , ns
+*/
+template< typename B > double __bench_fir_buffer__( B &bx , double *cf , int order , double *input , int n , double &sink )
+{
+    QElapsedTimer timer;
+    double out = 0;
+
+    timer.start();
+    for( int i = 0 ; i < n ; i++ )
+    {
+        bx.fill_buff( &input[i] );
+        out = 0;
+        for( int k = order ; k >= 0 ; k-- ) out += bx[ k ] * cf[ k ];
+        sink += out;
+    }
+
+    return (double)timer.nsecsElapsed() / (double)n;
+}
+
+/*! \brief exact and power of two capacity mirror ring buffers FIR filtering benchmark */
+int example10()
+{
+    printf( " ...exact and power of two capacity mirror ring buffers FIR benchmark... \n " );
+
+    // emulation parameters:
+    double Fs     = 4000;
+    double Fn     = 50;
+    int    Ns     = 10 * Fs;
+    int    orders[] = { 20 , 50 , 100 , 200 , 300 , 400 , 500 };
+    double sink   = 0;
+
+    // input signal:
+    sgen< double > gen;
+    double *signal = ( double* ) calloc( Ns , sizeof ( double ) );
+    for( int i = 0 ; i < Ns ; i++ ) signal[i] = gen.sine( 1 , Fn , 0 , Fs );
+
+    printf( "order \t exact , ns/sample \t pow2 , ns/sample \n" );
+    for( int i = 0 ; i < (int)( sizeof ( orders ) / sizeof ( orders[0] ) ) ; i++ )
+    {
+        // FIR coefficients:
+        wind_fcn wind;
+        wind.init( orders[i] + 1 );
+        wind.Chebyshev( 60 );
+        double *cf = __fir_wind_digital_lp__< double >( Fs , 100 , orders[i] , 1 , wind );
+
+        // delay lines:
+        mirror_ring_buffer< double > bx_exact;
+        mirror_ring_buffer< double , pow2_capacity > bx_pow2;
+        bx_exact.allocate( orders[i] + 1 );
+        bx_pow2 .allocate( orders[i] + 1 );
+
+        // filtering time per sample:
+        double dt_exact = __bench_fir_buffer__( bx_exact , cf , orders[i] , signal , Ns , sink );
+        double dt_pow2  = __bench_fir_buffer__( bx_pow2  , cf , orders[i] , signal , Ns , sink );
+        printf( "%d \t %.3f \t %.3f \n" , orders[i] , dt_exact , dt_pow2 );
+
+        // memory deallocation:
+        bx_exact.deallocate();
+        bx_pow2 .deallocate();
+        free( cf );
+    }
+
+    printf( "checksum = %f \n" , sink );
+    free( signal );
+
+    return 0;
+}
+
+/*!
+ *  \brief FIR convolution by means of the dot product kernel ( auxiliary function for the SIMD kernels benchmark )
+ *  \param[bx    ] - delay line
+ *  \param[cfr   ] - time-reversed FIR coefficients
+ *  \param[N     ] - number of the FIR coefficients
+ *  \param[input ] - input signal
+ *  \param[n     ] - input signal length
+ *  \param[kernel] - dot product kernel
+ *  \param[sink  ] - accumulated output ( keeps the computations from being optimized out )
+ *  \return The function returns the time spent per sample , ns
+*/
+double __bench_fir_kernel__( mirror_ring_buffer< float > &bx , float *cfr , int N , float *input , int n , dot_kernel< float >::type kernel , double &sink )
+{
+    QElapsedTimer timer;
+
+    timer.start();
+    for( int i = 0 ; i < n ; i++ )
+    {
+        bx.fill_buff( &input[i] );
+        sink += kernel( bx.view( N ).data , cfr , N );
+    }
+
+    return (double)timer.nsecsElapsed() / (double)n;
+}
+
+/*! \brief FIR filtering SIMD dot product kernels benchmark */
+int example11()
+{
+    printf( " ...FIR filtering SIMD dot product kernels benchmark... \n " );
+
+    // emulation parameters:
+    double Fs     = 4000;
+    double Fn     = 50;
+    int    Ns     = 2 * Fs;
+    int    orders[] = { 16 , 32 , 64 , 128 , 256 , 512 , 1024 , 2048 };
+    double sink   = 0;
+    simd_isa isa  = __simd_isa_cpu__();
+
+    // input signal:
+    sgen< float > gen;
+    float *signal = ( float* ) calloc( Ns , sizeof ( float ) );
+    for( int i = 0 ; i < Ns ; i++ ) signal[i] = gen.sine( 1 , Fn , 0 , Fs );
+
+    printf( "best instruction set: %d , selected: %d ( 0 - scalar , 1 - SSE2 , 2 - AVX2 + FMA , 3 - AVX-512 ) \n" , isa , __simd_isa__() );
+    printf( "order \t legacy \t scalar \t SSE2 \t AVX2 \t AVX-512 , ns/sample \t max error \n" );
+    for( int i = 0 ; i < (int)( sizeof ( orders ) / sizeof ( orders[0] ) ) ; i++ )
+    {
+        // FIR coefficients:
+        wind_fcn wind;
+        wind.init( orders[i] + 1 );
+        wind.Chebyshev( 60 );
+        float *cf  = __fir_wind_digital_lp__< float >( Fs , 100 , orders[i] , 1 , wind );
+        float *cfr = ( float* ) calloc( orders[i] + 1 , sizeof ( float ) );
+        for( int k = 0 ; k <= orders[i] ; k++ ) cfr[k] = cf[ orders[i] - k ];
+
+        // delay line:
+        mirror_ring_buffer< float > bx;
+        bx.allocate( orders[i] + 1 );
+
+        // legacy reversed-index convolution:
+        QElapsedTimer timer;
+        float err = 0 , out = 0;
+        timer.start();
+        for( int n = 0 ; n < Ns ; n++ )
+        {
+            bx.fill_buff( &signal[n] );
+            out = 0;
+            for( int k = orders[i] ; k >= 0 ; k-- ) out += bx[ k ] * cf[ k ];
+            sink += out;
+        }
+        double dt_legacy = (double)timer.nsecsElapsed() / (double)Ns;
+        printf( "%d \t %.3f" , orders[i] , dt_legacy );
+
+        // dot product kernels:
+        for( int k = isa_scalar ; k <= isa_avx512 ; k++ )
+        {
+            if( k <= isa ) printf( " \t %.3f" , __bench_fir_kernel__( bx , cfr , orders[i] + 1 , signal , Ns , __dot_kernel__< float >( ( simd_isa )k ) , sink ) );
+            else printf( " \t -" );
+        }
+
+        // the best kernel and legacy convolution difference:
+        for( int n = 0 ; n < Ns ; n++ )
+        {
+            bx.fill_buff( &signal[n] );
+            out = 0;
+            for( int k = orders[i] ; k >= 0 ; k-- ) out += bx[ k ] * cf[ k ];
+            float d = fabs( out - __dot__( bx.view( orders[i] + 1 ).data , cfr , orders[i] + 1 ) );
+            if( d > err ) err = d;
+        }
+        printf( " \t %e \n" , err );
+
+        // memory deallocation:
+        bx.deallocate();
+        free( cf  );
+        free( cfr );
+    }
+
+    printf( "checksum = %f \n" , sink );
+    free( signal );
+
+    return 0;
+}
+
+/*! \brief FIR filtering symmetric coefficients folding benchmark */
+int example12()
+{
+    printf( " ...FIR filtering symmetric coefficients folding benchmark... \n " );
+
+    // emulation parameters:
+    double Fs     = 4000;
+    double Fn     = 50;
+    int    Ns     = 2 * Fs;
+    int    orders[] = { 15 , 16 , 63 , 64 , 255 , 256 , 1023 , 1024 };
+    double sink   = 0;
+
+    // input signal:
+    sgen< float > gen;
+    float *signal = ( float* ) calloc( Ns , sizeof ( float ) );
+    for( int i = 0 ; i < Ns ; i++ ) signal[i] = gen.sine( 1 , Fn , 0 , Fs );
+
+    printf( "order \t type \t direct \t folded , ns/sample \t max error \n" );
+    for( int i = 0 ; i < (int)( sizeof ( orders ) / sizeof ( orders[0] ) ) ; i++ )
+    {
+        // the odd order highpass is antisymmetric ( Type IV ) , the even order highpass is symmetric ( Type I ):
+        fir< float > direct , folded;
+        direct.hp_init( Fs , Fn , 100 , orders[i] , 1 );
+        folded.hp_init( Fs , Fn , 100 , orders[i] , 1 );
+        folded.set_fold( fir_fold_auto );
+        direct.allocate();
+        folded.allocate();
+
+        QElapsedTimer timer;
+        timer.start();
+        for( int n = 0 ; n < Ns ; n++ ) sink += direct( &signal[n] );
+        double t_direct = (double)timer.nsecsElapsed() / (double)Ns;
+
+        timer.start();
+        for( int n = 0 ; n < Ns ; n++ ) sink += folded( &signal[n] );
+        double t_folded = (double)timer.nsecsElapsed() / (double)Ns;
+
+        // the direct and folded filters difference:
+        float err = 0;
+        for( int n = 0 ; n < Ns ; n++ )
+        {
+            float d = fabs( direct( &signal[n] ) - folded( &signal[n] ) );
+            if( d > err ) err = d;
+        }
+        printf( "%d \t %d \t %.3f \t %.3f \t %e \n" , orders[i] , folded.get_fold() , t_direct , t_folded , err );
+    }
+
+    printf( "checksum = %f \n" , sink );
+    free( signal );
+
+    return 0;
+}
+
+/*! \brief FIR filtering overlap-save fast convolution benchmark */
+int example13()
+{
+    printf( " ...FIR filtering overlap-save fast convolution benchmark... \n " );
+
+    // emulation parameters:
+    double Fs     = 4000;
+    double Fn     = 50;
+    int    Ns     = 10 * Fs;
+    int    orders[] = { 128 , 256 , 1000 , 2000 , 4000 , 8000 };
+    double sink   = 0;
+
+    // input signal:
+    sgen< float > gen;
+    float *signal = ( float* ) calloc( Ns , sizeof ( float ) );
+    float *out0   = ( float* ) calloc( Ns , sizeof ( float ) );
+    float *out1   = ( float* ) calloc( Ns , sizeof ( float ) );
+    for( int i = 0 ; i < Ns ; i++ ) signal[i] = gen.sine( 1 , Fn , 0 , Fs ) + gen.sine( 0.1 , 10 * Fn , 0 , Fs );
+
+    printf( "order \t direct \t block , ns/sample \t max error \n" );
+    for( int i = 0 ; i < (int)( sizeof ( orders ) / sizeof ( orders[0] ) ) ; i++ )
+    {
+        fir< float > direct , block;
+        direct.lp_init( Fs , Fn , 100 , orders[i] , 1 );
+        block .lp_init( Fs , Fn , 100 , orders[i] , 1 );
+        direct.allocate();
+        block .allocate();
+        block .prepare_block( Ns );
+
+        QElapsedTimer timer;
+        timer.start();
+        for( int n = 0 ; n < Ns ; n++ ) out0[n] = direct( &signal[n] );
+        double t_direct = (double)timer.nsecsElapsed() / (double)Ns;
+
+        // the whole record is filtered at once , the fast convolution is used if it is cheaper:
+        timer.start();
+        block.process( signal , out1 , Ns );
+        double t_block = (double)timer.nsecsElapsed() / (double)Ns;
+
+        float err = 0;
+        for( int n = 0 ; n < Ns ; n++ )
+        {
+            float d = fabs( out0[n] - out1[n] );
+            if( d > err ) err = d;
+            sink += out1[n];
+        }
+        printf( "%d \t %.3f \t %.3f \t %e \n" , orders[i] , t_direct , t_block , err );
+    }
+
+    printf( "checksum = %f \n" , sink );
+    free( signal );
+    free( out0 );
+    free( out1 );
+
+    return 0;
+}
+
+/*! \brief FIR polyphase decimator benchmark */
+int example14()
+{
+    printf( " ...FIR polyphase decimator benchmark... \n " );
+
+    // emulation parameters ( 16 kHz to 4 kHz decimation ):
+    double Fs     = 16000;
+    double Fn     = 50;
+    int    M      = 4;
+    int    order  = 255;
+    int    Ns     = 4 * Fs;
+    double sink   = 0;
+
+    // input signal:
+    sgen< float > gen;
+    float *signal = ( float* ) calloc( Ns , sizeof ( float ) );
+    float *out0   = ( float* ) calloc( Ns , sizeof ( float ) );
+    float *out1   = ( float* ) calloc( Ns , sizeof ( float ) );
+    for( int i = 0 ; i < Ns ; i++ ) signal[i] = gen.sine( 1 , Fn , 0 , Fs ) + gen.sine( 0.1 , 3000 , 0 , Fs );
+
+    fir< float > full;
+    fir_decimator< float > poly;
+    full.lp_init( Fs , Fn , 1000 , order , 1 );
+    poly.init   ( Fs , Fn , 1000 , order , M , 1 );
+    full.allocate();
+    poly.allocate();
+
+    // full rate filtering , every M-th output is kept:
+    QElapsedTimer timer;
+    timer.start();
+    int k0 = 0;
+    for( int n = 0 ; n < Ns ; n++ )
+    {
+        float y = full( &signal[n] );
+        if( n % M == M - 1 ) out0[k0++] = y;
+    }
+    double t_full = (double)timer.nsecsElapsed() / (double)Ns;
+
+    // polyphase decimation:
+    timer.start();
+    int k1 = poly.process( signal , Ns , out1 );
+    double t_poly = (double)timer.nsecsElapsed() / (double)Ns;
+
+    float err = 0;
+    for( int n = 0 ; n < k1 && n < k0 ; n++ )
+    {
+        float d = fabs( out0[n] - out1[n] );
+        if( d > err ) err = d;
+        sink += out1[n];
+    }
+
+    printf( "order = %d , M = %d \n" , order , M );
+    printf( "full rate FIR , ns/input sample : %.3f \n" , t_full );
+    printf( "polyphase     , ns/input sample : %.3f \n" , t_poly );
+    printf( "max error : %e , outputs : %d / %d \n" , err , k1 , k0 );
+    printf( "checksum = %f \n" , sink );
+
+    free( signal );
+    free( out0 );
+    free( out1 );
+
+    return 0;
+}
+
+/*! \brief FIR polyphase rational resampler benchmark */
+int example15()
+{
+    printf( " ...FIR polyphase rational resampler benchmark... \n " );
+
+    // emulation parameters ( common relay sampling rates ):
+    double rates[3][2] = { { 4000 , 4800 } , { 14400 , 4000 } , { 4800 , 14400 } };
+    double Fn    = 50;
+    int    order = 31;
+    double sink  = 0;
+
+    printf( "Fs \t Fout \t L \t M \t ns/input sample \t max error \n" );
+    for( int i = 0 ; i < 3 ; i++ )
+    {
+        double Fs = rates[i][0] , Fout = rates[i][1];
+        int    Ns = 4 * Fs;
+
+        fir_resampler< float > rs;
+        rs.init( Fs , Fout , 0 , order );
+        rs.allocate();
+
+        // input signal , the sine is computed directly to be compared with the ideal output:
+        float *signal = ( float* ) calloc( Ns , sizeof ( float ) );
+        float *out    = ( float* ) calloc( rs.capacity( Ns ) , sizeof ( float ) );
+        for( int n = 0 ; n < Ns ; n++ ) signal[n] = sin( 6.283185307179586 * Fn * n / Fs );
+
+        QElapsedTimer timer;
+        timer.start();
+        int k = rs.process( signal , Ns , out );
+        double t = (double)timer.nsecsElapsed() / (double)Ns;
+
+        // comparison with the ideal sine at the output rate , the lowpass group delay is compensated:
+        double D   = ( ( order + 1 ) * rs.up() - 1 ) / ( 2 * Fs * rs.up() );
+        float  err = 0;
+        for( int n = k / 4 ; n < k ; n++ )
+        {
+            float d = fabs( out[n] - sin( 6.283185307179586 * Fn * ( n / Fout - D ) ) );
+            if( d > err ) err = d;
+            sink += out[n];
+        }
+        printf( "%.0f \t %.0f \t %d \t %d \t %.3f \t\t %e \n" , Fs , Fout , rs.up() , rs.down() , t , err );
+
+        free( signal );
+        free( out );
+    }
+
+    printf( "checksum = %f \n" , sink );
+
+    return 0;
+}
+
+/*! \brief FIR filter bank benchmark */
+int example16()
+{
+    printf( " ...FIR filter bank benchmark... \n " );
+
+    // emulation parameters ( 24 channels with the same lowpass ):
+    double Fs     = 4000;
+    double Fn     = 50;
+    int    C      = 24;
+    int    orders[4] = { 16 , 80 , 256 , 1024 };
+    int    Ns     = 4000;
+    double sink   = 0;
+
+    // channel-interleaved input signal:
+    float *signal = ( float* ) calloc( Ns * C , sizeof ( float ) );
+    float *out0   = ( float* ) calloc( Ns * C , sizeof ( float ) );
+    float *out1   = ( float* ) calloc( Ns * C , sizeof ( float ) );
+    for( int n = 0 ; n < Ns ; n++ )
+        for( int c = 0 ; c < C ; c++ ) signal[ n * C + c ] = sin( 6.283185307179586 * Fn * n / Fs + c ) + 0.1 * sin( 6.283185307179586 * 1000 * n / Fs );
+
+    printf( "order \t %d x fir , ns/row \t fir_bank , ns/row \t max error \n" , C );
+    for( int i = 0 ; i < 4 ; i++ )
+    {
+        fir< float > *filters = new fir< float >[ C ];
+        fir_bank< float > bank;
+        for( int c = 0 ; c < C ; c++ ) { filters[c].lp_init( Fs , Fn , 100 , orders[i] , 1 ); filters[c].allocate(); }
+        bank.lp_init( Fs , Fn , 100 , orders[i] , C , 1 );
+        bank.allocate();
+
+        // channel by channel filtering:
+        QElapsedTimer timer;
+        timer.start();
+        for( int n = 0 ; n < Ns ; n++ )
+            for( int c = 0 ; c < C ; c++ ) out0[ n * C + c ] = filters[c]( &signal[ n * C + c ] );
+        double t_fir = (double)timer.nsecsElapsed() / (double)Ns;
+
+        // filter bank:
+        timer.start();
+        bank.process( signal , out1 , Ns );
+        double t_bank = (double)timer.nsecsElapsed() / (double)Ns;
+
+        float err = 0;
+        for( int n = 0 ; n < Ns * C ; n++ )
+        {
+            float d = fabs( out0[n] - out1[n] );
+            if( d > err ) err = d;
+            sink += out1[n];
+        }
+        printf( "%d \t %.3f \t\t %.3f \t\t %e \n" , orders[i] , t_fir , t_bank , err );
+
+        delete [] filters;
+    }
+
+    printf( "checksum = %f \n" , sink );
+    free( signal );
+    free( out0 );
+    free( out1 );
+
+    return 0;
+}
+
+/*! \brief fixed point FIR filter benchmark */
+int example17()
+{
+    printf( " ...fixed point FIR filter benchmark... \n " );
+
+    // emulation parameters ( int16 ADC samples , 10 A full scale ):
+    double Fs     = 4000;
+    double Fn     = 50;
+    double FS     = 10;
+    int    orders[3] = { 16 , 80 , 256 };
+    int    Ns     = 4 * Fs;
+    double sink   = 0;
+
+    // input signal:
+    short  *xq15 = ( short*  ) calloc( Ns , sizeof ( short  ) );
+    int    *xq31 = ( int*    ) calloc( Ns , sizeof ( int    ) );
+    float  *xf32 = ( float*  ) calloc( Ns , sizeof ( float  ) );
+    double *xf64 = ( double* ) calloc( Ns , sizeof ( double ) );
+    short  *yq15 = ( short*  ) calloc( Ns , sizeof ( short  ) );
+    int    *yq31 = ( int*    ) calloc( Ns , sizeof ( int    ) );
+    float  *yf32 = ( float*  ) calloc( Ns , sizeof ( float  ) );
+    double *yf64 = ( double* ) calloc( Ns , sizeof ( double ) );
+    for( int n = 0 ; n < Ns ; n++ )
+    {
+        double x = 6 * sin( 6.283185307179586 * Fn * n / Fs ) + 2 * sin( 6.283185307179586 * 5 * Fn * n / Fs );
+        xq15[n] = ( short )lrint( x / FS * 32767 );
+        xq31[n] = ( int )xq15[n] * 65536;
+        xf32[n] = xf64[n] = xq15[n] * FS / 32768.0;
+    }
+
+    printf( "order \t Q15 ns \t Q31 ns \t fx32 ns \t fx64 ns \t Q15 SNR , dB \t Q31 SNR , dB \n" );
+    for( int i = 0 ; i < 3 ; i++ )
+    {
+        fir< short  > fq15;
+        fir< int    > fq31;
+        fir< float  > ff32;
+        fir< double > ff64;
+        fq15.set_scale( FS );
+        fq31.set_scale( FS );
+        fq15.lp_init( Fs , Fn , 100 , orders[i] , 1 );
+        fq31.lp_init( Fs , Fn , 100 , orders[i] , 1 );
+        ff32.lp_init( Fs , Fn , 100 , orders[i] , 1 );
+        ff64.lp_init( Fs , Fn , 100 , orders[i] , 1 );
+        fq15.allocate();
+        fq31.allocate();
+        ff32.allocate();
+        ff64.allocate();
+
+        QElapsedTimer timer;
+        timer.start();
+        for( int n = 0 ; n < Ns ; n++ ) yq15[n] = fq15( &xq15[n] );
+        double t_q15 = (double)timer.nsecsElapsed() / (double)Ns;
+
+        timer.start();
+        for( int n = 0 ; n < Ns ; n++ ) yq31[n] = fq31( &xq31[n] );
+        double t_q31 = (double)timer.nsecsElapsed() / (double)Ns;
+
+        timer.start();
+        for( int n = 0 ; n < Ns ; n++ ) yf32[n] = ff32( &xf32[n] );
+        double t_f32 = (double)timer.nsecsElapsed() / (double)Ns;
+
+        timer.start();
+        for( int n = 0 ; n < Ns ; n++ ) yf64[n] = ff64( &xf64[n] );
+        double t_f64 = (double)timer.nsecsElapsed() / (double)Ns;
+
+        // SNR versus the 64-bit floating point reference:
+        double s = 0 , e15 = 0 , e31 = 0;
+        for( int n = 0 ; n < Ns ; n++ )
+        {
+            double d15 = yq15[n] * FS / 32768.0 - yf64[n];
+            double d31 = yq31[n] * FS / 2147483648.0 - yf64[n];
+            s   += yf64[n] * yf64[n];
+            e15 += d15 * d15;
+            e31 += d31 * d31;
+            sink += yf32[n];
+        }
+        printf( "%d \t %.3f \t %.3f \t %.3f \t %.3f \t %.1f \t\t %.1f \n" , orders[i] , t_q15 , t_q31 , t_f32 , t_f64 ,
+                10 * log10( s / e15 ) , 10 * log10( s / e31 ) );
+    }
+
+    printf( "checksum = %f \n" , sink );
+    free( xq15 );
+    free( xq31 );
+    free( xf32 );
+    free( xf64 );
+    free( yq15 );
+    free( yq31 );
+    free( yf32 );
+    free( yf64 );
+
+    return 0;
+}
+
+/*!
+ * \brief FIR filters design cache benchmark
+ * \details The example measures the construction of the same filters set with the cache cleared before every design ,
+ *          with the cache cleared once and with the warm cache. Build the example with __DESIGN_CACHE 0 to measure
+ *          the designs without the cache at all , all three passes compute every design then.
+*/
+int example18()
+{
+    printf( " ...FIR filters design cache benchmark ( __DESIGN_CACHE = %d )... \n " , __DESIGN_CACHE );
+
+    // emulation parameters ( 400 filters of 8 different designs ):
+    double Fs    = 4000;
+    double Fn    = 50;
+    int    Nf    = 400;
+    double sink  = 0;
+
+    fir< float > *filters = new fir< float >[ Nf ];
+    double t[3];
+    for( int pass = 0 ; pass < 3 ; pass++ )
+    {
+        QElapsedTimer timer;
+        timer.start();
+        for( int i = 0 ; i < Nf ; i++ )
+        {
+            // the first pass never reuses the designs , the second pass starts with the empty cache:
+#if __DESIGN_CACHE
+            if( pass == 0 || ( pass == 1 && i == 0 ) ) { design_cache< float >::instance().clear(); design_cache< double >::instance().clear(); }
+#endif
+            filters[i].deallocate();
+            switch( i % 8 )
+            {
+                case 0: filters[i].lp_init( Fs , Fn , 100 , 80  , 1 ); break;
+                case 1: filters[i].lp_init( Fs , Fn , 100 , 256 , 1 ); break;
+                case 2: filters[i].hp_init( Fs , Fn , 100 , 81  , 1 ); break;
+                case 3: filters[i].bp_init( Fs , Fn , 150 , 50 , 128 , 1 ); break;
+                case 4: filters[i].bs_init( Fs , Fn , 150 , 50 , 128 , 1 ); break;
+                case 5: filters[i].lp_init( Fs , Fn , 300 , 64  , 1 ); filters[i].m_wind.Kaiser( 6 ); break;
+                case 6: filters[i].hp_init( Fs , Fn , 300 , 65  , 1 ); filters[i].m_wind.Kaiser( 6 ); break;
+                case 7: filters[i].lp_init( Fs , Fn , 50  , 512 , 1 ); break;
+            }
+            filters[i].allocate();
+        }
+        t[pass] = (double)timer.nsecsElapsed() / 1e6;
+        for( int i = 0 ; i < Nf ; i++ ) sink += filters[i].get_coeff( 10 );
+    }
+
+    printf( "filters number : %d \n" , Nf );
+    printf( "no design reuse    construction , ms : %.3f \n" , t[0] );
+    printf( "empty cache        construction , ms : %.3f \n" , t[1] );
+    printf( "warm  cache        construction , ms : %.3f \n" , t[2] );
+#if __DESIGN_CACHE
+    printf( "cached arrays : %d ( at most %d of every type ) \n" , design_cache< float >::instance().size() + design_cache< double >::instance().size() , __DESIGN_CACHE_SIZE );
+#endif
+    printf( "checksum = %f \n" , sink );
+
+    delete [] filters;
+
+    return 0;
+}
+
+/*!
+ * \brief compile-time FIR filter benchmark run
+ * \details the function compares the runtime and the compile-time designs of the same lowpass filter
+*/
+template< typename SF > int __example19_run__( int order , const float *x , float *y0 , float *y1 , int Ns )
+{
+    // runtime design ( Hamming window , the same one as the static filter default ):
+    QElapsedTimer timer;
+    timer.start();
+    fir< float > f;
+    f.lp_init( 4000 , 50 , 100 , order , 1 );
+    f.m_wind.Hamming();
+    f.allocate();
+    double t_init = (double)timer.nsecsElapsed() / 1e3;
+
+    SF sf;
+
+    timer.start();
+    for( int n = 0 ; n < Ns ; n++ ) y0[n] = f( ( float* )&x[n] );
+    double t_rt = (double)timer.nsecsElapsed() / (double)Ns;
+
+    timer.start();
+    for( int n = 0 ; n < Ns ; n++ ) y1[n] = sf( &x[n] );
+    double t_ct = (double)timer.nsecsElapsed() / (double)Ns;
+
+    double err = 0;
+    for( int n = 0 ; n < Ns ; n++ ) err = ( fabs( y0[n] - y1[n] ) > err ) ? fabs( y0[n] - y1[n] ) : err;
+    printf( "%d \t %.3f \t\t %.3f \t %.3f \t %e \n" , order , t_init , t_rt , t_ct , err );
+    return 0;
+}
+
+/*! \brief compile-time FIR filter benchmark */
+int example19()
+{
+    printf( " ...compile-time FIR filter benchmark... \n " );
+
+    // emulation parameters:
+    double Fs = 4000;
+    double Fn = 50;
+    int    Ns = 100 * Fs;
+
+    float *x  = ( float* ) calloc( Ns , sizeof ( float ) );
+    float *y0 = ( float* ) calloc( Ns , sizeof ( float ) );
+    float *y1 = ( float* ) calloc( Ns , sizeof ( float ) );
+    for( int n = 0 ; n < Ns ; n++ ) x[n] = 6 * sin( 6.283185307179586 * Fn * n / Fs ) + 2 * sin( 6.283185307179586 * 5 * Fn * n / Fs );
+
+    printf( "order \t design , us \t runtime ns \t static ns \t max error \n" );
+    __example19_run__< static_fir< float , 16 , 4000000 , 100000 > >( 16 , x , y0 , y1 , Ns );
+    __example19_run__< static_fir< float , 32 , 4000000 , 100000 > >( 32 , x , y0 , y1 , Ns );
+    __example19_run__< static_fir< float , 48 , 4000000 , 100000 > >( 48 , x , y0 , y1 , Ns );
+
+    free( x );
+    free( y0 );
+    free( y1 );
+
+    return 0;
+}
+
+/*! \brief FIR filter dense frequency response benchmark */
+int example20()
+{
+    printf( " ...FIR filter dense frequency response benchmark... \n " );
+
+    // emulation parameters ( Fs / 2 sweep of 100 filters ):
+    double Fs      = 4000;
+    double Fn      = 50;
+    int    Nf      = 100;
+    int    npoints = 1025;
+    int    orders[3] = { 32 , 80 , 256 };
+    double sink    = 0;
+
+    printf( "order \t freq_resp , ms \t freq_resp_grid , ms \t max error \n" );
+    for( int i = 0 ; i < 3 ; i++ )
+    {
+        fir< float > flt;
+        flt.lp_init( Fs , Fn , 100 , orders[i] , 1 );
+        flt.allocate();
+
+        // point by point sweep:
+        fir_fr_grid fr;
+        double *Km = ( double* ) calloc( npoints , sizeof ( double ) );
+        QElapsedTimer timer;
+        timer.start();
+        for( int f = 0 ; f < Nf ; f++ )
+        {
+            for( int k = 0 ; k < npoints ; k++ ) Km[k] = flt.freq_resp( k * Fs / 2 / ( npoints - 1 ) ).Km;
+            sink += Km[ f ];
+        }
+        double t_pt = (double)timer.nsecsElapsed() / 1e6;
+
+        // one FFT per filter:
+        timer.start();
+        for( int f = 0 ; f < Nf ; f++ )
+        {
+            flt.freq_resp_grid( fr , npoints );
+            sink += fr.Km[ f ];
+        }
+        double t_grid = (double)timer.nsecsElapsed() / 1e6;
+
+        double err = 0;
+        for( int k = 0 ; k < fr.n ; k++ ) err = ( fabs( fr.Km[k] - Km[k] ) > err ) ? fabs( fr.Km[k] - Km[k] ) : err;
+        printf( "%d \t %.3f \t\t %.3f \t\t\t %e \n" , orders[i] , t_pt , t_grid , err );
+        free( Km );
+    }
+
+    printf( "checksum = %f \n" , sink );
+
+    return 0;
+}
+
+/*! \brief FIR filter in-place retuning benchmark */
+int example21()
+{
+    printf( " ...FIR filter in-place retuning benchmark... \n " );
+
+    // emulation parameters ( 80-th order lowpass retuned from 100 Hz to 150 Hz ):
+    double Fs    = 4000;
+    double Fn    = 50;
+    int    order = 80;
+    int    Ns    = 2000;
+    int    sw    = 1000;
+    int    K[2]  = { 0 , 64 };
+
+    float *x = ( float* ) calloc( Ns , sizeof ( float ) );
+    float *y = ( float* ) calloc( Ns , sizeof ( float ) );
+    for( int n = 0 ; n < Ns ; n++ ) x[n] = 6 * sin( 6.283185307179586 * Fn * n / Fs ) + 2 * sin( 6.283185307179586 * 5 * Fn * n / Fs );
+
+    printf( "method \t\t filtering thread , us \t max | d2y | before \t max | d2y | after \n" );
+    for( int m = 0 ; m < 3 ; m++ )
+    {
+        fir< float > flt;
+        flt.lp_init( Fs , Fn , 100 , order , 1 );
+        flt.allocate();
+        for( int n = 0 ; n < sw ; n++ ) y[n] = flt( &x[n] );
+
+        // the reinitialization is done in the filtering thread , the retuning design is done in the control thread:
+        double t_rt = 0;
+        QElapsedTimer timer;
+        if( m == 0 )
+        {
+            timer.start();
+            flt.deallocate();
+            flt.lp_init( Fs , Fn , 150 , order , 1 );
+            flt.allocate();
+            y[sw] = flt( &x[sw] );
+            t_rt = (double)timer.nsecsElapsed() / 1e3;
+        }
+        else
+        {
+            fir_sp sp = flt.get_sp();
+            sp.Fc = 150;
+            flt.retune( sp , K[ m - 1 ] );
+            timer.start();
+            y[sw] = flt( &x[sw] );
+            t_rt = (double)timer.nsecsElapsed() / 1e3;
+        }
+        for( int n = sw + 1 ; n < Ns ; n++ ) y[n] = flt( &x[n] );
+
+        // the output discontinuity is measured by means of the second difference before and after the switch:
+        double d2[2] = { 0 , 0 };
+        for( int n = sw - 200 ; n < sw + 200 ; n++ )
+        {
+            double d = fabs( y[n] - 2 * y[n-1] + y[n-2] );
+            d2[ n >= sw ] = ( d > d2[ n >= sw ] ) ? d : d2[ n >= sw ];
+        }
+        if( m == 0 ) printf( "reinit \t\t %.3f \t\t\t %.4f \t\t %.4f \n" , t_rt , d2[0] , d2[1] );
+        else         printf( "retune K = %d \t %.3f \t\t\t %.4f \t\t %.4f \n" , K[ m - 1 ] , t_rt , d2[0] , d2[1] );
+    }
+
+    free( x );
+    free( y );
+
+    return 0;
+}
+
+/*! \brief minimum phase FIR filter latency benchmark */
+int example22()
+{
+    printf( " ...minimum phase FIR filter latency benchmark... \n " );
+
+    // emulation parameters ( 94-th order lowpass , 95 taps ):
+    double Fs      = 4000;
+    double Fn      = 50;
+    int    order   = 94;
+    int    npoints = 1025;
+    int    Ns      = 200;
+
+    fir< float > flt[2];
+    fir_fr_grid  fr[2];
+    int          t50[2] = { 0 , 0 };
+    for( int i = 0 ; i < 2 ; i++ )
+    {
+        flt[i].lp_init( Fs , Fn , 100 , order , 1 );
+        flt[i].set_phase( ( i == 0 ) ? fir_linear_phase : fir_minimum_phase );
+        flt[i].allocate();
+        flt[i].freq_resp_grid( fr[i] , npoints );
+
+        // the step response 50 % settling time:
+        float one = 1;
+        for( int n = 0 ; n < Ns ; n++ ) if( flt[i]( &one ) < 0.5 ) t50[i] = n + 1;
+    }
+
+    // the amplitude responses difference:
+    double err = 0;
+    for( int k = 0 ; k < fr[0].n ; k++ ) err = ( fabs( fr[1].Km[k] - fr[0].Km[k] ) > err ) ? fabs( fr[1].Km[k] - fr[0].Km[k] ) : err;
+
+    printf( "phase \t\t group delay at Fn , ms \t step 50 %% , ms \n" );
+    printf( "linear \t\t %.3f \t\t\t %.3f \n" , flt[0].group_delay( Fn ) * 1e3 , t50[0] * 1e3 / Fs );
+    printf( "minimum \t %.3f \t\t\t %.3f \n" , flt[1].group_delay( Fn ) * 1e3 , t50[1] * 1e3 / Fs );
+    printf( "max amplitude response difference = %e \n" , err );
+
+    return 0;
+}
+
+/*! \brief half-band decimation chain benchmark */
+int example23()
+{
+    printf( " ...half-band decimation chain benchmark... \n " );
+
+    // emulation parameters ( 16 kHz -> 8 kHz -> 4 kHz ):
+    double Fs    = 16000;
+    double Fn    = 50;
+    int    order = 62;
+    int    Ns    = 100 * Fs;
+
+    float *x  = ( float* ) calloc( Ns , sizeof ( float ) );
+    float *y0 = ( float* ) calloc( Ns , sizeof ( float ) );
+    float *y1 = ( float* ) calloc( Ns , sizeof ( float ) );
+    for( int n = 0 ; n < Ns ; n++ ) x[n] = 6 * sin( 6.283185307179586 * Fn * n / Fs ) + 2 * sin( 6.283185307179586 * 5 * Fn * n / Fs );
+
+    // the same half-band lowpasses computed by means of the polyphase decimators:
+    fir_decimator< float > dec1 , dec2;
+    dec1.init( Fs     , Fn , Fs / 4 , order , 2 , 1 );
+    dec2.init( Fs / 2 , Fn , Fs / 8 , order , 2 , 1 );
+    dec1.allocate();
+    dec2.allocate();
+
+    halfband_chain< float > hb;
+    hb.init( Fs , Fn , 2 , order );
+    hb.allocate();
+
+    QElapsedTimer timer;
+    timer.start();
+    int k0 = 0;
+    for( int n = 0 ; n < Ns ; n++ ) if( dec1( &x[n] ) && dec2( &dec1.m_out ) ) y0[k0++] = dec2.m_out;
+    double t_dec = (double)timer.nsecsElapsed() / Ns;
+
+    timer.start();
+    int k1 = hb.process( x , Ns , y1 );
+    double t_hb = (double)timer.nsecsElapsed() / Ns;
+
+    float err = 0;
+    for( int k = 0 ; k < k0 && k < k1 ; k++ ) err = ( fabs( y0[k] - y1[k] ) > err ) ? fabs( y0[k] - y1[k] ) : err;
+
+    printf( "chain \t\t\t ns per input sample \t outputs \n" );
+    printf( "fir_decimator x 2 \t %.3f \t\t\t %d \n" , t_dec , k0 );
+    printf( "halfband_chain \t\t %.3f \t\t\t %d \n" , t_hb , k1 );
+    printf( "max error = %e \n" , err );
+
+    free( x );
+    free( y0 );
+    free( y1 );
+
+    return 0;
+}
+
+/*! \brief CIC decimator front-end benchmark */
+int example24()
+{
+    printf( " ...CIC decimator front-end benchmark... \n " );
+
+    // emulation parameters ( 1 MHz 16-bit input -> 8 kHz CIC output -> 4 kHz compensated output ):
+    double Fs = 1e6;
+    double Fn = 50;
+    int    Ns = 2 * Fs;
+
+    short  *x  = ( short*  ) calloc( Ns , sizeof ( short  ) );
+    float  *xf = ( float*  ) calloc( Ns , sizeof ( float  ) );
+    double *y0 = ( double* ) calloc( Ns , sizeof ( double ) );
+    float  *y1 = ( float*  ) calloc( Ns , sizeof ( float  ) );
+    for( int n = 0 ; n < Ns ; n++ ) xf[n] = x[n] = 20000 * sin( 6.283185307179586 * Fn * n / Fs ) + 5000 * sin( 6.283185307179586 * 5 * Fn * n / Fs );
+
+    cic_decimator< short > cic;
+    cic.init( Fs , Fn , 125 , 5 );
+    cic.comp_init( 1000 , 40 , 2 );
+    cic.allocate();
+
+    // the single stage polyphase decimator with the comparable transition band:
+    fir_decimator< float > dec;
+    dec.init( Fs , Fn , 1000 , 1999 , 250 , 1 );
+    dec.allocate();
+
+    QElapsedTimer timer;
+    timer.start();
+    int k0 = cic.process( x , Ns , y0 );
+    double t_cic = (double)timer.nsecsElapsed() / Ns;
+
+    timer.start();
+    int k1 = dec.process( xf , Ns , y1 );
+    double t_dec = (double)timer.nsecsElapsed() / Ns;
+
+    printf( "decimator \t\t ns per input sample \t outputs \n" );
+    printf( "cic_decimator \t\t %.3f \t\t\t %d \n" , t_cic , k0 );
+    printf( "fir_decimator \t\t %.3f \t\t\t %d \n" , t_dec , k1 );
+
+    // the passband droop with and without the compensation:
+    cic_decimator< short > raw;
+    raw.init( Fs , Fn , 125 , 5 );
+    raw.allocate();
+    printf( "F , Hz \t\t CIC Km \t compensated Km \n" );
+    for( int i = 1 ; i <= 20 ; i *= 2 ) printf( "%.0f \t\t %.5f \t %.5f \n" , i * Fn , raw.freq_resp( i * Fn ).Km , cic.freq_resp( i * Fn ).Km );
+
+    free( x );
+    free( xf );
+    free( y0 );
+    free( y1 );
+
+    return 0;
+}
+
+/*! \brief real-time quadrature demodulator , recursive mean and rms warm restart check */
+int example25()
+{
+    printf( " ...real-time filters warm restart check... \n " );
+
+    // emulation parameters ( 5 ms cycles , the state is saved after 100 cycles ):
+    double Fs     = 4000;
+    double Fn     = 50;
+    int    cycle  = 5;
+    int    Nc     = Fs / 1000 * cycle;
+    int    Nsave  = 100;
+    int    Ncheck = 100;
+
+    double *x = ( double* ) calloc( Nc * ( Nsave + Ncheck ) , sizeof ( double ) );
+    for( int n = 0 ; n < Nc * ( Nsave + Ncheck ) ; n++ ) x[n] = 100 * sin( 6.283185307179586 * 50.3 * n / Fs ) + 20 * sin( 6.283185307179586 * 150.9 * n / Fs );
+
+    quad_mltpx_rt< double > qm[2];
+    recursive_mean< double > rm[2];
+    recursive_rms < double > rr[2];
+    qm[0].init( Fs , Fn , cycle );
+    rm[0].init( Fs , Fn , Fs / Fn );
+    rr[0].init( Fs , Fn , Fs / Fn );
+    qm[0].allocate();
+    rm[0].allocate();
+    rr[0].allocate();
+
+    // warm up and save the states:
+    for( int k = 0 ; k < Nsave ; k++ )
+    {
+        qm[0]( &x[ k * Nc ] , 0 , true );
+        for( int n = 0 ; n < Nc ; n++ ) { rm[0]( &x[ k * Nc + n ] ); rr[0]( &x[ k * Nc + n ] ); }
+    }
+
+    int   size[3] = { qm[0].save_state( 0 ) , rm[0].save_state( 0 ) , rr[0].save_state( 0 ) };
+    char *blob[3];
+    for( int i = 0 ; i < 3 ; i++ ) blob[i] = ( char* ) calloc( size[i] , 1 );
+    qm[0].save_state( blob[0] );
+    rm[0].save_state( blob[1] );
+    rr[0].save_state( blob[2] );
+
+    // restore into the fresh instances:
+    int restored = ( qm[1].load_state( blob[0] , size[0] ) == size[0] ) &&
+                   ( rm[1].load_state( blob[1] , size[1] ) == size[1] ) &&
+                   ( rr[1].load_state( blob[2] , size[2] ) == size[2] );
+
+    // continue both instances and compare the outputs bit by bit:
+    int mismatch[3] = { 0 , 0 , 0 };
+    for( int k = Nsave ; k < Nsave + Ncheck ; k++ )
+    {
+        qm[0]( &x[ k * Nc ] , 0 , true );
+        qm[1]( &x[ k * Nc ] , 0 , true );
+        if( memcmp( qm[0].m_Re , qm[1].m_Re , Nc * sizeof ( double ) ) || memcmp( qm[0].m_Im , qm[1].m_Im , Nc * sizeof ( double ) ) ||
+            memcmp( &qm[0].m_F , &qm[1].m_F , sizeof ( double ) ) ) mismatch[0]++;
+
+        for( int n = 0 ; n < Nc ; n++ )
+        {
+            rm[0]( &x[ k * Nc + n ] ); rm[1]( &x[ k * Nc + n ] );
+            rr[0]( &x[ k * Nc + n ] ); rr[1]( &x[ k * Nc + n ] );
+            if( memcmp( &rm[0].m_out , &rm[1].m_out , sizeof ( double ) ) ) mismatch[1]++;
+            if( memcmp( &rr[0].m_out , &rr[1].m_out , sizeof ( double ) ) ) mismatch[2]++;
+        }
+    }
+
+    printf( "restored = %d \n" , restored );
+    printf( "filter \t\t\t state , bytes \t mismatches \n" );
+    printf( "quad_mltpx_rt \t\t %d \t\t %d \n" , size[0] , mismatch[0] );
+    printf( "recursive_mean \t\t %d \t\t %d \n" , size[1] , mismatch[1] );
+    printf( "recursive_rms \t\t %d \t\t %d \n" , size[2] , mismatch[2] );
+    printf( "F = %.6f Hz \n" , qm[1].m_F );
+
+    for( int i = 0 ; i < 3 ; i++ ) free( blob[i] );
+    free( x );
+
+    return 0;
+}
+
+/*! \brief quadrature demodulators inter channel skew compensation check */
+int example26()
+{
+    printf( " ...inter channel skew compensation check... \n " );
+
+    // emulation parameters ( the channel B is sampled 0.37 samples later than the channel A ):
+    double Fs    = 4000;
+    double Fn    = 50;
+    int    cycle = 5;
+    int    Nc    = Fs / 1000 * cycle;
+    int    Ncyc  = 400;
+    double d     = 0.37 / Fs;
+    double F[]   = { 45 , 50 , 55 };
+
+    double *xa = ( double* ) calloc( Nc , sizeof ( double ) );
+    double *xb = ( double* ) calloc( Nc , sizeof ( double ) );
+
+    printf( "F , Hz \t demodulator \t phase error , deg: none \t rotation \t sample domain \n" );
+    for( int i = 0 ; i < 3 ; i++ )
+    {
+        // channel A , channel B without compensation , with the output phasor rotation and with the sample domain alignment:
+        quad_mltpx   < double > qm[4];
+        quad_mltpx_rt< double > rt[4];
+        for( int k = 0 ; k < 4 ; k++ )
+        {
+            qm[k].init( Fs , Fn , 60 , 95 , cycle );
+            rt[k].init( Fs , Fn , cycle );
+            qm[k].allocate();
+            rt[k].allocate();
+        }
+        qm[3].set_skew( d );
+        rt[3].set_skew( d );
+
+        // the maximum phase error over the last 100 cycles:
+        double err[2][3] = { { 0 , 0 , 0 } , { 0 , 0 , 0 } };
+        for( int c = 0 ; c < Ncyc ; c++ )
+        {
+            for( int n = 0 ; n < Nc ; n++ )
+            {
+                double t = ( double )( c * Nc + n ) / Fs;
+                xa[n] = 100 * sin( 6.283185307179586 * F[i] * t );
+                xb[n] = 100 * sin( 6.283185307179586 * F[i] * ( t + d ) );
+            }
+
+            qm[0]( xa , 0 );
+            qm[1]( xb , 0 );
+            qm[2]( xb , d );
+            qm[3]( xb , 0 );
+            rt[0]( xa , 0 , true );
+            rt[1]( xb , 0 , true );
+            rt[2]( xb , d , true );
+            rt[3]( xb , 0 , true );
+            if( c < Ncyc - 100 ) continue;
+
+            double pa[2] = { atan2( qm[0].m_Im , qm[0].m_Re ) , atan2( rt[0].m_Im[Nc-1] , rt[0].m_Re[Nc-1] ) };
+            for( int k = 1 ; k < 4 ; k++ )
+            {
+                double pb[2] = { atan2( qm[k].m_Im , qm[k].m_Re ) , atan2( rt[k].m_Im[Nc-1] , rt[k].m_Re[Nc-1] ) };
+                for( int m = 0 ; m < 2 ; m++ )
+                {
+                    double e = fabs( remainder( pb[m] - pa[m] , 6.283185307179586 ) ) * 180 / 3.141592653589793;
+                    err[m][k-1] = ( e > err[m][k-1] ) ? e : err[m][k-1];
+                }
+            }
+        }
+
+        printf( "%.0f \t quad_mltpx \t %.5f \t\t\t %.5f \t %.5f \n" , F[i] , err[0][0] , err[0][1] , err[0][2] );
+        printf( "%.0f \t quad_mltpx_rt \t %.5f \t\t\t %.5f \t %.5f \n" , F[i] , err[1][0] , err[1][1] , err[1][2] );
+    }
+
+    printf( "negative delay rejected = %d , NaN delay rejected = %d \n" , quad_mltpx< double >().set_skew( -d ) == 0 , quad_mltpx_rt< double >().set_skew( NAN ) == 0 );
+
+    free( xa );
+    free( xb );
+
+    return 0;
+}
+
+/*! \brief lock-free single producer / single consumer ring buffer utilization example */
+int example27()
+{
+    printf( " ...lock-free SPSC ring buffer acquisition / processing threads example... \n " );
+
+    // emulation parameters ( 20 samples ADC frames , 10 s of the 4 kHz input , 256 samples FIFO ):
+    double Fs    = 4000;
+    double Fn    = 50;
+    int    frame = 20;
+    int    Ns    = 10 * Fs;
+
+    float *x  = ( float* ) calloc( Ns , sizeof ( float ) );
+    float *y0 = ( float* ) calloc( Ns , sizeof ( float ) );
+    float *y1 = ( float* ) calloc( Ns , sizeof ( float ) );
+    for( int n = 0 ; n < Ns ; n++ ) x[n] = 6 * sin( 6.283185307179586 * Fn * n / Fs ) + 2 * sin( 6.283185307179586 * 5 * Fn * n / Fs );
+
+    // single thread reference:
+    fir< float > ref;
+    ref.lp_init( Fs , Fn , 100 , 80 , 1 );
+    ref.allocate();
+    for( int n = 0 ; n < Ns ; n++ ) y0[n] = ref( &x[n] );
+
+    spsc_ring_buffer< float > fifo;
+    fifo.allocate( 256 );
+
+    fir< float > flt;
+    flt.lp_init( Fs , Fn , 100 , 80 , 1 );
+    flt.allocate();
+
+    // the acquisition thread pushes the frames , the processing thread pops and filters them ( a waiting thread yields the core ):
+    long long full = 0 , empty = 0;
+    QElapsedTimer timer;
+    timer.start();
+    std::thread producer( [ & ]()
+    {
+        for( int n = 0 ; n < Ns ; n += frame ) while( !fifo.push( &x[n] , frame ) ) { full++; std::this_thread::yield(); }
+    } );
+    std::thread consumer( [ & ]()
+    {
+        float buff[ 20 ];
+        for( int n = 0 ; n < Ns ; n += frame )
+        {
+            while( !fifo.pop( buff , frame ) ) { empty++; std::this_thread::yield(); }
+            for( int k = 0 ; k < frame ; k++ ) y1[ n + k ] = flt( &buff[k] );
+        }
+    } );
+    producer.join();
+    consumer.join();
+    double t = (double)timer.nsecsElapsed() / Ns;
+
+    int mismatch = 0;
+    for( int n = 0 ; n < Ns ; n++ ) mismatch += ( y0[n] != y1[n] );
+
+    printf( "samples : %d , fifo size : %d \n" , Ns , fifo.getBuffSize() );
+    printf( "ns per sample ( both threads ) : %.3f \n" , t );
+    printf( "producer full retries : %lld , consumer empty polls : %lld \n" , full , empty );
+    printf( "output mismatches against the single thread filter : %d \n" , mismatch );
+
+    free( x );
+    free( y0 );
+    free( y1 );
+
+    return 0;
+}
+
+/*! \brief mirror ring buffer multi-tap gathering and sparse FIR filter example */
+int example28()
+{
+    printf( " ...multi-tap gathering and sparse FIR filter example... \n " );
+
+    // the runtime and the compile-time taps lists read the same samples as the [] operator:
+    mirror_ring_buffer< double > buff;
+    buff.allocate( 100 );
+    for( int n = 0 ; n < 150 ; n++ ) { double x = n; buff( &x ); }
+
+    int    taps[] = { 0 , 3 , 7 , 99 };
+    double g0[4] , g1[4];
+    buff.gather( taps , g0 , 4 );
+    buff.gather< 0 , 3 , 7 , 99 >( g1 );
+    int mismatch = 0;
+    for( int i = 0 ; i < 4 ; i++ ) mismatch += ( g0[i] != buff[ taps[i] ] ) + ( g1[i] != g0[i] ) + ( g0[i] != 149 - taps[i] );
+    printf( "gathered taps : %.0f %.0f %.0f %.0f , mismatches : %d \n" , g0[0] , g0[1] , g0[2] , g0[3] , mismatch );
+
+    // emulation parameters ( 4 kHz input , 10 s ):
+    double Fs = 4000;
+    double Fn = 50;
+    int    Ns = 10 * Fs;
+
+    double *x = ( double* ) calloc( Ns , sizeof ( double ) );
+    for( int n = 0 ; n < Ns ; n++ ) x[n] = 6 * sin( 6.283185307179586 * Fn * n / Fs ) + 2 * sin( 6.283185307179586 * 3.3 * Fn * n / Fs ) + 1;
+
+    // two taps sparse FIR filter reproduces the half of the comb filter output:
+    fcomb< double > comb;
+    comb.init( Fs , Fn );
+    comb.allocate();
+    sparse_fir< double > half_comb;
+    int    ctaps[] = { 0 , 40 };
+    double ccf  [] = { 0.5 , -0.5 };
+    half_comb.init( ctaps , ccf , 2 );
+
+    double err = 0;
+    for( int n = 0 ; n < Ns ; n++ )
+    {
+        comb( &x[n] );
+        double e = fabs( half_comb( &x[n] ) - 0.5 * comb.m_out );
+        err = ( e > err ) ? e : err;
+    }
+    printf( "sparse_fir { 0 , 40 } against 0.5 * fcomb max error = %e \n" , err );
+
+    // three taps 1 s long smoother: the sparse filter against the dense dot product over the whole delay line:
+    int    D         = Fs;
+    int    staps[]   = { 0 , D / 2 , D };
+    double scf  []   = { 0.25 , 0.5 , 0.25 };
+    sparse_fir< double > sparse;
+    sparse.init( staps , scf , 3 );
+
+    double *h = ( double* ) calloc( D + 1 , sizeof ( double ) );
+    for( int i = 0 ; i < 3 ; i++ ) h[ staps[i] ] = scf[i];
+    mirror_ring_buffer< double > line;
+    line.allocate( D + 1 );
+
+    double *y0 = ( double* ) calloc( Ns , sizeof ( double ) );
+    double *y1 = ( double* ) calloc( Ns , sizeof ( double ) );
+
+    QElapsedTimer timer;
+    timer.start();
+    for( int n = 0 ; n < Ns ; n++ )
+    {
+        line( &x[n] );
+        double y = 0;
+        for( int k = 0 ; k <= D ; k++ ) y += h[k] * line[k];
+        y0[n] = y;
+    }
+    double t_dense = (double)timer.nsecsElapsed() / Ns;
+
+    timer.start();
+    for( int n = 0 ; n < Ns ; n++ ) y1[n] = sparse( &x[n] );
+    double t_sparse = (double)timer.nsecsElapsed() / Ns;
+
+    err = 0;
+    for( int n = 0 ; n < Ns ; n++ ) err = ( fabs( y1[n] - y0[n] ) > err ) ? fabs( y1[n] - y0[n] ) : err;
+
+    printf( "filter \t\t\t ns per sample \n" );
+    printf( "dense , %d taps \t %.3f \n" , D + 1 , t_dense );
+    printf( "sparse_fir , 3 taps \t %.3f \n" , t_sparse );
+    printf( "max error = %e , Km( Fn ) = %.5f \n" , err , sparse.freq_resp( Fs , Fn ).Km );
+
+    free( x );
+    free( h );
+    free( y0 );
+    free( y1 );
+
+    return 0;
+}
+
+/*! \brief multichannel mirror ring buffer example */
+int example29()
+{
+    printf( " ...multichannel mirror ring buffer example... \n " );
+
+    // emulation parameters ( 24 channels bay , 4 kHz input , 10 s , one period moving average ):
+    const int C  = 24;
+    double    Fs = 4000;
+    double    Fn = 50;
+    int       Ns = 10 * Fs;
+    int       N  = Fs / Fn;
+
+    // channel-interleaved input signal:
+    float *frames = ( float* ) calloc( Ns * C , sizeof ( float ) );
+    for( int n = 0 ; n < Ns ; n++ )
+        for( int c = 0 ; c < C ; c++ ) frames[ n * C + c ] = sin( 6.283185307179586 * Fn * n / Fs + c ) + 0.01 * c;
+
+    // moving average coefficients:
+    float *h = ( float* ) calloc( N , sizeof ( float ) );
+    for( int i = 0 ; i < N ; i++ ) h[i] = 1.0 / N;
+
+    // one buffer per channel against a single buffer of the whole bay ( compile-time and runtime channels number ):
+    mirror_ring_buffer< float > *chan = new mirror_ring_buffer< float >[ C ];
+    for( int c = 0 ; c < C ; c++ ) chan[c].allocate( N );
+    multichannel_ring_buffer< float , C > bay;
+    multichannel_ring_buffer< float > bay_rt;
+    bay.allocate( N );
+    bay_rt.allocate( N , C );
+    printf( "channels = %d , row stride = %d samples , rows aligned : %d \n" ,
+            bay.getChannels() , bay.getStride() , ( ( size_t )bay[0] % __SIMD_ALIGNMENT == 0 ) && ( ( size_t )bay[1] % __SIMD_ALIGNMENT == 0 ) );
+
+    float *y0 = ( float* ) calloc( Ns * C , sizeof ( float ) );
+    float *y1 = ( float* ) calloc( Ns * C , sizeof ( float ) );
+    float *yr = ( float* ) calloc( bay.getStride() , sizeof ( float ) );
+
+    QElapsedTimer timer;
+    timer.start();
+    for( int n = 0 ; n < Ns ; n++ )
+    {
+        for( int c = 0 ; c < C ; c++ )
+        {
+            chan[c]( &frames[ n * C + c ] );
+            y0[ n * C + c ] = __dot__( chan[c].view( N ).data , h , N );
+        }
+    }
+    double t_chan = (double)timer.nsecsElapsed() / Ns;
+
+    // the padding lanes of the rows are zero , so the whole stride is filtered at once:
+    timer.start();
+    for( int n = 0 ; n < Ns ; n++ )
+    {
+        bay( &frames[ n * C ] );
+        __bank_dot__( bay.view( N ).data , h , N , bay.getStride() , yr );
+        memcpy( &y1[ n * C ] , yr , C * sizeof ( float ) );
+    }
+    double t_bay = (double)timer.nsecsElapsed() / Ns;
+
+    // block filling and the [] operator read the same history:
+    bay_rt.fill_block( frames , Ns );
+    int mismatch = 0;
+    for( int k = 0 ; k < N ; k++ )
+        for( int c = 0 ; c < C ; c++ ) mismatch += ( bay_rt[k][c] != bay[k][c] ) + ( bay[k][c] != chan[c][k] );
+
+    float err = 0;
+    for( int n = 0 ; n < Ns * C ; n++ ) err = ( fabs( y1[n] - y0[n] ) > err ) ? fabs( y1[n] - y0[n] ) : err;
+
+    printf( "buffers \t\t\t ns per frame \n" );
+    printf( "%d x mirror_ring_buffer \t %.3f \n" , C , t_chan );
+    printf( "multichannel_ring_buffer \t %.3f \n" , t_bay );
+    printf( "history mismatches = %d , max error = %e \n" , mismatch , err );
+
+    delete [] chan;
+    free( frames );
+    free( h );
+    free( y0 );
+    free( y1 );
+    free( yr );
+
+    return 0;
+}
+
 #endif // EXAMPLES_H
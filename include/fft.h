@@ -0,0 +1,271 @@
+/*!
+ * \file
+ * \brief   Fast Fourier transform
+ * \authors A.Tykvinskiy
+ * \date    21.12.2021
+ * \version 1.0
+ *
+ * The header declares real-input radix-2 fast Fourier transform template class
+*/
+
+#ifndef FFT_H
+#define FFT_H
+
+#ifndef __ALG_PLATFORM
+#include "cmath"
+#include "cstdlib"
+#endif
+
+/*! \defgroup <FFT> ( Fast Fourier transform )
+ *  \brief the module contains real-input fast Fourier transform template class
+    @{
+*/
+
+#include "complex.h"
+
+/*! \brief defines 32-bit floating point type */
+#ifndef __fx32
+#define __fx32 float
+#endif
+
+/*! \brief defines 64-bit floating point type */
+#ifndef __fx64
+#define __fx64 double
+#endif
+
+/*! \brief defines 32-bit integer type */
+#ifndef __ix32
+#define __ix32 int
+#endif
+
+/*! \brief defines 2*pi */
+#ifndef PI2
+#define PI2 6.283185307179586476925286766559
+#endif
+
+/*!
+ * \brief real-input radix-2 fast Fourier transform template class
+ * \details The N-point real transform is computed by means of the N/2-point complex transform of the packed
+ *          input z[ k ] = x[ 2 * k ] + j * x[ 2 * k + 1 ] and the split of the even and odd samples spectra:
+ *          \f[
+ *              X_k = E_k + e^{ -j \frac{ 2 \pi k }{ N } } O_k , \quad
+ *              E_k = \frac{ Z_k + Z^*_{ N/2 - k } }{ 2 } , \quad
+ *              O_k = \frac{ Z_k - Z^*_{ N/2 - k } }{ 2 j }
+ *          \f]
+ *          Only the N / 2 + 1 non-negative frequency bins are stored.
+*/
+template< typename T > class rfft
+{
+    typedef T      __type ;
+    typedef void   __void ;
+
+    /*! \brief real transform size */
+    __ix32 m_N;
+
+    /*! \brief complex transform size */
+    __ix32 m_M;
+
+    /*! \brief complex transform bit reversal permutation */
+    __ix32 *m_rev;
+
+    /*! \brief complex transform stages twiddles e^( -j * 2 * pi * k / len ) , k < len / 2 , len = 2 , 4 , ... , M */
+    fcomplex< __type > *m_w;
+
+    /*! \brief complex inverse transform stages twiddles ( conjugated m_w ) */
+    fcomplex< __type > *m_wi;
+
+    /*! \brief real spectrum split twiddles e^( -j * 2 * pi * k / N ) , k <= M */
+    fcomplex< __type > *m_ws;
+
+    /*! \brief complex transform buffer */
+    fcomplex< __type > *m_z;
+
+    /*! \brief radix-2 butterfly: a = a + b * w , b = a - b * w */
+    static inline __void butterfly( fcomplex< __type > &a , fcomplex< __type > &b , __type wr , __type wi )
+    {
+        __type re = b.re * wr - b.im * wi;
+        __type im = b.re * wi + b.im * wr;
+        b.re = a.re - re;
+        b.im = a.im - im;
+        a.re = a.re + re;
+        a.im = a.im + im;
+    }
+
+    /*!
+     *  \brief in-place radix-2 decimation in time complex transform
+     *  \param[w] - stages twiddles table ( m_w - forward transform , m_wi - inverse transform )
+     *  \details the input must be placed into the buffer in the bit reversed order , the result is not scaled
+    */
+    inline __void cfft( const fcomplex< __type > *w )
+    {
+        for( __ix32 len = 2 ; len <= m_M ; len <<= 1 )
+        {
+            __ix32 half = len >> 1;
+
+            // the short stages are computed twiddle by twiddle , the long stages are computed group by group:
+            if( half < 8 )
+            {
+                for( __ix32 k = 0 ; k < half ; k++ )
+                {
+                    __type wr = w[k].re , wi = w[k].im;
+                    for( __ix32 i = k ; i < m_M ; i += len ) butterfly( m_z[ i ] , m_z[ i + half ] , wr , wi );
+                }
+            }
+            else
+            {
+                for( __ix32 i = 0 ; i < m_M ; i += len )
+                {
+                    for( __ix32 k = 0 ; k < half ; k++ ) butterfly( m_z[ i + k ] , m_z[ i + k + half ] , w[k].re , w[k].im );
+                }
+            }
+
+            // the next stage twiddles:
+            w += half;
+        }
+    }
+
+public:
+
+    /*!
+     *  \brief  memory allocation function
+     *  \param[N] - transform size , power of 2 not less than 4
+     *  \return the function returns 1 if the memory is allocated and 0 otherwise
+    */
+    __ix32 allocate( __ix32 N )
+    {
+        deallocate();
+        if( N < 4 || ( N & ( N - 1 ) ) != 0 ) return 0;
+
+        m_N   = N;
+        m_M   = N / 2;
+        m_rev = ( __ix32* ) calloc( m_M , sizeof ( __ix32 ) );
+        m_w   = ( fcomplex< __type >* ) calloc( m_M , sizeof ( fcomplex< __type > ) );
+        m_wi  = ( fcomplex< __type >* ) calloc( m_M , sizeof ( fcomplex< __type > ) );
+        m_ws  = ( fcomplex< __type >* ) calloc( m_M + 1 , sizeof ( fcomplex< __type > ) );
+        m_z   = ( fcomplex< __type >* ) calloc( m_M + 1 , sizeof ( fcomplex< __type > ) );
+        if( m_rev == 0 || m_w == 0 || m_wi == 0 || m_ws == 0 || m_z == 0 ) { deallocate(); return 0; }
+
+        // bit reversal permutation:
+        __ix32 bits = 0;
+        while( ( 1 << bits ) < m_M ) bits++;
+        for( __ix32 k = 0 ; k < m_M ; k++ )
+        {
+            __ix32 r = 0;
+            for( __ix32 b = 0 ; b < bits ; b++ ) r |= ( ( k >> b ) & 1 ) << ( bits - 1 - b );
+            m_rev[ k ] = r;
+        }
+
+        // twiddles are computed with the 64-bit precision:
+        for( __ix32 len = 2 , pos = 0 ; len <= m_M ; pos += len / 2 , len <<= 1 )
+        {
+            for( __ix32 k = 0 ; k < len / 2 ; k++ )
+            {
+                m_w [ pos + k ] = fcomplex< __type >{ ( __type )cos( -PI2 * k / len ) ,  ( __type )sin( -PI2 * k / len ) };
+                m_wi[ pos + k ] = fcomplex< __type >{ ( __type )cos( -PI2 * k / len ) , -( __type )sin( -PI2 * k / len ) };
+            }
+        }
+        for( __ix32 k = 0 ; k <= m_M     ; k++ ) m_ws[ k ] = fcomplex< __type >{ ( __type )cos( -PI2 * k / m_N ) , ( __type )sin( -PI2 * k / m_N ) };
+        return 1;
+    }
+
+    /*! \brief memory deallocation function */
+    __void deallocate()
+    {
+        if( m_rev != 0 ) { free( m_rev ); m_rev = 0; }
+        if( m_w   != 0 ) { free( m_w   ); m_w   = 0; }
+        if( m_wi  != 0 ) { free( m_wi  ); m_wi  = 0; }
+        if( m_ws  != 0 ) { free( m_ws  ); m_ws  = 0; }
+        if( m_z   != 0 ) { free( m_z   ); m_z   = 0; }
+        m_N = m_M = 0;
+    }
+
+    /*!
+     *  \brief  transforms swapping function
+     *  \param[other] - transform to swap with
+     *  \details the function exchanges the tables of the transforms without the memory allocation
+    */
+    __void swap( rfft &other )
+    {
+        __ix32 N = m_N , M = m_M , *rev = m_rev;
+        m_N   = other.m_N;   other.m_N   = N;
+        m_M   = other.m_M;   other.m_M   = M;
+        m_rev = other.m_rev; other.m_rev = rev;
+
+        fcomplex< __type > *w = m_w , *wi = m_wi , *ws = m_ws , *z = m_z;
+        m_w  = other.m_w;  other.m_w  = w;
+        m_wi = other.m_wi; other.m_wi = wi;
+        m_ws = other.m_ws; other.m_ws = ws;
+        m_z  = other.m_z;  other.m_z  = z;
+    }
+
+    /*! \brief default constructor */
+    rfft() : m_N( 0 ) , m_M( 0 ) , m_rev( 0 ) , m_w( 0 ) , m_wi( 0 ) , m_ws( 0 ) , m_z( 0 ) {}
+
+    /*! \brief default destructor */
+    ~rfft() { deallocate(); }
+
+    /*! \brief transform size getting function */
+    inline __ix32 size() { return m_N; }
+
+    /*!
+     *  \brief  forward transform function
+     *  \param[x] - pointer to the N real input samples
+     *  \param[X] - pointer to the N / 2 + 1 output spectrum bins
+     *  \details the spectrum is not scaled
+    */
+    __void forward( const __type *x , fcomplex< __type > *X )
+    {
+        for( __ix32 k = 0 ; k < m_M ; k++ ) m_z[ m_rev[ k ] ] = fcomplex< __type >{ x[ 2 * k ] , x[ 2 * k + 1 ] };
+        cfft( m_w );
+        m_z[ m_M ] = m_z[ 0 ];
+
+        // even and odd samples spectra split:
+        for( __ix32 k = 0 ; k <= m_M ; k++ )
+        {
+            fcomplex< __type > a = m_z[ k ] , b = m_z[ m_M - k ];
+            __type e_re = ( a.re + b.re ) / 2 , e_im = ( a.im - b.im ) / 2;
+            __type o_re = ( a.im + b.im ) / 2 , o_im = ( b.re - a.re ) / 2;
+            X[ k ].re = e_re + m_ws[ k ].re * o_re - m_ws[ k ].im * o_im;
+            X[ k ].im = e_im + m_ws[ k ].re * o_im + m_ws[ k ].im * o_re;
+        }
+    }
+
+    /*!
+     *  \brief  inverse transform function
+     *  \param[X] - pointer to the N / 2 + 1 input spectrum bins
+     *  \param[x] - pointer to the N real output samples
+     *  \details the output is scaled by 1 / N , so inverse( forward( x ) ) = x
+    */
+    __void inverse( const fcomplex< __type > *X , __type *x )
+    {
+        // even and odd samples spectra merge:
+        for( __ix32 k = 0 ; k < m_M ; k++ )
+        {
+            fcomplex< __type > a = X[ k ] , b = X[ m_M - k ];
+            __type e_re = ( a.re + b.re ) / 2 , e_im = ( a.im - b.im ) / 2;
+            __type d_re = ( a.re - b.re ) / 2 , d_im = ( a.im + b.im ) / 2;
+            __type o_re = d_re * m_ws[ k ].re + d_im * m_ws[ k ].im;
+            __type o_im = d_im * m_ws[ k ].re - d_re * m_ws[ k ].im;
+            m_z[ m_rev[ k ] ] = fcomplex< __type >{ e_re - o_im , e_im + o_re };
+        }
+        cfft( m_wi );
+
+        __type scale = ( __type )1 / m_M;
+        for( __ix32 k = 0 ; k < m_M ; k++ )
+        {
+            x[ 2 * k     ] = m_z[ k ].re * scale;
+            x[ 2 * k + 1 ] = m_z[ k ].im * scale;
+        }
+    }
+};
+
+/*! @} */
+
+#undef __fx32
+#undef __fx64
+#undef __ix32
+
+// customized pi undef:
+#undef PI2
+
+#endif // FFT_H
@@ -14,14 +14,20 @@
 #ifndef __ALG_PLATFORM
 #include <iostream>
 #include <fstream>
+#include <atomic>
 #endif
 
+// compile-time FIR coefficients storage ( the header-only container uses no heap ):
+#include <array>
+
 /*! \defgroup <FIR_FILTERS> ( FIR filters )
  *  \brief the module contains FIR filter template class and it's auxiliary functions
     @{
 */
 
 #include "buffer.h"
+#include "simd.h"
+#include "fft.h"
 #include "special_functions.h"
 
 /*! \brief defines 32-bit floating point type */
@@ -39,11 +45,21 @@
 #define __fxx64 long double
 #endif
 
+/*! \brief defines 16-bit integer type */
+#ifndef __ix16
+#define __ix16 short
+#endif
+
 /*! \brief defines 32-bit integer type */
 #ifndef __ix32
 #define __ix32 int
 #endif
 
+/*! \brief defines 64-bit integer type */
+#ifndef __ix64
+#define __ix64 long long
+#endif
+
 /*! \brief defines pi */
 #ifndef PI0
 #define PI0 3.1415926535897932384626433832795
@@ -73,6 +89,21 @@
 */
 enum fir_type { lowpass_fir  , highpass_fir , bandpass_fir , bandstop_fir };
 
+/*!
+  \brief FIR filter symmetric coefficients folding modes enumeration:
+  \param[ fir_fold_auto  ] the folding is used if the coefficients are symmetric or antisymmetric within the tolerance
+  \param[ fir_fold_force ] the coefficients are projected onto the nearest symmetric or antisymmetric set and folded
+  \param[ fir_fold_off   ] the folding is disabled ( default )
+*/
+enum fir_fold { fir_fold_auto , fir_fold_force , fir_fold_off };
+
+/*!
+  \brief FIR filter phase response types enumeration:
+  \param[ fir_linear_phase  ] the windowed design linear phase coefficients are used
+  \param[ fir_minimum_phase ] the coefficients are converted into the minimum phase ones with the same amplitude response
+*/
+enum fir_phase { fir_linear_phase , fir_minimum_phase };
+
 /*! \brief FIR filter frequency response template data structure */
 template< typename T > struct fir_fr;
 
@@ -97,6 +128,51 @@ template<> struct fir_fr< __fx64  >{ __fx64 Km , pH; };
 */
 template<> struct fir_fr< __fxx64 >{ __fx64 Km , pH; };
 
+/*!
+  \brief FIR filter dense frequency response data structure
+  \param[n ] number of the grid points
+  \param[F ] grid frequencies           , Hz
+  \param[Km] amplitude frequency response , p.u
+  \param[pH] phase frequency response     , rad
+  \param[gd] group delay                  , samples
+*/
+struct fir_fr_grid
+{
+    __ix32  n;
+    __fx64 *F , *Km , *pH , *gd;
+
+    /*!
+     *  \brief  memory allocation function
+     *  \param[npoints] number of the grid points
+     *  \return the function allocates the four arrays in one block and returns 1 on success
+    */
+    __ix32 allocate( __ix32 npoints )
+    {
+        deallocate();
+        F = ( __fx64* ) calloc( 4 * npoints , sizeof ( __fx64 ) );
+        if( F == 0 ) return 0;
+        n  = npoints;
+        Km = F  + npoints;
+        pH = Km + npoints;
+        gd = pH + npoints;
+        return 1;
+    }
+
+    /*! \brief memory deallocation function */
+    void deallocate()
+    {
+        if( F != 0 ) free( F );
+        F = Km = pH = gd = 0;
+        n = 0;
+    }
+
+    /*! \brief default constructor */
+    fir_fr_grid() : n( 0 ) , F( 0 ) , Km( 0 ) , pH( 0 ) , gd( 0 ) {}
+
+    /*! \brief destructor */
+    ~fir_fr_grid() { deallocate(); }
+};
+
 /*!
   \brief FIR filter specification data structure
   \param[Fs]    sampling frequency        , Hz
@@ -133,6 +209,196 @@ template< typename OT , typename CT > fir_fr<OT> __fir_freq_resp__(  __fx64 Fs ,
     return { Km , pH };
 }
 
+/*!
+  * \brief FIR filter dense frequency response computation functon
+  * \param[Fs]      sampling frequency , Hz
+  * \param[order]   filter order
+  * \param[cfbuff]  coefficients buffer
+  * \param[fr]      frequency response grid
+  * \param[npoints] number of the grid points over [ 0 ; Fs / 2 ]
+  * \return The function computes the frequency response at the bins of one L-point real FFT of the zero-padded
+  *         coefficients , L = 2 * ( npoints - 1 ) is rounded up to the power of 2 , and returns the number of the
+  *         points L / 2 + 1 ( 0 - memory allocation error ). The group delay is computed from the second FFT of the
+  *         ramped coefficients:
+  *         \f[
+  *             F_k = \frac{ k * F_s }{ L } , \quad
+  *             W_k = \sum_{ i = 0 }^{ order } a_i * e^{ -j * 2 * \pi * k * i / L } , \quad
+  *             \tau_k = Re \left( \frac{ \sum_{ i = 0 }^{ order } i * a_i * e^{ -j * 2 * \pi * k * i / L } }{ W_k } \right)
+  *         \f]
+  *         The filters longer than L are folded modulo L , so the bins stay exact. The group delay is not defined at
+  *         the response zeros , so it is held from the previous point there.
+*/
+template< typename CT > __ix32 __fir_freq_resp_grid__( __fx64 Fs , __ix32 order , const CT *cfbuff , fir_fr_grid &fr , __ix32 npoints )
+{
+    __ix32 L = 4;
+    while( L < 2 * ( npoints - 1 ) ) L <<= 1;
+    if( cfbuff == 0 || !fr.allocate( L / 2 + 1 ) ) return 0;
+
+    rfft< __fx64 > fft;
+    __fx64 *h  = ( __fx64* ) calloc( 2 * L , sizeof ( __fx64 ) );
+    fcomplex< __fx64 > *H = ( fcomplex< __fx64 >* ) calloc( L + 2 , sizeof ( fcomplex< __fx64 > ) );
+    if( h == 0 || H == 0 || !fft.allocate( L ) )
+    {
+        if( h != 0 ) free( h );
+        if( H != 0 ) free( H );
+        fr.deallocate();
+        return 0;
+    }
+
+    // zero-padded coefficients and ramped coefficients:
+    __fx64 *nh = h + L;
+    fcomplex< __fx64 > *NH = H + L / 2 + 1;
+    for( __ix32 i = 0 ; i <= order ; i++ )
+    {
+        h [ i % L ] += cfbuff[ i ];
+        nh[ i % L ] += i * ( __fx64 )cfbuff[ i ];
+    }
+    fft.forward( h  , H  );
+    fft.forward( nh , NH );
+
+    // amplitude , phase and group delay:
+    for( __ix32 k = 0 ; k <= L / 2 ; k++ )
+    {
+        __fx64 p = H[k].re * H[k].re + H[k].im * H[k].im;
+        fr.F [k] = k * Fs / L;
+        fr.Km[k] = sqrt( p );
+        fr.pH[k] = atan2( H[k].im , H[k].re );
+        fr.gd[k] = ( p > 1e-20 ) ? ( NH[k].re * H[k].re + NH[k].im * H[k].im ) / p : ( ( k > 0 ) ? fr.gd[ k - 1 ] : 0.5 * order );
+    }
+
+    free( h );
+    free( H );
+    return fr.n;
+}
+
+/*!
+  * \brief FIR filter group delay computation functon
+  * \param[Fs]     sampling frequency , Hz
+  * \param[F]      input frequency    , Hz
+  * \param[order]  filter order
+  * \param[cfbuff] coefficients buffer
+  * \return The function returns the group delay at the frequency F , samples:
+  *         \f[
+  *             \tau = Re \left( \frac{ \sum_{ i = 0 }^{ order } i * a_i * e^{ -j * 2 * \pi * F * i * T_s } }
+  *                                   { \sum_{ i = 0 }^{ order } a_i * e^{ -j * 2 * \pi * F * i * T_s } } \right)
+  *         \f]
+*/
+template< typename CT > __fx64 __fir_group_delay__( __fx64 Fs , __fx64 F , __ix32 order , const CT *cfbuff )
+{
+    __fx64 Re = 0 , Im = 0 , nRe = 0 , nIm = 0 , Ts = 1 / Fs;
+    for( __ix32 i = 0 ; i <= order ; i++ )
+    {
+        __fx64 c = cos( -PI2 * i * F * Ts ) * cfbuff[ i ] , s = sin( -PI2 * i * F * Ts ) * cfbuff[ i ];
+        Re  += c;
+        Im  += s;
+        nRe += i * c;
+        nIm += i * s;
+    }
+    __fx64 p = Re * Re + Im * Im;
+    return ( p > 0 ) ? ( nRe * Re + nIm * Im ) / p : 0.5 * order;
+}
+
+/*!
+  * \brief FIR filter minimum phase conversion function
+  * \param[cf] coefficients buffer
+  * \param[N]  filter coefficients number
+  * \return The function replaces the coefficients by the minimum phase ones having the same amplitude response
+  *         by means of the cepstral ( homomorphic ) method and returns 1 on success and 0 otherwise. The real
+  *         cepstrum of the amplitude response is folded onto the positive quefrencies , so all the zeros are moved
+  *         inside the unit circle:
+  *         \f[
+  *             c = IFFT \left( \ln \left| FFT( a ) \right| \right) , \quad
+  *             \hat{c}_n = \begin{cases} c_n , \quad n = 0 , L / 2 \\ 2 * c_n , \quad 0 < n < L / 2 \\ 0 , \quad n > L / 2 \end{cases} , \quad
+  *             a^{min} = IFFT \left( e^{ FFT( \hat{c} ) } \right)
+  *         \f]
+  *         The FFT size L >= 32 * N keeps the cepstrum aliasing low , the stopband is floored at -200 dB , so the
+  *         logarithm of the response zeros stays finite. The first N samples of the result are kept.
+*/
+template< typename T > __ix32 __fir_min_phase__( T *cf , __ix32 N )
+{
+    __ix32 L = 1024;
+    while( L < 32 * N ) L <<= 1;
+
+    rfft< __fx64 > fft;
+    __fx64 *x = ( __fx64* ) calloc( L , sizeof ( __fx64 ) );
+    fcomplex< __fx64 > *X = ( fcomplex< __fx64 >* ) calloc( L / 2 + 1 , sizeof ( fcomplex< __fx64 > ) );
+    if( cf == 0 || x == 0 || X == 0 || !fft.allocate( L ) )
+    {
+        if( x != 0 ) free( x );
+        if( X != 0 ) free( X );
+        return 0;
+    }
+
+    // log amplitude response:
+    for( __ix32 n = 0 ; n < N ; n++ ) x[ n ] = cf[ n ];
+    fft.forward( x , X );
+    __fx64 max = 0;
+    for( __ix32 k = 0 ; k <= L / 2 ; k++ )
+    {
+        X[k] = fcomplex< __fx64 >{ sqrt( X[k].re * X[k].re + X[k].im * X[k].im ) , 0 };
+        if( X[k].re > max ) max = X[k].re;
+    }
+    for( __ix32 k = 0 ; k <= L / 2 ; k++ ) X[k].re = log( ( X[k].re > max * 1e-10 ) ? X[k].re : max * 1e-10 );
+
+    // real cepstrum folding:
+    fft.inverse( X , x );
+    for( __ix32 n = 1 ; n < L / 2 ; n++ ) x[ n ] *= 2;
+    for( __ix32 n = L / 2 + 1 ; n < L ; n++ ) x[ n ] = 0;
+
+    // minimum phase spectrum and coefficients:
+    fft.forward( x , X );
+    for( __ix32 k = 0 ; k <= L / 2 ; k++ )
+    {
+        __fx64 a = exp( X[k].re );
+        X[k] = fcomplex< __fx64 >{ a * cos( X[k].im ) , a * sin( X[k].im ) };
+    }
+    fft.inverse( X , x );
+    for( __ix32 n = 0 ; n < N ; n++ ) cf[ n ] = ( T )x[ n ];
+
+    free( x );
+    free( X );
+    return 1;
+}
+
+/*!
+  * \brief FIR filter coefficients folding function
+  * \param[cf]   coefficients buffer
+  * \param[cfr]  time-reversed coefficients buffer
+  * \param[N]    filter coefficients number
+  * \param[mode] folding mode
+  * \param[tol]  symmetry tolerance relative to the coefficients maximum absolute value
+  * \return The function detects the coefficients symmetry ( Type I , II : h[ i ] = h[ N - 1 - i ] ) or antisymmetry
+  *         ( Type III , IV : h[ i ] = -h[ N - 1 - i ] ) and returns the folding sign: +1 , -1 or 0 if the folding is not used.
+  *         The forced folding symmetrizes both buffers , so the filter remains consistent with its frequency response.
+*/
+template< typename T > __ix32 __fir_fold__( T *cf , T *cfr , __ix32 N , fir_fold mode , T tol )
+{
+    if( mode == fir_fold_off || cf == 0 || cfr == 0 || N < 2 ) return 0;
+
+    // symmetric and antisymmetric parts deviations:
+    T es = 0 , ea = 0 , amax = 0;
+    for( __ix32 i = 0 ; i < N ; i++ )
+    {
+        T ds = fabs( cf[i] - cf[N - 1 - i] ) , da = fabs( cf[i] + cf[N - 1 - i] ) , a = fabs( cf[i] );
+        if( ds > es   ) es   = ds;
+        if( da > ea   ) ea   = da;
+        if( a  > amax ) amax = a;
+    }
+
+    __ix32 sign = ( es <= ea ) ? +1 : -1;
+    if( mode == fir_fold_auto ) return ( ( ( sign > 0 ) ? es : ea ) <= tol * amax ) ? sign : 0;
+
+    // forced folding , the coefficients are projected onto the nearest ( anti )symmetric set:
+    for( __ix32 i = 0 ; i <= ( N - 1 ) / 2 ; i++ )
+    {
+        T v = ( cf[i] + sign * cf[N - 1 - i] ) / 2;
+        cf[i] = v;
+        cf[N - 1 - i] = sign * v;
+    }
+    for( __ix32 n = 0 ; n < N ; n++ ) cfr[ n ] = cf[ N - 1 - n ];
+    return sign;
+}
+
 /*!
   * \brief FIR digital lowpass filter coefficients computation function
   * \param[Fs]     sampling frequency , Hz
@@ -501,235 +767,646 @@ template< typename T > T* __fir_wind_digital_bs__( __fx64 Fs , __fx64 Fc , __fx6
     return cfbuff;
 }
 
-/*! \brief template FIR filter class */
-template< typename T > class fir;
-
-/*! \brief template comb FIR filter class */
-template< typename T > class fcomb;
-
-/*! \brief template equalized comb FIR filter class */
-template< typename T > class fcombeq;
-
-/*! \brief 32-bit floating point FIR filter */
-template<> class fir<__fx32>
+/*!
+  * \brief CIC filter frequency response computation function
+  * \param[Fs] input sampling frequency , Hz
+  * \param[F]  input frequency          , Hz
+  * \param[R]  decimation ratio
+  * \param[S]  integrator and comb stages number
+  * \param[M]  comb differential delay
+  * \return The function returns the normalized frequency response of the S-stage CIC decimator:
+  *         \f[
+  *             H( F ) = \left( \frac{ \sin{ ( \pi * F * R * M / F_s ) } }{ R * M * \sin{ ( \pi * F / F_s ) } } \right)^S *
+  *                      e^{ -j * \pi * F * ( R * M - 1 ) * S / F_s }
+  *         \f]
+*/
+inline fir_fr< __fx64 > __cic_freq_resp__( __fx64 Fs , __fx64 F , __ix32 R , __ix32 S , __ix32 M )
 {
-    typedef __fx32 __type ;
-    typedef bool   __bool ;
-    typedef void   __void ;
+    __fx64 x = PI0 * F / Fs , den = R * M * sin( x ) , Km = ( fabs( den ) > 1e-12 ) ? sin( x * R * M ) / den : 1;
+    __fx64 pH = -x * ( R * M - 1 ) * S;
 
-    /*! \brief lowpass specification data structure */
-    fir_sp  m_sp;
-
-    /*! \brief lowpass coefficients buffer */
-    __type *m_cf;
+    // the negative lobes add pi to the phase of the odd stages number filter:
+    if( Km < 0 && S % 2 != 0 ) pH += PI0;
+    return fir_fr< __fx64 >{ pow( fabs( Km ) , S ) , atan2( sin( pH ) , cos( pH ) ) };
+}
 
-    /*! \brief lowpass input buffer */
-    mirror_ring_buffer< __type > m_bx;
+/*!
+  * \brief FIR CIC compensation lowpass filter coefficients computation function
+  * \param[Fs]    sampling frequency ( the CIC decimator output sampling frequency ) , Hz
+  * \param[Fc]    cut-off frequency , Hz
+  * \param[N]     filter order
+  * \param[R]     CIC decimation ratio
+  * \param[S]     CIC stages number
+  * \param[M]     CIC comb differential delay
+  * \param[scale] scaling factor ( scale = 0 - not-scaled coefficients , scale = 1 - scaled coefficients )
+  * \param[wind]  input window function object
+  * \return The function returns the lowpass coefficients buffer. The desired amplitude response is equal to the
+  *         CIC decimator response inverse within the passband , so the CIC droop is flattened:
+  *         \f[
+  *             D( F ) = \frac{ 1 }{ \left| H_{ CIC }( F ) \right| } \quad , \quad F \le F_c         \newline
+  *             a_n = \frac{ 2 }{ F_s } * \int_{ 0 }^{ F_c } D( F ) * \cos{ \left( 2 * \pi * F * \left( n - \frac{ N }{ 2 } \right) / F_s \right) } dF * w_n
+  *         \f]
+  *         The integral is computed by means of the Simpson rule , so the D( F ) = 1 coefficients are equal to the
+  *         __fir_wind_digital_lp__ ones.
+*/
+template< typename T > T* __fir_wind_cic_comp__( __fx64 Fs , __fx64 Fc , __ix32 N , __ix32 R , __ix32 S , __ix32 M , bool scale , wind_fcn &wind )
+{
+    typedef T __type;
 
-public:
+    // check if the window is ready to use:
+    if ( wind.is_ready() == 0 ) wind.Chebyshev(100);
 
-    /*! \brief lowpass output */
-    __type m_out;
+    // coefficients buffer memory allocation:
+    __type *cfbuff = ( __type* ) calloc( N + 1 , sizeof ( __type ) );
+    if( cfbuff == 0 ) return 0;
 
-   /*! \brief lowpass window function object */
-    wind_fcn m_wind;
+    // desired response over the Simpson rule grid ( the CIC response is taken at its input sampling frequency R * Fs ):
+    const __ix32 K = 512;
+    __fx64 D[ K + 1 ] , dF = Fc / K;
+    for( __ix32 i = 0 ; i <= K ; i++ ) D[ i ] = 1 / __cic_freq_resp__( R * Fs , i * dF , R , S , M ).Km;
 
-    /*! \brief lowpass memory allocation function */
-    __ix32 allocate()
+    // coefficients computation:
+    for ( __ix32 n = 0 ; n <= N / 2 ; n++ )
     {
-        switch ( m_sp.type )
+        __fx64 t = n - 0.5 * N , sum = 0;
+        for( __ix32 i = 0 ; i <= K ; i++ )
         {
-            case fir_type::lowpass_fir:
-            m_cf = __fir_wind_digital_lp__< __type >( m_sp.Fs , m_sp.Fc , m_sp.order , m_sp.scale , m_wind );
-            break;
+            __fx64 w = ( i == 0 || i == K ) ? 1 : ( i % 2 != 0 ) ? 4 : 2;
+            sum += w * D[ i ] * cos( PI2 * i * dF * t / Fs );
+        }
+        cfbuff[ n ] = cfbuff[ N - n ] = 2 / Fs * sum * dF / 3;
+    }
+    for ( __ix32 n = 0 ; n <= N ; n++ ) cfbuff[ n ] *= wind[ n ];
 
-            case fir_type::highpass_fir:
-            m_cf = __fir_wind_digital_hp__< __type >( m_sp.Fs , m_sp.Fc , m_sp.order , m_sp.scale , m_wind );
-            break;
+    // filter pulse characteristic normalization:
+    if ( scale )
+    {
+        fir_fr< __type > fr = __fir_freq_resp__< __type , __type >( Fs , 0 , N , cfbuff );
+        for ( __ix32 n = 0; n <= N; n++) cfbuff[n] /= fr.Km;
+    }
 
-            case fir_type::bandpass_fir:
-            m_cf = __fir_wind_digital_bp__< __type >( m_sp.Fs , m_sp.Fc , m_sp.BW , m_sp.order , m_sp.scale , m_wind );
-            break;
+    // deallocate the window function:
+    wind.deallocate();
 
-            case fir_type::bandstop_fir:
-            m_cf = __fir_wind_digital_bs__< __type >( m_sp.Fs , m_sp.Fc , m_sp.BW , m_sp.order , m_sp.scale , m_wind );
-            break;
-        }
+    // return the result:
+    return cfbuff;
+}
 
-        m_bx.allocate( m_sp.N + 1 );
-        return ( m_cf != 0 );
+/*!
+  * \brief FIR filter coefficients computation function
+  * \param[sp]   filter specification data structure
+  * \param[wind] window function object
+  * \return The function computes and returns the lowpass , highpass , bandpass or bandstop filter coefficients buffer
+  *         according to the specification filter type
+*/
+template< typename T > T* __fir_wind_compute__( const fir_sp &sp , wind_fcn &wind )
+{
+    switch ( sp.type )
+    {
+        case fir_type::lowpass_fir : return __fir_wind_digital_lp__< T >( sp.Fs , sp.Fc , sp.order , sp.scale , wind );
+        case fir_type::highpass_fir: return __fir_wind_digital_hp__< T >( sp.Fs , sp.Fc , sp.order , sp.scale , wind );
+        case fir_type::bandpass_fir: return __fir_wind_digital_bp__< T >( sp.Fs , sp.Fc , sp.BW , sp.order , sp.scale , wind );
+        case fir_type::bandstop_fir: return __fir_wind_digital_bs__< T >( sp.Fs , sp.Fc , sp.BW , sp.order , sp.scale , wind );
     }
+    return 0;
+}
 
-    /*! \brief lowpass memory deallocation function */
-    __void deallocate()
+/*!
+  * \brief FIR filter coefficients design function
+  * \param[sp]   filter specification data structure
+  * \param[wind] window function object
+  * \return The function returns the lowpass , highpass , bandpass or bandstop filter coefficients buffer
+  *         according to the specification filter type. The buffer is owned by the caller. If the design cache
+  *         is enabled , the buffer is copied out of the cache , so the repeated designs are not computed. The filters
+  *         with the same type , Fs , Fc , BW , order , scaling flag , window type and window parameter share the cache
+  *         entry , the nominal frequency does not take part in the design , so it is not the part of the key. The not
+  *         computed window is keyed as the default Chebyshev( 100 ) window , so the window is not computed at all if the
+  *         coefficients are cached.
+*/
+template< typename T > T* __fir_wind_design__( const fir_sp &sp , wind_fcn &wind )
+{
+#if __DESIGN_CACHE
+    __fx64 key[ __DESIGN_KEY_SIZE ] = { 1 , ( __fx64 )sp.type , sp.Fs , sp.Fc , sp.BW , ( __fx64 )sp.order , ( __fx64 )sp.scale ,
+                                        ( __fx64 )( wind.is_ready() ? wind.type() : wind_chebyshev ) ,
+                                        wind.is_ready() ? wind.param() : 100 , 0 };
+
+    T *buff = ( T* ) calloc( sp.N , sizeof ( T ) );
+    if( buff == 0 ) return 0;
+    if( design_cache< T >::instance().find( key , buff , sp.N ) )
     {
-        if( m_cf != 0 ) { free( m_cf ); m_cf = nullptr; }
-        m_bx.deallocate();
-        m_wind.deallocate();
+        wind.deallocate();
+        return buff;
     }
+    free( buff );
 
-    /*! \brief Lowpass initialization function
-     *  \details the function initializes lowpass FIR filter
-     *  \param[Fs]      - sampling frequency , Hz
-     *  \param[Fn]      - nominal frequency  , Hz
-     *  \param[Fc]      - cut-off frequency  , Hz
-     *  \param[order]   - filter order
-     *  \param[scale]   - filter scaling flag ( 0 - not-scaled filter , 1 - scaled filter )
-    */
-    __void lp_init( __type Fs, __type Fn, __type Fc, __ix32 order , __bool scale )
+    buff = __fir_wind_compute__< T >( sp , wind );
+    if( buff != 0 ) design_cache< T >::instance().insert( key , buff , sp.N );
+    return buff;
+#else
+    return __fir_wind_compute__< T >( sp , wind );
+#endif
+}
+
+/*!
+  * \brief FIR filter coefficients quantization function
+  * \param[cf]   coefficients buffer
+  * \param[cfq]  time-reversed quantized coefficients buffer
+  * \param[N]    filter coefficients number
+  * \param[bits] samples fractional bits number ( 15 - Q15 , 31 - Q31 )
+  * \return The function rounds the time-reversed coefficients to the Q( bits - g ) format and returns the coefficients
+  *         fractional bits number bits - g. The headroom g is the smallest one that keeps every quantized coefficient
+  *         within the bits + 1 bits integer and sum( | cfq[ i ] | ) < 2^( bits + 1 ) , so the exact sum of the products of
+  *         the full scale samples and the quantized coefficients is less than 2^( 2 * bits + 1 ) and never overflows the
+  *         accumulator ( 32-bit lanes for Q15 , 64-bit for Q31 ).
+*/
+template< typename T > __ix32 __fir_quantize__( const __fx64 *cf , T *cfq , __ix32 N , __ix32 bits )
+{
+    __ix32 q = bits;
+    for( ; q > 1 ; q-- )
     {
-        m_sp  = fir_sp{ Fs , Fn , Fc , -1 , 1 / Fs , order , order + 1 , scale , fir_type::lowpass_fir };
-        m_cf  = 0;
-        m_out = 0;
-        m_wind.init( m_sp.N );
+        __fx64 k = ldexp( 1.0 , q ) , max = ldexp( 1.0 , bits ) - 1 , sum = 0;
+        for( __ix32 i = 0 ; i < N ; i++ )
+        {
+            __fx64 v = floor( fabs( cf[ i ] ) * k + 0.5 );
+            if( v > max ) { sum = -1; break; }
+            sum += v;
+        }
+        if( sum >= 0 && sum < ldexp( 1.0 , bits + 1 ) ) break;
     }
 
-    /*! \brief Highpass initialization function
-     *  \details the function initializes highpass FIR filter
-     *  \param[Fs]      - sampling frequency , Hz
-     *  \param[Fn]      - nominal frequency  , Hz
-     *  \param[Fp]      - pass frequency     , Hz
-     *  \param[order]   - filter order
-     *  \param[scale]   - filter scaling flag ( 0 - not-scaled filter , 1 - scaled filter )
-    */
-    __void hp_init( __type Fs, __type Fn, __type Fp , __ix32 order , __bool scale )
+    // rounding to the nearest:
+    __fx64 k = ldexp( 1.0 , q );
+    for( __ix32 i = 0 ; i < N ; i++ )
     {
-        m_sp  = fir_sp{ Fs , Fn , Fp , -1 , 1 / Fs , order , order + 1 , scale , fir_type::highpass_fir };
-        m_cf  = 0;
-        m_out = 0;
-        m_wind.init( m_sp.N );
+        __fx64 v = cf[ N - 1 - i ] * k;
+        cfq[ i ] = ( T )( ( v >= 0 ) ? floor( v + 0.5 ) : -floor( -v + 0.5 ) );
     }
+    return q;
+}
 
-    /*! \brief Bandpass initialization function
-     *  \details the function initializes bandpass FIR filter
-     *  \param[Fs]      - sampling frequency , Hz
-     *  \param[Fn]      - nominal frequency  , Hz
-     *  \param[Fp]      - cut-off frequency  , Hz
-     *  \param[BW]      - pass bandwidth     , Hz
-     *  \param[order]   - filter order
-     *  \param[scale]   - filter scaling flag ( 0 - not-scaled filter , 1 - scaled filter )
+/*!
+ *  \brief FIR filter compile-time specification data structure
+ *  \details The structure keeps the normalized frequencies f1 = Fc / Fs , f2 = ( Fc + BW ) / Fs and computes the
+ *           coefficients by the same formulas as the __fir_wind_digital_lp__ , __fir_wind_digital_hp__ ,
+ *           __fir_wind_digital_bp__ and __fir_wind_digital_bs__ functions do , but by means of the constexpr
+ *           functions , so the coefficients of a fixed configuration are computed during compilation.
+*/
+struct fir_static_sp
+{
+    /*! \brief filter type */
+    fir_type  type;
+    /*! \brief window function type */
+    wind_type wind;
+    /*! \brief filter order */
+    __ix32    order;
+    /*! \brief normalized cut-off ( pass ) frequency */
+    __fx64    f1;
+    /*! \brief normalized cut-off ( pass ) frequency plus the normalized bandwidth */
+    __fx64    f2;
+
+    /*!
+     *  \brief  sinc function
+     *  \param[f] normalized frequency
+     *  \param[m] distance from the filter center , samples , m > 0
+     *  \return the function returns 2 * f * sin( 2 * pi * f * m ) / ( 2 * pi * f * m )
     */
-    __void bp_init( __type Fs, __type Fn, __type Fp , __fx64 BW , __ix32 order , __bool scale )
+    constexpr __fx64 sinc( __fx64 f , __fx64 m ) const { return 2 * f * __cx_sin__( m * PI2 * f ) / ( m * PI2 * f ); }
+
+    /*!
+     *  \brief  first half coefficient computation function
+     *  \param[m] distance of the k-th coefficient from the filter center , m = order / 2 - k , k = 0 ... order / 2
+     *  \param[w] k-th window coefficient
+     *  \return the function returns k-th windowed coefficient
+    */
+    constexpr __fx64 half( __fx64 m , __fx64 w ) const
     {
-        m_sp  = fir_sp{ Fs , Fn , Fp , BW , 1 / Fs , order , order + 1 , scale , fir_type::bandpass_fir };
-        m_cf  = 0;
-        m_out = 0;
-        m_wind.init( m_sp.N );
+        return ( type == lowpass_fir  ) ? ( ( m == 0 ) ? 2 * f1 * w : sinc( f1 , m ) * w ) :
+               ( type == highpass_fir ) ? ( ( order % 2 != 0 ) ? ( ( ( ( __ix32 )( m - 0.5 ) ) % 2 == 0 ) ? -1 : 1 ) * sinc( 0.5 - f1 , m ) * w :
+                                            ( m == 0 ) ? ( 1 - 2 * f1 ) * w : -sinc( f1 , m ) * w ) :
+               ( type == bandpass_fir ) ? ( ( m == 0 ) ? 2 * ( f2 - f1 ) * w : ( sinc( f2 , m ) - sinc( f1 , m ) ) * w ) :
+                                          ( ( m == 0 ) ? 1 - 2 * ( f2 - f1 ) * w : ( sinc( f1 , m ) - sinc( f2 , m ) ) * w );
     }
 
-    /*! \brief Bandstop initialization function
-     *  \details The function initializes bandstop FIR filter
-     *  \param[Fs]      - sampling frequency , Hz
-     *  \param[Fn]      - nominal frequency  , Hz
-     *  \param[Fc]      - cut-off frequency  , Hz
-     *  \param[BW]      - stop bandwidth     , Hz
-     *  \param[order]   - filter order
-     *  \param[scale]   - filter scaling flag ( 0 - not-scaled filter , 1 - scaled filter )
+    /*!
+     *  \brief  not scaled coefficient computation function
+     *  \param[n] coefficient number , n = 0 ... order
+     *  \return the function computes the first half and mirrors it ( the odd order highpass filter is antisymmetric )
     */
-    __void bs_init( __type Fs, __type Fn, __type Fc , __fx64 BW , __ix32 order , __bool scale )
+    constexpr __fx64 tap( __ix32 n ) const
     {
-        m_sp  = fir_sp{ Fs , Fn , Fc , BW , 1 / Fs , order , order + 1 , scale , fir_type::bandstop_fir };
-        m_cf  = 0;
-        m_out = 0;
-        m_wind.init( m_sp.N );
+        return ( 2 * n <= order ) ? half( order / 2.0 - n , __cx_wind__( wind , n , order + 1 ) ) :
+               ( ( type == highpass_fir && order % 2 != 0 ) ? -1 : 1 ) * half( n - order / 2.0 , __cx_wind__( wind , order - n , order + 1 ) );
     }
 
-    /*! \brief default constructor */
-    fir()
+    /*!
+     *  \brief  frequency response real part computation function
+     *  \param[F] normalized frequency
+     *  \param[a] first coefficient number
+     *  \param[b] last coefficient number plus 1
+     *  \return the function returns sum( tap( n ) * cos( -2 * pi * F * n ) ) , n = a ... b - 1 ( the pairwise sum keeps the recursion depth logarithmic )
+    */
+    constexpr __fx64 re( __fx64 F , __ix32 a , __ix32 b ) const
     {
-        m_sp  = fir_sp{ 4000 , 50 , 100 , -1 , 1 / 4000 , 80 , 80 + 1 , 1 , fir_type::lowpass_fir };
-        m_cf  = 0;
-        m_out = 0;
-        m_wind.init( m_sp.N  );
+        return ( b - a == 1 ) ? tap( a ) * __cx_cos__( -PI2 * F * a ) : re( F , a , ( a + b ) / 2 ) + re( F , ( a + b ) / 2 , b );
     }
 
-    /*! \brief  destructor */
-    ~fir() { deallocate(); }
-
     /*!
-     *  \brief  frequency response computation function
-     *  \param[F] input frequency
-     *  \return the function returns fir_fr data structure
+     *  \brief  frequency response imaginary part computation function
+     *  \param[F] normalized frequency
+     *  \param[a] first coefficient number
+     *  \param[b] last coefficient number plus 1
+     *  \return the function returns sum( tap( n ) * sin( -2 * pi * F * n ) ) , n = a ... b - 1
     */
-    inline fir_fr< __fx64 > freq_resp( __fx64 F ) { return __fir_freq_resp__< __fx64 , __type >( m_sp.Fs , F , m_sp.order , m_cf ); }
+    constexpr __fx64 im( __fx64 F , __ix32 a , __ix32 b ) const
+    {
+        return ( b - a == 1 ) ? tap( a ) * __cx_sin__( -PI2 * F * a ) : im( F , a , ( a + b ) / 2 ) + im( F , ( a + b ) / 2 , b );
+    }
 
     /*!
-     *  \brief  FIR pulse response getting function
-     *  \param[F] pulse response sample number
-     *  \return the function returns FIR impulse response sample
+     *  \brief  scaling frequency getting function
+     *  \return the function returns the normalized frequency where the scaled filter has the unity gain
+     *          ( 0 - lowpass and bandstop , 0.5 - highpass , the band center - bandpass )
     */
-    inline __type get_coeff( __ix32 n ) { return ( n <= m_sp.order ) ? m_cf[ n ] : 1e6; }
+    constexpr __fx64 scale_freq() const { return ( type == highpass_fir ) ? 0.5 : ( type == bandpass_fir ) ? f1 + 0.5 * ( f2 - f1 ) : 0; }
+};
 
-    /*!
-     *  \brief  32-bit FIR filter buffer filling function
-     *  \param[input] pointer to the input data array
-     *  \return the function returns FIR filtering result
+/*! \brief compile-time index sequence ( C++11 replacement of the C++14 std::integer_sequence ) */
+template< __ix32... I > struct __cx_index_seq__ {};
+
+/*! \brief compile-time index sequences concatenation , the second sequence is shifted by the first sequence length */
+template< typename A , typename B > struct __cx_index_cat__;
+
+template< __ix32... I , __ix32... J > struct __cx_index_cat__< __cx_index_seq__< I... > , __cx_index_seq__< J... > >
+{
+    typedef __cx_index_seq__< I... , ( ( __ix32 )sizeof...( I ) + J )... > type;
+};
+
+/*! \brief compile-time index sequence 0 ... N - 1 generator ( the halving keeps the instantiation depth logarithmic ) */
+template< __ix32 N > struct __cx_make_index__
+{
+    typedef typename __cx_index_cat__< typename __cx_make_index__< N / 2 >::type , typename __cx_make_index__< N - N / 2 >::type >::type type;
+};
+
+template<> struct __cx_make_index__< 0 > { typedef __cx_index_seq__<>    type; };
+template<> struct __cx_make_index__< 1 > { typedef __cx_index_seq__< 0 > type; };
+
+/*!
+ *  \brief FIR filter compile-time coefficients computation function
+ *  \param[sp]   compile-time specification
+ *  \param[gain] coefficients scaling gain ( 1 - not scaled filter )
+ *  \return The function returns std::array of order + 1 coefficients cf[ n ] = sp.tap( n ) / gain
+*/
+template< typename T , __ix32... I > constexpr std::array< T , sizeof...( I ) > __fir_static_design__( fir_static_sp sp , __fx64 gain , __cx_index_seq__< I... > )
+{
+    return std::array< T , sizeof...( I ) >{ { ( T )( sp.tap( I ) / gain )... } };
+}
+
+/*! \brief defines the FIR filter order starting from which the fir class block filtering may use the overlap-save engine */
+#ifndef __FIR_OLS_MIN_ORDER
+#define __FIR_OLS_MIN_ORDER 64
+#endif
+
+/*!
+ *  \brief defines the cost of the single FFT butterfly in the direct form multiply-accumulate operations
+ *  \details the direct form is vectorized , so the butterfly is worth a few tens of the multiply-accumulate operations
+*/
+#ifndef __FIR_OLS_BUTTERFLY_COST
+#define __FIR_OLS_BUTTERFLY_COST 16
+#endif
+
+/*!
+ *  \brief FIR filter overlap-save fast convolution engine
+ *  \details The input is processed by blocks of B = L - N + 1 samples , where N is the filter coefficients number
+ *           and L is the FFT size. Every block is preceded with the N - 1 previous input samples , transformed ,
+ *           multiplied by the precomputed coefficients spectrum and transformed back. The first N - 1 output
+ *           samples are discarded , since they are corrupted by the circular convolution.
+*/
+template< typename T > class fir_ols
+{
+    typedef T      __type ;
+    typedef bool   __bool ;
+    typedef void   __void ;
+
+    /*! \brief filter coefficients number */
+    __ix32 m_N;
+
+    /*! \brief FFT size */
+    __ix32 m_L;
+
+    /*! \brief block size */
+    __ix32 m_B;
+
+    /*! \brief real-input FFT object */
+    rfft< __type > m_fft;
+
+    /*! \brief coefficients spectrum */
+    fcomplex< __type > *m_H;
+
+    /*! \brief block spectrum */
+    fcomplex< __type > *m_X;
+
+    /*! \brief FFT input / output buffer */
+    __type *m_x;
+
+    /*! \brief input history ( N - 1 previous samples , oldest first ) for the standalone processing */
+    __type *m_hx;
+
+    /*! \brief block FFT cost in the multiply-accumulate operations */
+    __fx64 m_cost;
+
+    /*!
+     *  \brief FFT cost estimation function
+     *  \param[L] - FFT size
+     *  \return the function returns forward and inverse real FFT and spectrum multiplication cost in the butterflies
     */
-    inline void fill_fir_buff( __type *input ) { m_bx( input ); }
+    static __fx64 fft_cost( __ix32 L )
+    {
+        __ix32 bits = 0;
+        while( ( 1 << bits ) < L / 2 ) bits++;
+        return 2.0 * ( L / 4 ) * bits + 2.0 * L;
+    }
 
     /*!
-     *  \brief  64-bit FIR filter buffer filling function
-     *  \param[input] pointer to the input data array
-     *  \return the function returns FIR filtering result
+     *  \brief  FFT size selection function
+     *  \param[N] - filter coefficients number
+     *  \return the function returns the FFT size with the minimum cost per output sample
     */
-    inline void fill_fir_buff( __fx64 *input ) { m_bx( input ); }
+    static __ix32 best_size( __ix32 N )
+    {
+        __ix32 Lmin = 4 , L;
+        while( Lmin < 2 * N ) Lmin <<= 1;
+        L = Lmin;
+        for( __ix32 l = Lmin ; l <= Lmin * 4 ; l <<= 1 ) if( fft_cost( l ) / ( l - N + 1 ) < fft_cost( L ) / ( L - N + 1 ) ) L = l;
+        return L;
+    }
+
+public:
 
     /*!
-     *  \brief  32-bit FIR filtering function
-     *  \param[input] pointer to the input data array
-     *  \return the function returns FIR filtering result
+     *  \brief  memory allocation function
+     *  \param[cf] - pointer to the filter coefficients
+     *  \param[N ] - filter coefficients number
+     *  \param[L ] - FFT size , power of 2 not less than 2 * N ( 0 - the size with the minimum cost per output sample )
+     *  \return the function returns 1 if the engine is ready and 0 otherwise
     */
-    inline __type filt( __type *input )
+    __ix32 allocate( const __type *cf , __ix32 N , __ix32 L = 0 )
     {
-        m_bx( input );
-        m_out = 0;
-        for ( __ix32 n = m_sp.order ; n >= 0; n--) m_out += m_bx[ n ] * m_cf[n];
-        return m_out;
+        deallocate();
+        if( cf == 0 || N < 1 ) return 0;
+
+        // the FFT size with the minimum cost per output sample:
+        if( L < 2 * N || ( L & ( L - 1 ) ) != 0 ) L = best_size( N );
+
+        m_N    = N;
+        m_L    = L;
+        m_B    = L - N + 1;
+        m_cost = fft_cost( L ) * __FIR_OLS_BUTTERFLY_COST;
+        m_H    = ( fcomplex< __type >* ) calloc( L / 2 + 1 , sizeof ( fcomplex< __type > ) );
+        m_X    = ( fcomplex< __type >* ) calloc( L / 2 + 1 , sizeof ( fcomplex< __type > ) );
+        m_x    = ( __type* ) calloc( L , sizeof ( __type ) );
+        m_hx   = ( __type* ) calloc( N , sizeof ( __type ) );
+        if( m_H == 0 || m_X == 0 || m_x == 0 || m_hx == 0 || !m_fft.allocate( L ) ) { deallocate(); return 0; }
+
+        // coefficients spectrum , the 1 / L inverse transform scaling is included into the inverse FFT:
+        memcpy( m_x , cf , N * sizeof ( __type ) );
+        m_fft.forward( m_x , m_H );
+        return 1;
     }
 
     /*!
-     *  \brief  64-bit FIR filtering function
-     *  \param[input] pointer to the input data array
-     *  \return the function returns FIR filtering result
+     *  \brief  memory allocation function
+     *  \param[sp  ] - filter specification data structure
+     *  \param[wind] - window function object ( the window is initialized with the filter length if it is not ready )
+     *  \return the function designs the filter the same way the fir class does and returns 1 if the engine is ready and 0 otherwise
     */
-    inline __type filt( __fx64 *input )
+    __ix32 allocate( const fir_sp &sp , wind_fcn &wind )
     {
-        m_bx( input );
-        m_out = 0;
-        for ( __ix32 n = m_sp.order ; n >= 0; n--) m_out += m_bx[ n ] * m_cf[n];
-        return m_out;
+        if( !wind.is_ready() ) wind.init( sp.N );
+        __type *cf = __fir_wind_design__< __type >( sp , wind );
+        __ix32 ok  = allocate( cf , sp.N );
+        if( cf != 0 ) free( cf );
+        return ok;
+    }
+
+    /*! \brief memory deallocation function */
+    __void deallocate()
+    {
+        if( m_H  != 0 ) { free( m_H  ); m_H  = 0; }
+        if( m_X  != 0 ) { free( m_X  ); m_X  = 0; }
+        if( m_x  != 0 ) { free( m_x  ); m_x  = 0; }
+        if( m_hx != 0 ) { free( m_hx ); m_hx = 0; }
+        m_fft.deallocate();
+        m_N = m_L = m_B = 0;
+        m_cost = 0;
     }
 
     /*!
-     *  \brief  FIR filtering function
-     *  \return the function returns FIR filtering result
+     *  \brief  engines swapping function
+     *  \param[other] - engine to swap with
+     *  \details the function exchanges the coefficients spectra and the buffers of the engines without the memory allocation
     */
-    inline __type filt()
+    __void swap( fir_ols &other )
     {
-        m_out = 0;
-        for ( __ix32 n = m_sp.order ; n >= 0; n--) m_out += m_bx[ n ] * m_cf[n];
-        return m_out;
+        __ix32 N = m_N , L = m_L , B = m_B;
+        m_N = other.m_N; other.m_N = N;
+        m_L = other.m_L; other.m_L = L;
+        m_B = other.m_B; other.m_B = B;
+
+        fcomplex< __type > *H = m_H , *X = m_X;
+        m_H = other.m_H; other.m_H = H;
+        m_X = other.m_X; other.m_X = X;
+
+        __type *x = m_x , *hx = m_hx;
+        m_x  = other.m_x;  other.m_x  = x;
+        m_hx = other.m_hx; other.m_hx = hx;
+
+        __fx64 cost = m_cost;
+        m_cost = other.m_cost; other.m_cost = cost;
+        m_fft.swap( other.m_fft );
     }
 
+    /*! \brief default constructor */
+    fir_ols() : m_N( 0 ) , m_L( 0 ) , m_B( 0 ) , m_H( 0 ) , m_X( 0 ) , m_x( 0 ) , m_hx( 0 ) , m_cost( 0 ) {}
+
+    /*! \brief destructor */
+    ~fir_ols() { deallocate(); }
+
+    /*! \brief engine readiness flag getting function */
+    inline __bool is_ready() { return m_B > 0; }
+
+    /*! \brief block size getting function */
+    inline __ix32 block() { return m_B; }
+
+    /*! \brief FFT size getting function */
+    inline __ix32 fft_size() { return m_L; }
+
     /*!
-     *  \brief 32-bit FIR filtering () operator
-     *  \param[input] pointer to the input data
-     *  \return the () operator calls filt( __type *input ) function that returns FIR filtering result
+     *  \brief  direct form and overlap-save costs comparison function
+     *  \param[n] - number of the samples to filter
+     *  \return the function returns true if the overlap-save filtering of n samples is cheaper than the direct form one
     */
-    inline __type operator() ( __type *input ) { return filt( input ); }
+    inline __bool cheaper( __ix32 n ) { return is_ready() && ( ( n + m_B - 1 ) / m_B ) * m_cost < ( __fx64 )n * m_N; }
 
     /*!
-     *  \brief 64-bit FIR filtering () operator
-     *  \param[input] pointer to the input data
-     *  \return the () operator calls filt( __type *input ) function that returns FIR filtering result
+     *  \brief  not allocated engine costs comparison function
+     *  \param[N] - filter coefficients number
+     *  \param[n] - number of the samples to filter
+     *  \return the function returns true if the overlap-save filtering of n samples with the FFT size chosen by
+     *          the allocate( cf , N ) function would be cheaper than the direct form one , so the engine is worth
+     *          allocating
     */
-    inline __type operator() ( __fx64 *input ) { return filt( input ); }
+    static __bool cheaper( __ix32 N , __ix32 n )
+    {
+        __ix32 L = best_size( N ) , B = L - N + 1;
+        return ( ( n + B - 1 ) / B ) * fft_cost( L ) * __FIR_OLS_BUTTERFLY_COST < ( __fx64 )n * N;
+    }
+
+    /*!
+     *  \brief  block filtering function
+     *  \param[hist] - pointer to the N - 1 previous input samples , oldest first
+     *  \param[in  ] - pointer to the input samples block
+     *  \param[out ] - pointer to the output samples block
+     *  \param[n   ] - number of the samples , n <= block()
+     *  \details the history is not updated
+    */
+    __void filt_block( const __type *hist , const __type *in , __type *out , __ix32 n )
+    {
+        memcpy( m_x , hist , ( m_N - 1 ) * sizeof ( __type ) );
+        memcpy( m_x + m_N - 1 , in , n * sizeof ( __type ) );
+        memset( m_x + m_N - 1 + n , 0 , ( m_B - n ) * sizeof ( __type ) );
+
+        m_fft.forward( m_x , m_X );
+        for( __ix32 k = 0 ; k <= m_L / 2 ; k++ )
+        {
+            __type re = m_X[k].re * m_H[k].re - m_X[k].im * m_H[k].im;
+            __type im = m_X[k].re * m_H[k].im + m_X[k].im * m_H[k].re;
+            m_X[k].re = re;
+            m_X[k].im = im;
+        }
+        m_fft.inverse( m_X , m_x );
+
+        memcpy( out , m_x + m_N - 1 , n * sizeof ( __type ) );
+    }
+
+    /*!
+     *  \brief  standalone filtering function
+     *  \param[in ] - pointer to the input samples
+     *  \param[out] - pointer to the output samples
+     *  \param[n  ] - number of the samples
+     *  \details the input history is kept between the calls , so the stream may be split into the arbitrary blocks
+    */
+    __void process( const __type *in , __type *out , __ix32 n )
+    {
+        for( __ix32 i = 0 ; i < n ; i += m_B )
+        {
+            __ix32 m = ( n - i < m_B ) ? ( n - i ) : m_B , h = m_N - 1;
+            filt_block( m_hx , in + i , out + i , m );
+
+            // history update:
+            if( m >= h )
+            {
+                memcpy( m_hx , in + i + m - h , h * sizeof ( __type ) );
+            }
+            else
+            {
+                memmove( m_hx , m_hx + m , ( h - m ) * sizeof ( __type ) );
+                memcpy ( m_hx + h - m , in + i , m * sizeof ( __type ) );
+            }
+        }
+    }
 };
 
-/*! \brief 64-bit floating point FIR filter */
-template<> class fir<__fx64>
+/*!
+ *  \brief FIR filter retuning states
+ *  \details fir_retune_idle  - the pending coefficients set is owned by the retune() caller         \newline
+ *           fir_retune_ready - the pending set is published and is waiting for the filtering thread  \newline
+ *           fir_retune_busy  - the filtering thread has switched the sets and crossfades the outputs
+*/
+enum fir_retune { fir_retune_idle , fir_retune_ready , fir_retune_busy };
+
+/*!
+ *  \brief FIR filter retuning state flag
+ *  \details The flag is atomic if the standard library is available. Otherwise the retuning function must be
+ *           called from the filtering context ( the same thread or the interrupt priority level ).
+*/
+class fir_retune_flag
 {
-    typedef __fx64 __type ;
+#ifndef __ALG_PLATFORM
+    std::atomic< __ix32 > m_state;
+#else
+    volatile __ix32 m_state;
+#endif
+
+public:
+
+    /*! \brief default constructor */
+    fir_retune_flag() : m_state( fir_retune_idle ) {}
+
+    /*! \brief state getting function ( acquire ) */
+#ifndef __ALG_PLATFORM
+    inline __ix32 load() { return m_state.load( std::memory_order_acquire ); }
+#else
+    inline __ix32 load() { return m_state; }
+#endif
+
+    /*! \brief state setting function ( release ) */
+#ifndef __ALG_PLATFORM
+    inline void store( __ix32 state ) { m_state.store( state , std::memory_order_release ); }
+#else
+    inline void store( __ix32 state ) { m_state = state; }
+#endif
+
+    /*!
+     *  \brief  state transition function
+     *  \param[from] expected state
+     *  \param[to  ] new state
+     *  \return the function sets the new state and returns true if the current state is equal to the expected one
+    */
+#ifndef __ALG_PLATFORM
+    inline bool exchange( __ix32 from , __ix32 to ) { return m_state.compare_exchange_strong( from , to , std::memory_order_acq_rel ); }
+#else
+    inline bool exchange( __ix32 from , __ix32 to ) { if( m_state != from ) return false; m_state = to; return true; }
+#endif
+};
+
+/*! \brief template FIR filter class */
+template< typename T > class fir;
+
+/*! \brief template comb FIR filter class */
+template< typename T > class fcomb;
+
+/*! \brief template equalized comb FIR filter class */
+template< typename T > class fcombeq;
+
+/*! \brief template sparse FIR filter class */
+template< typename T > class sparse_fir;
+
+/*! \brief template polyphase decimating FIR filter class */
+template< typename T > class fir_decimator;
+
+/*! \brief template polyphase rational resampler class */
+template< typename T > class fir_resampler;
+
+/*! \brief template multichannel FIR filter bank class */
+template< typename T > class fir_bank;
+
+/*! \brief template half-band decimating FIR filter class */
+template< typename T > class halfband_fir;
+
+/*! \brief template half-band multistage decimation chain class */
+template< typename T > class halfband_chain;
+
+/*! \brief template CIC decimator with the FIR compensation class */
+template< typename T > class cic_decimator;
+
+/*! \brief template compile-time FIR filter class */
+template< typename T , __ix32 Order , __ix64 FsMilli , __ix64 FcMilli , wind_type Window = wind_hamming ,
+          fir_type Type = lowpass_fir , __ix64 BWMilli = 0 , __ix32 Scale = 1 > class static_fir;
+
+/*! \brief 32-bit floating point FIR filter */
+template<> class fir<__fx32>
+{
+    typedef __fx32 __type ;
     typedef bool   __bool ;
     typedef void   __void ;
 
@@ -739,8 +1416,99 @@ template<> class fir<__fx64>
     /*! \brief lowpass coefficients buffer */
     __type *m_cf;
 
+    /*! \brief lowpass time-reversed coefficients buffer ( m_cfr[ i ] = m_cf[ order - i ] ) */
+    __type *m_cfr;
+
     /*! \brief lowpass input buffer */
-    mirror_ring_buffer< __type > m_bx;
+    mirror_ring_buffer< __type , __DELAY_LINE_CAPACITY > m_bx;
+
+    /*! \brief decimation phase counter */
+    __ix32 m_phase;
+
+    /*! \brief coefficients folding mode */
+    fir_fold m_fold;
+
+    /*! \brief phase response type */
+    fir_phase m_phase_type;
+
+    /*! \brief coefficients folding sign ( +1 - symmetric , -1 - antisymmetric , 0 - the folding is not used ) */
+    __ix32 m_sign;
+
+    /*! \brief overlap-save fast convolution engine for the long filters block processing */
+    fir_ols< __type > m_ols;
+
+    /*!
+     *  \brief pending specification , coefficients , folding sign and overlap-save engine prepared by retune()
+     *  \details the pending set is owned by the retune() caller in the idle state , so the pending specification
+     *           keeps the allocated filter order for the retune() checks ( zero order - the filter is not allocated )
+    */
+    fir_sp   m_sp_next;
+    __type  *m_cf_next;
+    __type  *m_cfr_next;
+    __ix32   m_sign_next;
+    fir_ols< __type > m_ols_next;
+
+    /*! \brief retuning state */
+    fir_retune_flag m_retune;
+
+    /*! \brief pending crossfade length , current crossfade length and position , samples */
+    __ix32 m_fade_next , m_fade_len , m_fade_pos;
+
+    /*!
+     *  \brief coefficients sets switching function
+     *  \details the function is called by the filtering thread , it exchanges the active and the pending sets
+     *           keeping the input buffer and starts the crossfade
+    */
+    __void retune_switch()
+    {
+        if( !m_retune.exchange( fir_retune_ready , fir_retune_busy ) ) return;
+
+        fir_sp sp = m_sp;
+        m_sp      = m_sp_next;
+        m_sp_next = sp;
+
+        __type *cf = m_cf , *cfr = m_cfr;
+        m_cf      = m_cf_next;
+        m_cfr     = m_cfr_next;
+        m_cf_next  = cf;
+        m_cfr_next = cfr;
+
+        __ix32 sign = m_sign;
+        m_sign      = m_sign_next;
+        m_sign_next = sign;
+        m_ols.swap( m_ols_next );
+
+        // the old set is kept until the crossfade is over:
+        m_fade_len = m_fade_next;
+        m_fade_pos = 0;
+        if( m_fade_len == 0 ) m_retune.store( fir_retune_idle );
+    }
+
+    /*!
+     *  \brief  coefficients folding mode getting function
+     *  \return the function returns the folding mode applied to the coefficients , the minimum phase coefficients
+     *          are not symmetric , so they are never folded even if the folding is forced
+    */
+    inline fir_fold fold_mode() { return ( m_phase_type == fir_minimum_phase ) ? fir_fold_off : m_fold; }
+
+    /*!
+     *  \brief  crossfade function
+     *  \param[y] - new coefficients filtering result
+     *  \return the function returns y_old + ( y - y_old ) * k / K , k = 1 ... K , where y_old is the old coefficients
+     *          filtering result , and releases the old set after the K-th sample
+    */
+    __type retune_fade( __type y )
+    {
+        __type y0 = ( m_sign_next != 0 ) ? __fold_dot__( m_bx.view( m_sp_next.N ).data , m_cfr_next , m_sp_next.N , m_sign_next )
+                                         : __dot__     ( m_bx.view( m_sp_next.N ).data , m_cfr_next , m_sp_next.N );
+        y = y0 + ( y - y0 ) * ( __type )( ++m_fade_pos ) / ( __type )m_fade_len;
+        if( m_fade_pos >= m_fade_len )
+        {
+            m_fade_len = 0;
+            m_retune.store( fir_retune_idle );
+        }
+        return y;
+    }
 
 public:
 
@@ -753,35 +1521,35 @@ public:
     /*! \brief lowpass memory allocation function */
     __ix32 allocate()
     {
-        switch ( m_sp.type )
-        {
-            case fir_type::lowpass_fir:
-            m_cf = __fir_wind_digital_lp__< __type >( m_sp.Fs , m_sp.Fc , m_sp.order , m_sp.scale , m_wind );
-            break;
-
-            case fir_type::highpass_fir:
-            m_cf = __fir_wind_digital_hp__< __type >( m_sp.Fs , m_sp.Fc , m_sp.order , m_sp.scale , m_wind );
-            break;
+        m_cf = __fir_wind_design__< __type >( m_sp , m_wind );
+        if( m_cf != 0 && m_phase_type == fir_minimum_phase ) __fir_min_phase__< __type >( m_cf , m_sp.N );
 
-            case fir_type::bandpass_fir:
-            m_cf = __fir_wind_digital_bp__< __type >( m_sp.Fs , m_sp.Fc , m_sp.BW , m_sp.order , m_sp.scale , m_wind );
-            break;
+        // time-reversed coefficients , so the coefficients and the buffer history are both read forward:
+        m_cfr = ( m_cf != 0 ) ? ( __type* ) calloc( m_sp.N , sizeof ( __type ) ) : 0;
+        if( m_cfr != 0 ) for( __ix32 n = 0 ; n <= m_sp.order ; n++ ) m_cfr[ n ] = m_cf[ m_sp.order - n ];
 
-            case fir_type::bandstop_fir:
-            m_cf = __fir_wind_digital_bs__< __type >( m_sp.Fs , m_sp.Fc , m_sp.BW , m_sp.order , m_sp.scale , m_wind );
-            break;
-        }
+        // the folded kernel halves the multiplications for the linear-phase filters:
+        m_sign = __fir_fold__< __type >( m_cf , m_cfr , m_sp.N , fold_mode() , 1e-5 );
 
         m_bx.allocate( m_sp.N + 1 );
-        return ( m_cf != 0 );
+        if( m_cf != 0 && m_cfr != 0 ) m_sp_next = m_sp;
+        return ( m_cf != 0 && m_cfr != 0 );
     }
 
     /*! \brief lowpass memory deallocation function */
     __void deallocate()
     {
-        if( m_cf != 0 ) { free( m_cf ); m_cf = nullptr; }
-        m_bx  .deallocate();
+        if( m_cf  != 0 ) { free( m_cf  ); m_cf  = nullptr; }
+        if( m_cfr != 0 ) { free( m_cfr ); m_cfr = nullptr; }
+        m_bx.deallocate();
+        m_ols.deallocate();
         m_wind.deallocate();
+        if( m_cf_next  != 0 ) { free( m_cf_next  ); m_cf_next  = nullptr; }
+        if( m_cfr_next != 0 ) { free( m_cfr_next ); m_cfr_next = nullptr; }
+        m_ols_next.deallocate();
+        m_sp_next = fir_sp();
+        m_retune.store( fir_retune_idle );
+        m_fade_len = m_fade_pos = 0;
     }
 
     /*! \brief Lowpass initialization function
@@ -796,7 +1564,12 @@ public:
     {
         m_sp  = fir_sp{ Fs , Fn , Fc , -1 , 1 / Fs , order , order + 1 , scale , fir_type::lowpass_fir };
         m_cf  = 0;
+        m_cfr = 0;
         m_out = 0;
+        m_phase = 0;
+        m_fold  = fir_fold_off;
+        m_phase_type = fir_linear_phase;
+        m_sign  = 0;
         m_wind.init( m_sp.N );
     }
 
@@ -812,7 +1585,12 @@ public:
     {
         m_sp  = fir_sp{ Fs , Fn , Fp , -1 , 1 / Fs , order , order + 1 , scale , fir_type::highpass_fir };
         m_cf  = 0;
+        m_cfr = 0;
         m_out = 0;
+        m_phase = 0;
+        m_fold  = fir_fold_off;
+        m_phase_type = fir_linear_phase;
+        m_sign  = 0;
         m_wind.init( m_sp.N );
     }
 
@@ -829,7 +1607,12 @@ public:
     {
         m_sp  = fir_sp{ Fs , Fn , Fp , BW , 1 / Fs , order , order + 1 , scale , fir_type::bandpass_fir };
         m_cf  = 0;
+        m_cfr = 0;
         m_out = 0;
+        m_phase = 0;
+        m_fold  = fir_fold_off;
+        m_phase_type = fir_linear_phase;
+        m_sign  = 0;
         m_wind.init( m_sp.N );
     }
 
@@ -846,7 +1629,12 @@ public:
     {
         m_sp  = fir_sp{ Fs , Fn , Fc , BW , 1 / Fs , order , order + 1 , scale , fir_type::bandstop_fir };
         m_cf  = 0;
+        m_cfr = 0;
         m_out = 0;
+        m_phase = 0;
+        m_fold  = fir_fold_off;
+        m_phase_type = fir_linear_phase;
+        m_sign  = 0;
         m_wind.init( m_sp.N );
     }
 
@@ -855,8 +1643,19 @@ public:
     {
         m_sp  = fir_sp{ 4000 , 50 , 100 , -1 , 1 / 4000 , 80 , 80 + 1 , 1 , fir_type::lowpass_fir };
         m_cf  = 0;
+        m_cfr = 0;
         m_out = 0;
+        m_phase = 0;
+        m_fold  = fir_fold_off;
+        m_phase_type = fir_linear_phase;
+        m_sign  = 0;
         m_wind.init( m_sp.N  );
+
+        m_sp_next   = fir_sp();
+        m_cf_next   = 0;
+        m_cfr_next  = 0;
+        m_sign_next = 0;
+        m_fade_next = m_fade_len = m_fade_pos = 0;
     }
 
     /*! \brief  destructor */
@@ -867,7 +1666,15 @@ public:
      *  \param[F] input frequency
      *  \return the function returns fir_fr data structure
     */
-    inline fir_fr< __fx64 > freq_resp( __type F ) { return __fir_freq_resp__< __fx64 , __type >( m_sp.Fs , F , m_sp.order , m_cf ); }
+    inline fir_fr< __fx64 > freq_resp( __fx64 F ) { return __fir_freq_resp__< __fx64 , __type >( m_sp.Fs , F , m_sp.order , m_cf ); }
+
+    /*!
+     *  \brief  dense frequency response computation function
+     *  \param[fr     ] frequency response grid
+     *  \param[npoints] number of the grid points over [ 0 ; Fs / 2 ] , rounded up to 2^m + 1
+     *  \return the function computes the response by means of one real FFT and returns the number of the grid points
+    */
+    inline __ix32 freq_resp_grid( fir_fr_grid &fr , __ix32 npoints ) { return __fir_freq_resp_grid__< __type >( m_sp.Fs , m_sp.order , m_cf , fr , npoints ); }
 
     /*!
      *  \brief  FIR pulse response getting function
@@ -876,6 +1683,187 @@ public:
     */
     inline __type get_coeff( __ix32 n ) { return ( n <= m_sp.order ) ? m_cf[ n ] : 1e6; }
 
+    /*!
+     *  \brief folding mode setting function
+     *  \param[mode] - coefficients folding mode
+     *  \details the folding is disabled by default : it halves the multiplications , but the extra mirrored loads
+     *           make it slower than the direct dot product for the most of the orders ( example12 ) , so it is enabled
+     *           explicitly. The mode is applied at the memory allocation or immediately if the filter is already allocated
+    */
+    inline __void set_fold( fir_fold mode )
+    {
+        m_fold = mode;
+        if( m_cf != 0 ) m_sign = __fir_fold__< __type >( m_cf , m_cfr , m_sp.N , fold_mode() , 1e-5 );
+
+        // the forced folding changes the coefficients , so the spectrum is recomputed:
+        if( m_ols.is_ready() ) m_ols.allocate( m_cf , m_sp.N );
+    }
+
+    /*!
+     *  \brief  folding sign getting function
+     *  \return the function returns +1 for the folded symmetric filter , -1 for the folded antisymmetric filter
+     *          and 0 if the folding is not used
+    */
+    inline __ix32 get_fold() { return m_sign; }
+
+    /*!
+     *  \brief phase response type setting function
+     *  \param[type] - phase response type
+     *  \details the type is applied at the coefficients design , the minimum phase filter has
+     *           the same amplitude response and the lower group delay , but the phase response is not linear
+    */
+    inline __void set_phase( fir_phase type ) { m_phase_type = type; }
+
+    /*!
+     *  \brief  phase response type getting function
+     *  \return the function returns the phase response type
+    */
+    inline fir_phase get_phase() { return m_phase_type; }
+
+    /*!
+     *  \brief  group delay computation function
+     *  \param[F] input frequency , Hz
+     *  \return the function returns the filter group delay at the frequency F , s ( order / 2 / Fs for the linear phase filter )
+    */
+    inline __fx64 group_delay( __fx64 F ) { return __fir_group_delay__< __type >( m_sp.Fs , F , m_sp.order , m_cf ) / m_sp.Fs; }
+
+    /*!
+     *  \brief  specification getting function
+     *  \return the function returns the active filter specification
+    */
+    inline fir_sp get_sp() { return m_sp; }
+
+    /*!
+     *  \brief  in-place retuning function
+     *  \param[sp] - new filter specification ( the order must be the same )
+     *  \param[K ] - crossfade length , samples ( 0 - the coefficients are switched at once )
+     *  \return The function designs the new coefficients with the current window type , prepares the pending
+     *          folding and overlap-save engine and publishes them. The filtering thread switches to the new set
+     *          at the next filtering call keeping the input buffer , so the retuning needs neither the buffer
+     *          reallocation nor the heap operations in the filtering thread , and the old filter output is faded
+     *          into the new one over K samples. The function may be called from the control thread concurrently
+     *          with the filtering. The not yet switched set is replaced by the newer one. The coefficients and
+     *          the frequency response getting functions read the active set and are not synchronized.
+     *          The function returns 1 if the new set is published and 0 if the filter is not allocated , the order
+     *          differs , the design fails or the previous crossfade is not finished yet.
+    */
+    __ix32 retune( const fir_sp &sp , __ix32 K = 0 )
+    {
+        // the not yet switched set is taken back , the set being crossfaded is not touched:
+        __ix32 state = m_retune.load();
+        if( state == fir_retune_busy ) return 0;
+        if( state == fir_retune_ready && !m_retune.exchange( fir_retune_ready , fir_retune_idle ) ) return 0;
+        if( m_sp_next.N == 0 || sp.order != m_sp_next.order || sp.N != m_sp_next.N ) return 0;
+
+        // the new coefficients are designed with the current window function type:
+        wind_fcn wind;
+        wind.init( sp.N );
+        wind.compute( m_wind.type() , m_wind.param() );
+        __type *cf = __fir_wind_design__< __type >( sp , wind );
+        if( cf == 0 ) return 0;
+        if( m_phase_type == fir_minimum_phase ) __fir_min_phase__< __type >( cf , sp.N );
+
+        if( m_cf_next  != 0 ) free( m_cf_next );
+        if( m_cfr_next != 0 ) free( m_cfr_next );
+        m_cf_next  = cf;
+        m_cfr_next = ( __type* ) calloc( sp.N , sizeof ( __type ) );
+        if( m_cfr_next == 0 ) return 0;
+        for( __ix32 n = 0 ; n <= sp.order ; n++ ) m_cfr_next[ n ] = m_cf_next[ sp.order - n ];
+        m_sign_next = __fir_fold__< __type >( m_cf_next , m_cfr_next , sp.N , fold_mode() , 1e-5 );
+
+        // the pending engine is prepared if the active set uses the block filtering engine:
+        if( m_ols.is_ready() ) m_ols_next.allocate( m_cf_next , sp.N );
+
+        m_sp_next   = sp;
+        m_fade_next = ( K > 0 ) ? K : 0;
+        m_retune.store( fir_retune_ready );
+        return 1;
+    }
+
+    /*!
+     *  \brief  FIR filter state saving function
+     *  \param[blob] pointer to the state memory block or null pointer to compute the state size only
+     *  \return the function stores the filter specification , window and phase types , coefficients , input buffer and output
+     *          into the state memory block and returns the state size , bytes
+    */
+    __ix32 save_state( void *blob )
+    {
+        char  *data = ( char* )blob;
+        __ix32 pos  = 0;
+        if( m_cf == 0 ) return 0;
+
+        // the window type is kept , so the restored filter is redesigned with the same window:
+        wind_type wt = m_wind.type();
+        __fx64    wp = m_wind.param();
+        __state_begin__( data , pos , "fir<fx32>" );
+        __state_put__( data , pos , &m_sp );
+        __state_put__( data , pos , &wt );
+        __state_put__( data , pos , &wp );
+        __state_put__( data , pos , &m_phase_type );
+        __state_put__( data , pos , m_cf , m_sp.N );
+        __buff_put__ ( data , pos , m_bx );
+        __state_put__( data , pos , &m_out );
+        __state_put__( data , pos , &m_phase );
+        __state_put__( data , pos , &m_fold  );
+        return __state_end__( data , pos );
+    }
+
+    /*!
+     *  \brief  FIR filter state loading function
+     *  \param[blob] pointer to the state memory block
+     *  \param[size] available memory size , bytes
+     *  \return the function restores the filter without the filter redesign and returns the number of the bytes read
+     *          or 0 if the state can not be restored. The filter is not changed if the state is not valid.
+    */
+    __ix32 load_state( const void *blob , __ix32 size )
+    {
+        const char *data = ( const char* )blob;
+        __ix32    pos = 0 , end = __state_open__( data , size , pos , "fir<fx32>" ) , phase = 0;
+        fir_sp    sp;
+        __ix32    wt   = wind_none;
+        __fx64    wp   = 0;
+        __ix32    pt   = fir_linear_phase;
+        __ix32    fold = fir_fold_off;
+        __type    out  = 0;
+        if( end == 0 ) return 0;
+
+        if( !__state_get__( data , end , pos , &sp ) || !__state_get__( data , end , pos , &wt ) ||
+            !__state_get__( data , end , pos , &wp ) || !__state_get__( data , end , pos , &pt ) ) return 0;
+        if( sp.N <= 0 || sp.order != sp.N - 1 || !__state_room__< __type >( end , pos , sp.N ) ) return 0;
+
+        // the state is restored into the temporaries , that replace the filter members only on success:
+        mirror_ring_buffer< __type , __DELAY_LINE_CAPACITY > bx;
+        __type *cf  = ( __type* ) calloc( sp.N , sizeof ( __type ) );
+        __type *cfr = ( __type* ) calloc( sp.N , sizeof ( __type ) );
+        __ix32  ok  = cf && cfr && bx.allocate( sp.N + 1 ) &&
+                      __state_get__( data , end , pos , cf , sp.N ) && __buff_get__( data , end , pos , bx ) &&
+                      __state_get__( data , end , pos , &out ) && __state_get__( data , end , pos , &phase ) &&
+                      __state_get__( data , end , pos , &fold ) && ( pos == end ) &&
+                      ( pt == fir_linear_phase || pt == fir_minimum_phase ) && ( wt >= wind_none && wt <= wind_tukey ) &&
+                      ( fold >= fir_fold_auto && fold <= fir_fold_off );
+        if( !ok )
+        {
+            free( cf );
+            free( cfr );
+            return 0;
+        }
+
+        deallocate();
+        m_sp         = m_sp_next = sp;
+        m_cf         = cf;
+        m_cfr        = cfr;
+        m_phase_type = ( fir_phase )pt;
+        m_out        = out;
+        m_phase      = phase;
+        m_fold       = ( fir_fold )fold;
+        m_bx.swap( bx );
+        m_wind.init( m_sp.N );
+        m_wind.restore( ( wind_type )wt , wp );
+        for( __ix32 n = 0 ; n <= m_sp.order ; n++ ) m_cfr[ n ] = m_cf[ m_sp.order - n ];
+        m_sign = __fir_fold__< __type >( m_cf , m_cfr , m_sp.N , fold_mode() , 1e-5 );
+        return end;
+    }
+
     /*!
      *  \brief  32-bit FIR filter buffer filling function
      *  \param[input] pointer to the input data array
@@ -884,611 +1872,4332 @@ public:
     inline void fill_fir_buff( __type *input ) { m_bx( input ); }
 
     /*!
-     *  \brief  FIR filtering function
+     *  \brief  64-bit FIR filter buffer filling function
+     *  \param[input] pointer to the input data array
+     *  \return the function returns FIR filtering result
+    */
+    inline void fill_fir_buff( __fx64 *input ) { m_bx( input ); }
+
+    /*!
+     *  \brief  32-bit FIR filtering function
      *  \param[input] pointer to the input data array
      *  \return the function returns FIR filtering result
     */
     inline __type filt( __type *input )
     {
         m_bx( input );
-        m_out = 0;
-        for ( __ix32 n = m_sp.order ; n >= 0; n--) m_out += m_bx[ n ] * m_cf[n];
-        return m_out;
+        return filt();
     }
 
     /*!
-     *  \brief  FIR filtering function
+     *  \brief  64-bit FIR filtering function
+     *  \param[input] pointer to the input data array
      *  \return the function returns FIR filtering result
     */
-    inline __type filt()
+    inline __type filt( __fx64 *input )
     {
-        m_out = 0;
-        for ( __ix32 n = m_sp.order ; n >= 0; n--) m_out += m_bx[ n ] * m_cf[n];
-        return m_out;
+        m_bx( input );
+        return filt();
     }
 
     /*!
-     *  \brief  FIR filtering () operator
+     *  \brief  FIR filtering function
+     *  \return the function returns FIR filtering result
+    */
+    inline __type filt()
+    {
+        if( m_retune.load() == fir_retune_ready ) retune_switch();
+
+        m_out = ( m_sign != 0 ) ? __fold_dot__( m_bx.view( m_sp.N ).data , m_cfr , m_sp.N , m_sign )
+                                : __dot__     ( m_bx.view( m_sp.N ).data , m_cfr , m_sp.N );
+        if( m_fade_len > 0 ) m_out = retune_fade( m_out );
+        return m_out;
+    }
+
+    /*!
+     *  \brief  block filtering preparation function
+     *  \param[n] - expected block size , samples
+     *  \return The function allocates the overlap-save engine if the filter order is not less than __FIR_OLS_MIN_ORDER and
+     *          the blocks of n samples are cheaper to filter by means of the fast convolution. The function returns 1 if the
+     *          engine is ready. It must be called from the filtering thread before the streaming and not concurrently with
+     *          the retuning , so the process( in , out , n ) function does no heap operations. The engine is kept by
+     *          the retuning and is released by the deallocation and the state loading.
+    */
+    __ix32 prepare_block( __ix32 n )
+    {
+        if( m_cf == 0 || n <= 0 || m_sp.order < __FIR_OLS_MIN_ORDER || !fir_ols< __type >::cheaper( m_sp.N , n ) ) return m_ols.is_ready();
+        if( !m_ols.is_ready() ) m_ols.allocate( m_cf , m_sp.N );
+        return m_ols.is_ready();
+    }
+
+    /*!
+     *  \brief  FIR block filtering function
+     *  \param[in ] pointer to the input samples block
+     *  \param[out] pointer to the output samples block
+     *  \param[n  ] number of the samples
+     *  \details the function filters the whole block: out[ i ] is the filtering result for in[ i ].
+     *           The long blocks of the long filters are filtered by means of the overlap-save fast convolution
+     *           if the engine is prepared by the prepare_block( n ) function and it is cheaper than the direct form.
+     *           The function does no heap operations. The input buffer is used as the convolution history ,
+     *           so the direct form and the fast convolution may be interleaved.
+    */
+    inline void process( const __type *in , __type *out , __ix32 n )
+    {
+        if( m_retune.load() == fir_retune_ready ) retune_switch();
+
+        // the crossfade is computed by the direct form:
+        if( n > 0 && m_fade_len == 0 && m_ols.cheaper( n ) )
+        {
+            for( __ix32 i = 0 ; i < n ; i += m_ols.block() )
+            {
+                __ix32 m = ( n - i < m_ols.block() ) ? ( n - i ) : m_ols.block();
+                m_ols.filt_block( m_bx.view( m_sp.N - 1 ).data , in + i , out + i , m );
+                m_bx.fill_block( in + i , m );
+            }
+            m_out = out[ n - 1 ];
+            return;
+        }
+
+        for( __ix32 i = 0 ; i < n ; i++ )
+        {
+            m_bx.fill_buff( &in[i] );
+            out[i] = filt();
+        }
+    }
+
+    /*!
+     *  \brief  FIR decimating block filtering function
+     *  \param[in    ] pointer to the input samples block
+     *  \param[n     ] number of the input samples
+     *  \param[out   ] pointer to the output samples
+     *  \param[stride] decimation factor ( one output sample per stride input samples ) , stride >= 1
+     *  \return the function returns the number of the computed output samples ( 0 if the stride is less than 1 )
+     *  \details the input samples between the output samples are copied into the buffer by blocks and
+     *           the convolution is computed only for the kept output samples. The decimation phase is
+     *           kept between the calls , so the block size does not need to be a multiple of the stride.
+    */
+    inline __ix32 process_decimate( const __type *in , __ix32 n , __type *out , __ix32 stride )
+    {
+        __ix32 i = 0 , k = 0;
+        if( stride < 1 ) return 0;
+
+        // the stride may be decreased since the last call , then the next input sample is the output one:
+        if( m_phase >= stride ) m_phase = stride - 1;
+        while( i < n )
+        {
+            // input samples left before the next output sample:
+            __ix32 m = ( stride - m_phase < n - i ) ? ( stride - m_phase ) : ( n - i );
+            m_bx.fill_block( &in[i] , m );
+            i       += m;
+            m_phase += m;
+
+            // output sample computation:
+            if( m_phase >= stride )
+            {
+                out[k++] = filt();
+                m_phase  = 0;
+            }
+        }
+        return k;
+    }
+
+    /*!
+     *  \brief 32-bit FIR filtering () operator
      *  \param[input] pointer to the input data
      *  \return the () operator calls filt( __type *input ) function that returns FIR filtering result
     */
     inline __type operator() ( __type *input ) { return filt( input ); }
+
+    /*!
+     *  \brief 64-bit FIR filtering () operator
+     *  \param[input] pointer to the input data
+     *  \return the () operator calls filt( __type *input ) function that returns FIR filtering result
+    */
+    inline __type operator() ( __fx64 *input ) { return filt( input ); }
 };
 
-/*! \brief 32-bit floating point comb FIR filter */
-template<> class fcomb<__fx32>
+/*! \brief 64-bit floating point FIR filter */
+template<> class fir<__fx64>
 {
-    typedef __fx32 __type ;
-private:
+    typedef __fx64 __type ;
+    typedef bool   __bool ;
+    typedef void   __void ;
 
-    /*! \brief input signal nominal frequency  , Hz */
-    __fx64 m_Fn;
-    /*! \brief input signal sampling frequency , Hz */
-    __fx64 m_Fs;
-    /*! \brief input signal nominal period     , s */
-    __fx64 m_Ts;
-    /*! \brief comb filter order */
-    __ix32 m_order;
+    /*! \brief lowpass specification data structure */
+    fir_sp  m_sp;
 
-    /*! \brief comb filter buffer */
-     mirror_ring_buffer< __type > m_bx;
+    /*! \brief lowpass coefficients buffer */
+    __type *m_cf;
 
-public:
+    /*! \brief lowpass time-reversed coefficients buffer ( m_cfr[ i ] = m_cf[ order - i ] ) */
+    __type *m_cfr;
 
-    /*! \brief filter output */
-    __fx64 m_out;
-    /*! \brief filter frequency phase response */
-    __fx64 m_pH;
-    /*! \brief filter frequency amplitude response */
-    __fx64 m_Km;
+    /*! \brief lowpass input buffer */
+    mirror_ring_buffer< __type , __DELAY_LINE_CAPACITY > m_bx;
+
+    /*! \brief decimation phase counter */
+    __ix32 m_phase;
+
+    /*! \brief coefficients folding mode */
+    fir_fold m_fold;
+
+    /*! \brief phase response type */
+    fir_phase m_phase_type;
+
+    /*! \brief coefficients folding sign ( +1 - symmetric , -1 - antisymmetric , 0 - the folding is not used ) */
+    __ix32 m_sign;
+
+    /*! \brief overlap-save fast convolution engine for the long filters block processing */
+    fir_ols< __type > m_ols;
 
     /*!
-     *  \brief comb filter initialization function
-     *  \param[Fs] - input signal sampling frequency
-     *  \param[Fn] - input signal nominal frequency
+     *  \brief pending specification , coefficients , folding sign and overlap-save engine prepared by retune()
+     *  \details the pending set is owned by the retune() caller in the idle state , so the pending specification
+     *           keeps the allocated filter order for the retune() checks ( zero order - the filter is not allocated )
     */
-    __ix32 init( __fx64 Fs , __fx64 Fn )
+    fir_sp   m_sp_next;
+    __type  *m_cf_next;
+    __type  *m_cfr_next;
+    __ix32   m_sign_next;
+    fir_ols< __type > m_ols_next;
+
+    /*! \brief retuning state */
+    fir_retune_flag m_retune;
+
+    /*! \brief pending crossfade length , current crossfade length and position , samples */
+    __ix32 m_fade_next , m_fade_len , m_fade_pos;
+
+    /*!
+     *  \brief coefficients sets switching function
+     *  \details the function is called by the filtering thread , it exchanges the active and the pending sets
+     *           keeping the input buffer and starts the crossfade
+    */
+    __void retune_switch()
     {
-        m_Fs      = Fs;
-        m_Fn      = Fn;
-        m_Ts      = 1 / m_Fs;
-        m_order   = m_Fs / m_Fn / 2;
-        m_out     = 0;
-        m_Km      = 0;
-        m_pH      = 0;
-        return 0;
+        if( !m_retune.exchange( fir_retune_ready , fir_retune_busy ) ) return;
+
+        fir_sp sp = m_sp;
+        m_sp      = m_sp_next;
+        m_sp_next = sp;
+
+        __type *cf = m_cf , *cfr = m_cfr;
+        m_cf      = m_cf_next;
+        m_cfr     = m_cfr_next;
+        m_cf_next  = cf;
+        m_cfr_next = cfr;
+
+        __ix32 sign = m_sign;
+        m_sign      = m_sign_next;
+        m_sign_next = sign;
+        m_ols.swap( m_ols_next );
+
+        // the old set is kept until the crossfade is over:
+        m_fade_len = m_fade_next;
+        m_fade_pos = 0;
+        if( m_fade_len == 0 ) m_retune.store( fir_retune_idle );
     }
 
-    /*! \brief memory allocation function */
+    /*!
+     *  \brief  coefficients folding mode getting function
+     *  \return the function returns the folding mode applied to the coefficients , the minimum phase coefficients
+     *          are not symmetric , so they are never folded even if the folding is forced
+    */
+    inline fir_fold fold_mode() { return ( m_phase_type == fir_minimum_phase ) ? fir_fold_off : m_fold; }
+
+    /*!
+     *  \brief  crossfade function
+     *  \param[y] - new coefficients filtering result
+     *  \return the function returns y_old + ( y - y_old ) * k / K , k = 1 ... K , where y_old is the old coefficients
+     *          filtering result , and releases the old set after the K-th sample
+    */
+    __type retune_fade( __type y )
+    {
+        __type y0 = ( m_sign_next != 0 ) ? __fold_dot__( m_bx.view( m_sp_next.N ).data , m_cfr_next , m_sp_next.N , m_sign_next )
+                                         : __dot__     ( m_bx.view( m_sp_next.N ).data , m_cfr_next , m_sp_next.N );
+        y = y0 + ( y - y0 ) * ( __type )( ++m_fade_pos ) / ( __type )m_fade_len;
+        if( m_fade_pos >= m_fade_len )
+        {
+            m_fade_len = 0;
+            m_retune.store( fir_retune_idle );
+        }
+        return y;
+    }
+
+public:
+
+    /*! \brief lowpass output */
+    __type m_out;
+
+   /*! \brief lowpass window function object */
+    wind_fcn m_wind;
+
+    /*! \brief lowpass memory allocation function */
     __ix32 allocate()
     {
-        return m_bx.allocate( m_order + 1 );
+        m_cf = __fir_wind_design__< __type >( m_sp , m_wind );
+        if( m_cf != 0 && m_phase_type == fir_minimum_phase ) __fir_min_phase__< __type >( m_cf , m_sp.N );
+
+        // time-reversed coefficients , so the coefficients and the buffer history are both read forward:
+        m_cfr = ( m_cf != 0 ) ? ( __type* ) calloc( m_sp.N , sizeof ( __type ) ) : 0;
+        if( m_cfr != 0 ) for( __ix32 n = 0 ; n <= m_sp.order ; n++ ) m_cfr[ n ] = m_cf[ m_sp.order - n ];
+
+        // the folded kernel halves the multiplications for the linear-phase filters:
+        m_sign = __fir_fold__< __type >( m_cf , m_cfr , m_sp.N , fold_mode() , 1e-12 );
+
+        m_bx.allocate( m_sp.N + 1 );
+        if( m_cf != 0 && m_cfr != 0 ) m_sp_next = m_sp;
+        return ( m_cf != 0 && m_cfr != 0 );
     }
 
-    /*! \brief memory deallocation function */
-    void deallocate()
+    /*! \brief lowpass memory deallocation function */
+    __void deallocate()
     {
-        m_bx.deallocate();
+        if( m_cf  != 0 ) { free( m_cf  ); m_cf  = nullptr; }
+        if( m_cfr != 0 ) { free( m_cfr ); m_cfr = nullptr; }
+        m_bx  .deallocate();
+        m_ols .deallocate();
+        m_wind.deallocate();
+        if( m_cf_next  != 0 ) { free( m_cf_next  ); m_cf_next  = nullptr; }
+        if( m_cfr_next != 0 ) { free( m_cfr_next ); m_cfr_next = nullptr; }
+        m_ols_next.deallocate();
+        m_sp_next = fir_sp();
+        m_retune.store( fir_retune_idle );
+        m_fade_len = m_fade_pos = 0;
+    }
+
+    /*! \brief Lowpass initialization function
+     *  \details the function initializes lowpass FIR filter
+     *  \param[Fs]      - sampling frequency , Hz
+     *  \param[Fn]      - nominal frequency  , Hz
+     *  \param[Fc]      - cut-off frequency  , Hz
+     *  \param[order]   - filter order
+     *  \param[scale]   - filter scaling flag ( 0 - not-scaled filter , 1 - scaled filter )
+    */
+    __void lp_init( __type Fs, __type Fn, __type Fc, __ix32 order , __bool scale )
+    {
+        m_sp  = fir_sp{ Fs , Fn , Fc , -1 , 1 / Fs , order , order + 1 , scale , fir_type::lowpass_fir };
+        m_cf  = 0;
+        m_cfr = 0;
+        m_out = 0;
+        m_phase = 0;
+        m_fold  = fir_fold_off;
+        m_phase_type = fir_linear_phase;
+        m_sign  = 0;
+        m_wind.init( m_sp.N );
+    }
+
+    /*! \brief Highpass initialization function
+     *  \details the function initializes highpass FIR filter
+     *  \param[Fs]      - sampling frequency , Hz
+     *  \param[Fn]      - nominal frequency  , Hz
+     *  \param[Fp]      - pass frequency     , Hz
+     *  \param[order]   - filter order
+     *  \param[scale]   - filter scaling flag ( 0 - not-scaled filter , 1 - scaled filter )
+    */
+    __void hp_init( __type Fs, __type Fn, __type Fp , __ix32 order , __bool scale )
+    {
+        m_sp  = fir_sp{ Fs , Fn , Fp , -1 , 1 / Fs , order , order + 1 , scale , fir_type::highpass_fir };
+        m_cf  = 0;
+        m_cfr = 0;
+        m_out = 0;
+        m_phase = 0;
+        m_fold  = fir_fold_off;
+        m_phase_type = fir_linear_phase;
+        m_sign  = 0;
+        m_wind.init( m_sp.N );
+    }
+
+    /*! \brief Bandpass initialization function
+     *  \details the function initializes bandpass FIR filter
+     *  \param[Fs]      - sampling frequency , Hz
+     *  \param[Fn]      - nominal frequency  , Hz
+     *  \param[Fp]      - cut-off frequency  , Hz
+     *  \param[BW]      - pass bandwidth     , Hz
+     *  \param[order]   - filter order
+     *  \param[scale]   - filter scaling flag ( 0 - not-scaled filter , 1 - scaled filter )
+    */
+    __void bp_init( __type Fs, __type Fn, __type Fp , __fx64 BW , __ix32 order , __bool scale )
+    {
+        m_sp  = fir_sp{ Fs , Fn , Fp , BW , 1 / Fs , order , order + 1 , scale , fir_type::bandpass_fir };
+        m_cf  = 0;
+        m_cfr = 0;
+        m_out = 0;
+        m_phase = 0;
+        m_fold  = fir_fold_off;
+        m_phase_type = fir_linear_phase;
+        m_sign  = 0;
+        m_wind.init( m_sp.N );
+    }
+
+    /*! \brief Bandstop initialization function
+     *  \details The function initializes bandstop FIR filter
+     *  \param[Fs]      - sampling frequency , Hz
+     *  \param[Fn]      - nominal frequency  , Hz
+     *  \param[Fc]      - cut-off frequency  , Hz
+     *  \param[BW]      - stop bandwidth     , Hz
+     *  \param[order]   - filter order
+     *  \param[scale]   - filter scaling flag ( 0 - not-scaled filter , 1 - scaled filter )
+    */
+    __void bs_init( __type Fs, __type Fn, __type Fc , __fx64 BW , __ix32 order , __bool scale )
+    {
+        m_sp  = fir_sp{ Fs , Fn , Fc , BW , 1 / Fs , order , order + 1 , scale , fir_type::bandstop_fir };
+        m_cf  = 0;
+        m_cfr = 0;
+        m_out = 0;
+        m_phase = 0;
+        m_fold  = fir_fold_off;
+        m_phase_type = fir_linear_phase;
+        m_sign  = 0;
+        m_wind.init( m_sp.N );
     }
 
     /*! \brief default constructor */
-    fcomb()
+    fir()
     {
-        m_Fs      = 4000;
-        m_Fn      = 50;
-        m_Ts      = 1 / m_Fs;
-        m_order   = m_Fs / m_Fn / 2;
-        m_out     = 0;
-        m_Km      = 0;
-        m_pH      = 0;
+        m_sp  = fir_sp{ 4000 , 50 , 100 , -1 , 1 / 4000 , 80 , 80 + 1 , 1 , fir_type::lowpass_fir };
+        m_cf  = 0;
+        m_cfr = 0;
+        m_out = 0;
+        m_phase = 0;
+        m_fold  = fir_fold_off;
+        m_phase_type = fir_linear_phase;
+        m_sign  = 0;
+        m_wind.init( m_sp.N  );
+
+        m_sp_next   = fir_sp();
+        m_cf_next   = 0;
+        m_cfr_next  = 0;
+        m_sign_next = 0;
+        m_fade_next = m_fade_len = m_fade_pos = 0;
+    }
+
+    /*! \brief  destructor */
+    ~fir() { deallocate(); }
+
+    /*!
+     *  \brief  frequency response computation function
+     *  \param[F] input frequency
+     *  \return the function returns fir_fr data structure
+    */
+    inline fir_fr< __fx64 > freq_resp( __type F ) { return __fir_freq_resp__< __fx64 , __type >( m_sp.Fs , F , m_sp.order , m_cf ); }
+
+    /*!
+     *  \brief  dense frequency response computation function
+     *  \param[fr     ] frequency response grid
+     *  \param[npoints] number of the grid points over [ 0 ; Fs / 2 ] , rounded up to 2^m + 1
+     *  \return the function computes the response by means of one real FFT and returns the number of the grid points
+    */
+    inline __ix32 freq_resp_grid( fir_fr_grid &fr , __ix32 npoints ) { return __fir_freq_resp_grid__< __type >( m_sp.Fs , m_sp.order , m_cf , fr , npoints ); }
+
+    /*!
+     *  \brief  FIR pulse response getting function
+     *  \param[F] pulse response sample number
+     *  \return the function returns FIR impulse response sample
+    */
+    inline __type get_coeff( __ix32 n ) { return ( n <= m_sp.order ) ? m_cf[ n ] : 1e6; }
+
+    /*!
+     *  \brief folding mode setting function
+     *  \param[mode] - coefficients folding mode
+     *  \details the folding is disabled by default : it halves the multiplications , but the extra mirrored loads
+     *           make it slower than the direct dot product for the most of the orders ( example12 ) , so it is enabled
+     *           explicitly. The mode is applied at the memory allocation or immediately if the filter is already allocated
+    */
+    inline __void set_fold( fir_fold mode )
+    {
+        m_fold = mode;
+        if( m_cf != 0 ) m_sign = __fir_fold__< __type >( m_cf , m_cfr , m_sp.N , fold_mode() , 1e-12 );
+
+        // the forced folding changes the coefficients , so the spectrum is recomputed:
+        if( m_ols.is_ready() ) m_ols.allocate( m_cf , m_sp.N );
     }
 
-    /*! \brief default destructor */
-    ~fcomb(){ deallocate(); };
+    /*!
+     *  \brief  folding sign getting function
+     *  \return the function returns +1 for the folded symmetric filter , -1 for the folded antisymmetric filter
+     *          and 0 if the folding is not used
+    */
+    inline __ix32 get_fold() { return m_sign; }
+
+    /*!
+     *  \brief phase response type setting function
+     *  \param[type] - phase response type
+     *  \details the type is applied at the coefficients design , the minimum phase filter has
+     *           the same amplitude response and the lower group delay , but the phase response is not linear
+    */
+    inline __void set_phase( fir_phase type ) { m_phase_type = type; }
+
+    /*!
+     *  \brief  phase response type getting function
+     *  \return the function returns the phase response type
+    */
+    inline fir_phase get_phase() { return m_phase_type; }
+
+    /*!
+     *  \brief  group delay computation function
+     *  \param[F] input frequency , Hz
+     *  \return the function returns the filter group delay at the frequency F , s ( order / 2 / Fs for the linear phase filter )
+    */
+    inline __fx64 group_delay( __fx64 F ) { return __fir_group_delay__< __type >( m_sp.Fs , F , m_sp.order , m_cf ) / m_sp.Fs; }
+
+    /*!
+     *  \brief  specification getting function
+     *  \return the function returns the active filter specification
+    */
+    inline fir_sp get_sp() { return m_sp; }
+
+    /*!
+     *  \brief  in-place retuning function
+     *  \param[sp] - new filter specification ( the order must be the same )
+     *  \param[K ] - crossfade length , samples ( 0 - the coefficients are switched at once )
+     *  \return The function designs the new coefficients with the current window type , prepares the pending
+     *          folding and overlap-save engine and publishes them. The filtering thread switches to the new set
+     *          at the next filtering call keeping the input buffer , so the retuning needs neither the buffer
+     *          reallocation nor the heap operations in the filtering thread , and the old filter output is faded
+     *          into the new one over K samples. The function may be called from the control thread concurrently
+     *          with the filtering. The not yet switched set is replaced by the newer one. The coefficients and
+     *          the frequency response getting functions read the active set and are not synchronized.
+     *          The function returns 1 if the new set is published and 0 if the filter is not allocated , the order
+     *          differs , the design fails or the previous crossfade is not finished yet.
+    */
+    __ix32 retune( const fir_sp &sp , __ix32 K = 0 )
+    {
+        // the not yet switched set is taken back , the set being crossfaded is not touched:
+        __ix32 state = m_retune.load();
+        if( state == fir_retune_busy ) return 0;
+        if( state == fir_retune_ready && !m_retune.exchange( fir_retune_ready , fir_retune_idle ) ) return 0;
+        if( m_sp_next.N == 0 || sp.order != m_sp_next.order || sp.N != m_sp_next.N ) return 0;
+
+        // the new coefficients are designed with the current window function type:
+        wind_fcn wind;
+        wind.init( sp.N );
+        wind.compute( m_wind.type() , m_wind.param() );
+        __type *cf = __fir_wind_design__< __type >( sp , wind );
+        if( cf == 0 ) return 0;
+        if( m_phase_type == fir_minimum_phase ) __fir_min_phase__< __type >( cf , sp.N );
+
+        if( m_cf_next  != 0 ) free( m_cf_next );
+        if( m_cfr_next != 0 ) free( m_cfr_next );
+        m_cf_next  = cf;
+        m_cfr_next = ( __type* ) calloc( sp.N , sizeof ( __type ) );
+        if( m_cfr_next == 0 ) return 0;
+        for( __ix32 n = 0 ; n <= sp.order ; n++ ) m_cfr_next[ n ] = m_cf_next[ sp.order - n ];
+        m_sign_next = __fir_fold__< __type >( m_cf_next , m_cfr_next , sp.N , fold_mode() , 1e-12 );
+
+        // the pending engine is prepared if the active set uses the block filtering engine:
+        if( m_ols.is_ready() ) m_ols_next.allocate( m_cf_next , sp.N );
+
+        m_sp_next   = sp;
+        m_fade_next = ( K > 0 ) ? K : 0;
+        m_retune.store( fir_retune_ready );
+        return 1;
+    }
+
+    /*!
+     *  \brief  FIR filter state saving function
+     *  \param[blob] pointer to the state memory block or null pointer to compute the state size only
+     *  \return the function stores the filter specification , window and phase types , coefficients , input buffer and output
+     *          into the state memory block and returns the state size , bytes
+    */
+    __ix32 save_state( void *blob )
+    {
+        char  *data = ( char* )blob;
+        __ix32 pos  = 0;
+        if( m_cf == 0 ) return 0;
+
+        // the window type is kept , so the restored filter is redesigned with the same window:
+        wind_type wt = m_wind.type();
+        __fx64    wp = m_wind.param();
+        __state_begin__( data , pos , "fir<fx64>" );
+        __state_put__( data , pos , &m_sp );
+        __state_put__( data , pos , &wt );
+        __state_put__( data , pos , &wp );
+        __state_put__( data , pos , &m_phase_type );
+        __state_put__( data , pos , m_cf , m_sp.N );
+        __buff_put__ ( data , pos , m_bx );
+        __state_put__( data , pos , &m_out );
+        __state_put__( data , pos , &m_phase );
+        __state_put__( data , pos , &m_fold  );
+        return __state_end__( data , pos );
+    }
+
+    /*!
+     *  \brief  FIR filter state loading function
+     *  \param[blob] pointer to the state memory block
+     *  \param[size] available memory size , bytes
+     *  \return the function restores the filter without the filter redesign and returns the number of the bytes read
+     *          or 0 if the state can not be restored. The filter is not changed if the state is not valid.
+    */
+    __ix32 load_state( const void *blob , __ix32 size )
+    {
+        const char *data = ( const char* )blob;
+        __ix32    pos = 0 , end = __state_open__( data , size , pos , "fir<fx64>" ) , phase = 0;
+        fir_sp    sp;
+        __ix32    wt   = wind_none;
+        __fx64    wp   = 0;
+        __ix32    pt   = fir_linear_phase;
+        __ix32    fold = fir_fold_off;
+        __type    out  = 0;
+        if( end == 0 ) return 0;
+
+        if( !__state_get__( data , end , pos , &sp ) || !__state_get__( data , end , pos , &wt ) ||
+            !__state_get__( data , end , pos , &wp ) || !__state_get__( data , end , pos , &pt ) ) return 0;
+        if( sp.N <= 0 || sp.order != sp.N - 1 || !__state_room__< __type >( end , pos , sp.N ) ) return 0;
+
+        // the state is restored into the temporaries , that replace the filter members only on success:
+        mirror_ring_buffer< __type , __DELAY_LINE_CAPACITY > bx;
+        __type *cf  = ( __type* ) calloc( sp.N , sizeof ( __type ) );
+        __type *cfr = ( __type* ) calloc( sp.N , sizeof ( __type ) );
+        __ix32  ok  = cf && cfr && bx.allocate( sp.N + 1 ) &&
+                      __state_get__( data , end , pos , cf , sp.N ) && __buff_get__( data , end , pos , bx ) &&
+                      __state_get__( data , end , pos , &out ) && __state_get__( data , end , pos , &phase ) &&
+                      __state_get__( data , end , pos , &fold ) && ( pos == end ) &&
+                      ( pt == fir_linear_phase || pt == fir_minimum_phase ) && ( wt >= wind_none && wt <= wind_tukey ) &&
+                      ( fold >= fir_fold_auto && fold <= fir_fold_off );
+        if( !ok )
+        {
+            free( cf );
+            free( cfr );
+            return 0;
+        }
+
+        deallocate();
+        m_sp         = m_sp_next = sp;
+        m_cf         = cf;
+        m_cfr        = cfr;
+        m_phase_type = ( fir_phase )pt;
+        m_out        = out;
+        m_phase      = phase;
+        m_fold       = ( fir_fold )fold;
+        m_bx.swap( bx );
+        m_wind.init( m_sp.N );
+        m_wind.restore( ( wind_type )wt , wp );
+        for( __ix32 n = 0 ; n <= m_sp.order ; n++ ) m_cfr[ n ] = m_cf[ m_sp.order - n ];
+        m_sign = __fir_fold__< __type >( m_cf , m_cfr , m_sp.N , fold_mode() , 1e-12 );
+        return end;
+    }
+
+    /*!
+     *  \brief  32-bit FIR filter buffer filling function
+     *  \param[input] pointer to the input data array
+     *  \return the function returns FIR filtering result
+    */
+    inline void fill_fir_buff( __type *input ) { m_bx( input ); }
+
+    /*!
+     *  \brief  FIR filtering function
+     *  \param[input] pointer to the input data array
+     *  \return the function returns FIR filtering result
+    */
+    inline __type filt( __type *input )
+    {
+        m_bx( input );
+        return filt();
+    }
+
+    /*!
+     *  \brief  FIR filtering function
+     *  \return the function returns FIR filtering result
+    */
+    inline __type filt()
+    {
+        if( m_retune.load() == fir_retune_ready ) retune_switch();
+
+        m_out = ( m_sign != 0 ) ? __fold_dot__( m_bx.view( m_sp.N ).data , m_cfr , m_sp.N , m_sign )
+                                : __dot__     ( m_bx.view( m_sp.N ).data , m_cfr , m_sp.N );
+        if( m_fade_len > 0 ) m_out = retune_fade( m_out );
+        return m_out;
+    }
+
+    /*!
+     *  \brief  block filtering preparation function
+     *  \param[n] - expected block size , samples
+     *  \return The function allocates the overlap-save engine if the filter order is not less than __FIR_OLS_MIN_ORDER and
+     *          the blocks of n samples are cheaper to filter by means of the fast convolution. The function returns 1 if the
+     *          engine is ready. It must be called from the filtering thread before the streaming and not concurrently with
+     *          the retuning , so the process( in , out , n ) function does no heap operations. The engine is kept by
+     *          the retuning and is released by the deallocation and the state loading.
+    */
+    __ix32 prepare_block( __ix32 n )
+    {
+        if( m_cf == 0 || n <= 0 || m_sp.order < __FIR_OLS_MIN_ORDER || !fir_ols< __type >::cheaper( m_sp.N , n ) ) return m_ols.is_ready();
+        if( !m_ols.is_ready() ) m_ols.allocate( m_cf , m_sp.N );
+        return m_ols.is_ready();
+    }
+
+    /*!
+     *  \brief  FIR block filtering function
+     *  \param[in ] pointer to the input samples block
+     *  \param[out] pointer to the output samples block
+     *  \param[n  ] number of the samples
+     *  \details the function filters the whole block: out[ i ] is the filtering result for in[ i ].
+     *           The long blocks of the long filters are filtered by means of the overlap-save fast convolution
+     *           if the engine is prepared by the prepare_block( n ) function and it is cheaper than the direct form.
+     *           The function does no heap operations. The input buffer is used as the convolution history ,
+     *           so the direct form and the fast convolution may be interleaved.
+    */
+    inline void process( const __type *in , __type *out , __ix32 n )
+    {
+        if( m_retune.load() == fir_retune_ready ) retune_switch();
+
+        // the crossfade is computed by the direct form:
+        if( n > 0 && m_fade_len == 0 && m_ols.cheaper( n ) )
+        {
+            for( __ix32 i = 0 ; i < n ; i += m_ols.block() )
+            {
+                __ix32 m = ( n - i < m_ols.block() ) ? ( n - i ) : m_ols.block();
+                m_ols.filt_block( m_bx.view( m_sp.N - 1 ).data , in + i , out + i , m );
+                m_bx.fill_block( in + i , m );
+            }
+            m_out = out[ n - 1 ];
+            return;
+        }
+
+        for( __ix32 i = 0 ; i < n ; i++ )
+        {
+            m_bx.fill_buff( &in[i] );
+            out[i] = filt();
+        }
+    }
+
+    /*!
+     *  \brief  FIR decimating block filtering function
+     *  \param[in    ] pointer to the input samples block
+     *  \param[n     ] number of the input samples
+     *  \param[out   ] pointer to the output samples
+     *  \param[stride] decimation factor ( one output sample per stride input samples ) , stride >= 1
+     *  \return the function returns the number of the computed output samples ( 0 if the stride is less than 1 )
+     *  \details the input samples between the output samples are copied into the buffer by blocks and
+     *           the convolution is computed only for the kept output samples. The decimation phase is
+     *           kept between the calls , so the block size does not need to be a multiple of the stride.
+    */
+    inline __ix32 process_decimate( const __type *in , __ix32 n , __type *out , __ix32 stride )
+    {
+        __ix32 i = 0 , k = 0;
+        if( stride < 1 ) return 0;
+
+        // the stride may be decreased since the last call , then the next input sample is the output one:
+        if( m_phase >= stride ) m_phase = stride - 1;
+        while( i < n )
+        {
+            // input samples left before the next output sample:
+            __ix32 m = ( stride - m_phase < n - i ) ? ( stride - m_phase ) : ( n - i );
+            m_bx.fill_block( &in[i] , m );
+            i       += m;
+            m_phase += m;
+
+            // output sample computation:
+            if( m_phase >= stride )
+            {
+                out[k++] = filt();
+                m_phase  = 0;
+            }
+        }
+        return k;
+    }
+
+    /*!
+     *  \brief  FIR filtering () operator
+     *  \param[input] pointer to the input data
+     *  \return the () operator calls filt( __type *input ) function that returns FIR filtering result
+    */
+    inline __type operator() ( __type *input ) { return filt( input ); }
+};
+
+/*!
+ *  \brief 16-bit fixed point FIR filter
+ *  \details The samples are stored in Q15 format , the coefficients are designed with the 64-bit precision and rounded
+ *           to the Q( 15 - g ) format with the headroom g chosen by __fir_quantize__. The products are accumulated
+ *           exactly , the sum is rounded to the nearest and saturated:
+ *           \f[
+ *               y[ n ] = sat\left( \left( \sum_{ i = 0 }^{ N - 1 } h_q[ i ] * x[ n - i ] + 2^{ q - 1 } \right) >> q \right)
+ *           \f]
+*/
+template<> class fir<__ix16>
+{
+    typedef __ix16 __type ;
+    typedef bool   __bool ;
+    typedef void   __void ;
+
+    /*! \brief filter specification data structure */
+    fir_sp  m_sp;
+
+    /*! \brief 64-bit floating point reference coefficients buffer */
+    __fx64 *m_cf;
+
+    /*! \brief time-reversed quantized coefficients buffer ( m_cfq[ i ] = round( m_cf[ order - i ] * 2^m_q ) ) */
+    __type *m_cfq;
+
+    /*! \brief quantized coefficients fractional bits number */
+    __ix32 m_q;
+
+    /*! \brief input signal full scale */
+    __fx64 m_scale;
+
+    /*! \brief phase response type */
+    fir_phase m_phase_type;
+
+    /*! \brief Q15 input buffer */
+    mirror_ring_buffer< __type > m_bx;
+
+    /*!
+     *  \brief  accumulator rounding and saturation function
+     *  \param[acc] - exact products sum
+     *  \return the function returns the Q15 output sample
+    */
+    inline __type round_sat( __ix64 acc )
+    {
+        acc = ( acc + ( ( __ix64 )1 << ( m_q - 1 ) ) ) >> m_q;
+        return ( acc > 32767 ) ? 32767 : ( acc < -32768 ) ? -32768 : ( __type )acc;
+    }
+
+    /*! \brief filter initialization function */
+    __void init( const fir_sp &sp )
+    {
+        m_sp    = sp;
+        m_cf    = 0;
+        m_cfq   = 0;
+        m_q     = 15;
+        m_out   = 0;
+        m_phase_type = fir_linear_phase;
+        m_wind.init( m_sp.N );
+    }
+
+public:
+
+    /*! \brief Q15 filter output */
+    __type m_out;
+
+    /*! \brief filter window function object */
+    wind_fcn m_wind;
+
+    /*! \brief filter memory allocation function */
+    __ix32 allocate()
+    {
+        m_cf  = __fir_wind_design__< __fx64 >( m_sp , m_wind );
+        if( m_cf != 0 && m_phase_type == fir_minimum_phase ) __fir_min_phase__< __fx64 >( m_cf , m_sp.N );
+        m_cfq = ( m_cf != 0 ) ? ( __type* ) calloc( m_sp.N , sizeof ( __type ) ) : 0;
+        if( m_cfq == 0 || !m_bx.allocate( m_sp.N , m_scale ) ) return 0;
+        m_q = __fir_quantize__< __type >( m_cf , m_cfq , m_sp.N , 15 );
+        return 1;
+    }
+
+    /*! \brief filter memory deallocation function */
+    __void deallocate()
+    {
+        if( m_cf  != 0 ) { free( m_cf  ); m_cf  = 0; }
+        if( m_cfq != 0 ) { free( m_cfq ); m_cfq = 0; }
+        m_bx.deallocate();
+        m_wind.deallocate();
+    }
+
+    /*! \brief Lowpass initialization function
+     *  \param[Fs]      - sampling frequency , Hz
+     *  \param[Fn]      - nominal frequency  , Hz
+     *  \param[Fc]      - cut-off frequency  , Hz
+     *  \param[order]   - filter order
+     *  \param[scale]   - filter scaling flag ( 0 - not-scaled filter , 1 - scaled filter )
+    */
+    __void lp_init( __fx64 Fs, __fx64 Fn, __fx64 Fc, __ix32 order , __bool scale )
+    {
+        init( fir_sp{ Fs , Fn , Fc , -1 , 1 / Fs , order , order + 1 , scale , fir_type::lowpass_fir } );
+    }
+
+    /*! \brief Highpass initialization function
+     *  \param[Fs]      - sampling frequency , Hz
+     *  \param[Fn]      - nominal frequency  , Hz
+     *  \param[Fp]      - pass frequency     , Hz
+     *  \param[order]   - filter order
+     *  \param[scale]   - filter scaling flag ( 0 - not-scaled filter , 1 - scaled filter )
+    */
+    __void hp_init( __fx64 Fs, __fx64 Fn, __fx64 Fp , __ix32 order , __bool scale )
+    {
+        init( fir_sp{ Fs , Fn , Fp , -1 , 1 / Fs , order , order + 1 , scale , fir_type::highpass_fir } );
+    }
+
+    /*! \brief Bandpass initialization function
+     *  \param[Fs]      - sampling frequency , Hz
+     *  \param[Fn]      - nominal frequency  , Hz
+     *  \param[Fp]      - cut-off frequency  , Hz
+     *  \param[BW]      - pass bandwidth     , Hz
+     *  \param[order]   - filter order
+     *  \param[scale]   - filter scaling flag ( 0 - not-scaled filter , 1 - scaled filter )
+    */
+    __void bp_init( __fx64 Fs, __fx64 Fn, __fx64 Fp , __fx64 BW , __ix32 order , __bool scale )
+    {
+        init( fir_sp{ Fs , Fn , Fp , BW , 1 / Fs , order , order + 1 , scale , fir_type::bandpass_fir } );
+    }
+
+    /*! \brief Bandstop initialization function
+     *  \param[Fs]      - sampling frequency , Hz
+     *  \param[Fn]      - nominal frequency  , Hz
+     *  \param[Fc]      - cut-off frequency  , Hz
+     *  \param[BW]      - stop bandwidth     , Hz
+     *  \param[order]   - filter order
+     *  \param[scale]   - filter scaling flag ( 0 - not-scaled filter , 1 - scaled filter )
+    */
+    __void bs_init( __fx64 Fs, __fx64 Fn, __fx64 Fc , __fx64 BW , __ix32 order , __bool scale )
+    {
+        init( fir_sp{ Fs , Fn , Fc , BW , 1 / Fs , order , order + 1 , scale , fir_type::bandstop_fir } );
+    }
+
+    /*! \brief default constructor */
+    fir() { set_scale( 1.0 ); lp_init( 4000 , 50 , 100 , 80 , 1 ); }
+
+    /*! \brief  destructor */
+    ~fir() { deallocate(); }
+
+    /*!
+     *  \brief  input signal full scale setting function
+     *  \param[scale] - the input signal value that corresponds to the Q15 full scale
+     *  \details the scale is used by the floating point input samples conversion and by the value() function
+    */
+    inline __void set_scale( __fx64 scale ) { m_scale = scale; m_bx.setScale( scale ); }
+
+    /*!
+     *  \brief  frequency response computation function
+     *  \param[F] input frequency
+     *  \return the function returns the 64-bit floating point reference filter frequency response
+    */
+    inline fir_fr< __fx64 > freq_resp( __fx64 F ) { return __fir_freq_resp__< __fx64 , __fx64 >( m_sp.Fs , F , m_sp.order , m_cf ); }
+
+    /*!
+     *  \brief  dense frequency response computation function
+     *  \param[fr     ] frequency response grid
+     *  \param[npoints] number of the grid points over [ 0 ; Fs / 2 ] , rounded up to 2^m + 1
+     *  \return the function computes the response by means of one real FFT and returns the number of the grid points
+    */
+    inline __ix32 freq_resp_grid( fir_fr_grid &fr , __ix32 npoints ) { return __fir_freq_resp_grid__< __fx64 >( m_sp.Fs , m_sp.order , m_cf , fr , npoints ); }
+
+    /*!
+     *  \brief  FIR pulse response getting function
+     *  \param[n] pulse response sample number
+     *  \return the function returns the quantized impulse response sample
+    */
+    inline __fx64 get_coeff( __ix32 n ) { return ( n <= m_sp.order ) ? ldexp( ( __fx64 )m_cfq[ m_sp.order - n ] , -m_q ) : 1e6; }
+
+    /*!
+     *  \brief  quantized coefficients fractional bits number getting function
+     *  \return the function returns q , the coefficients are stored in Q( q ) format
+    */
+    inline __ix32 get_q() { return m_q; }
+
+    /*!
+     *  \brief phase response type setting function
+     *  \param[type] - phase response type
+     *  \details the type is applied at the coefficients design , the minimum phase filter has
+     *           the same amplitude response and the lower group delay , but the phase response is not linear
+    */
+    inline __void set_phase( fir_phase type ) { m_phase_type = type; }
+
+    /*!
+     *  \brief  phase response type getting function
+     *  \return the function returns the phase response type
+    */
+    inline fir_phase get_phase() { return m_phase_type; }
+
+    /*!
+     *  \brief  group delay computation function
+     *  \param[F] input frequency , Hz
+     *  \return the function returns the filter group delay at the frequency F , s ( order / 2 / Fs for the linear phase filter )
+    */
+    inline __fx64 group_delay( __fx64 F ) { return __fir_group_delay__< __fx64 >( m_sp.Fs , F , m_sp.order , m_cf ) / m_sp.Fs; }
+
+    /*!
+     *  \brief  coefficients quantization SNR computation function
+     *  \return the function returns the signal to noise ratio of the quantized coefficients relative to the
+     *          64-bit floating point reference coefficients , dB
+    */
+    __fx64 snr()
+    {
+        __fx64 s = 0 , e = 0;
+        for( __ix32 n = 0 ; n <= m_sp.order ; n++ )
+        {
+            __fx64 d = m_cf[ n ] - get_coeff( n );
+            s += m_cf[ n ] * m_cf[ n ];
+            e += d * d;
+        }
+        return ( e > 0 ) ? 10 * log10( s / e ) : 1e6;
+    }
+
+    /*!
+     *  \brief  output value function
+     *  \return the function returns the Q15 filter output converted back into the input signal scale
+    */
+    inline __fx64 value() { return m_out * m_scale * ( 1.0 / 32768.0 ); }
+
+    /*!
+     *  \brief  FIR filter state saving function
+     *  \param[blob] pointer to the state memory block or null pointer to compute the state size only
+     *  \return the function stores the filter specification , window and phase types , reference coefficients , input scale , input buffer
+     *          and output into the state memory block and returns the state size , bytes
+    */
+    __ix32 save_state( void *blob )
+    {
+        char  *data = ( char* )blob;
+        __ix32 pos  = 0;
+        if( m_cf == 0 ) return 0;
+
+        // the window type is kept , so the restored filter is redesigned with the same window:
+        wind_type wt = m_wind.type();
+        __fx64    wp = m_wind.param();
+        __state_begin__( data , pos , "fir<ix16>" );
+        __state_put__( data , pos , &m_sp );
+        __state_put__( data , pos , &wt );
+        __state_put__( data , pos , &wp );
+        __state_put__( data , pos , &m_phase_type );
+        __state_put__( data , pos , m_cf , m_sp.N );
+        __state_put__( data , pos , &m_scale );
+        __buff_put__ ( data , pos , m_bx );
+        __state_put__( data , pos , &m_out );
+        return __state_end__( data , pos );
+    }
+
+    /*!
+     *  \brief  FIR filter state loading function
+     *  \param[blob] pointer to the state memory block
+     *  \param[size] available memory size , bytes
+     *  \return the function restores the filter without the filter redesign and returns the number of the bytes read
+     *          or 0 if the state can not be restored. The filter is not changed if the state is not valid.
+    */
+    __ix32 load_state( const void *blob , __ix32 size )
+    {
+        const char *data = ( const char* )blob;
+        __ix32    pos = 0 , end = __state_open__( data , size , pos , "fir<ix16>" );
+        fir_sp    sp;
+        __ix32    wt    = wind_none;
+        __fx64    wp    = 0;
+        __ix32    pt    = fir_linear_phase;
+        __fx64    scale = 0;
+        __type    out   = 0;
+        if( end == 0 ) return 0;
+
+        if( !__state_get__( data , end , pos , &sp ) || !__state_get__( data , end , pos , &wt ) ||
+            !__state_get__( data , end , pos , &wp ) || !__state_get__( data , end , pos , &pt ) ) return 0;
+        if( sp.N <= 0 || sp.order != sp.N - 1 || !__state_room__< __fx64 >( end , pos , sp.N ) ) return 0;
+
+        // the state is restored into the temporaries , that replace the filter members only on success:
+        mirror_ring_buffer< __type > bx;
+        __fx64 *cf  = ( __fx64* ) calloc( sp.N , sizeof ( __fx64 ) );
+        __type *cfq = ( __type* ) calloc( sp.N , sizeof ( __type ) );
+        __ix32  ok  = cf && cfq && __state_get__( data , end , pos , cf , sp.N ) && __state_get__( data , end , pos , &scale ) &&
+                      ( scale > 0 ) && bx.allocate( sp.N , scale ) && __buff_get__( data , end , pos , bx ) &&
+                      __state_get__( data , end , pos , &out ) && ( pos == end ) &&
+                      ( pt == fir_linear_phase || pt == fir_minimum_phase ) && ( wt >= wind_none && wt <= wind_tukey );
+        if( !ok )
+        {
+            free( cf );
+            free( cfq );
+            return 0;
+        }
+
+        deallocate();
+        m_sp         = sp;
+        m_cf         = cf;
+        m_cfq        = cfq;
+        m_phase_type = ( fir_phase )pt;
+        m_out        = out;
+        m_bx.swap( bx );
+        set_scale( scale );
+        m_wind.init( m_sp.N );
+        m_wind.restore( ( wind_type )wt , wp );
+        m_q = __fir_quantize__< __type >( m_cf , m_cfq , m_sp.N , 15 );
+        return end;
+    }
+
+    /*!
+     *  \brief  FIR filter buffer filling function
+     *  \param[input] pointer to the input sample
+     *  \details the floating point input samples are converted into Q15 format by the buffer
+    */
+    template< typename T2 > inline void fill_fir_buff( T2 *input ) { m_bx( input ); }
+
+    /*!
+     *  \brief  Q15 FIR filtering function
+     *  \param[input] pointer to the Q15 input sample
+     *  \return the function returns Q15 FIR filtering result
+    */
+    inline __type filt( __type *input )
+    {
+        m_bx( input );
+        return filt();
+    }
+
+    /*!
+     *  \brief  floating point FIR filtering function
+     *  \param[input] pointer to the input sample
+     *  \return the function returns Q15 FIR filtering result , the input sample is converted into Q15 format
+    */
+    template< typename T2 > inline __type filt( T2 *input )
+    {
+        fill_fir_buff( input );
+        return filt();
+    }
+
+    /*!
+     *  \brief  FIR filtering function
+     *  \return the function returns Q15 FIR filtering result
+    */
+    inline __type filt() { return ( m_out = round_sat( __qdot__( m_bx.view( m_sp.N ).data , m_cfq , m_sp.N ) ) ); }
+
+    /*!
+     *  \brief  Q15 FIR block filtering function
+     *  \param[in ] pointer to the input samples block
+     *  \param[out] pointer to the output samples block
+     *  \param[n  ] number of the samples
+     *  \details the function filters the whole block: out[ i ] is the filtering result for in[ i ]
+    */
+    inline void process( const __type *in , __type *out , __ix32 n )
+    {
+        for( __ix32 i = 0 ; i < n ; i++ )
+        {
+            m_bx.fill_buff( &in[i] );
+            out[i] = filt();
+        }
+    }
+
+    /*!
+     *  \brief Q15 FIR filtering () operator
+     *  \param[input] pointer to the input data
+     *  \return the () operator calls filt( T2 *input ) function that returns FIR filtering result
+    */
+    template< typename T2 > inline __type operator() ( T2 *input ) { return filt( input ); }
+};
+
+/*!
+ *  \brief 32-bit fixed point FIR filter
+ *  \details The samples are stored in Q31 format , the coefficients are designed with the 64-bit precision and rounded
+ *           to the Q( 31 - g ) format with the headroom g chosen by __fir_quantize__. The products are accumulated
+ *           exactly , the sum is rounded to the nearest and saturated:
+ *           \f[
+ *               y[ n ] = sat\left( \left( \sum_{ i = 0 }^{ N - 1 } h_q[ i ] * x[ n - i ] + 2^{ q - 1 } \right) >> q \right)
+ *           \f]
+*/
+template<> class fir<__ix32>
+{
+    typedef __ix32 __type ;
+    typedef bool   __bool ;
+    typedef void   __void ;
+
+    /*! \brief filter specification data structure */
+    fir_sp  m_sp;
+
+    /*! \brief 64-bit floating point reference coefficients buffer */
+    __fx64 *m_cf;
+
+    /*! \brief time-reversed quantized coefficients buffer ( m_cfq[ i ] = round( m_cf[ order - i ] * 2^m_q ) ) */
+    __type *m_cfq;
+
+    /*! \brief quantized coefficients fractional bits number */
+    __ix32 m_q;
+
+    /*! \brief input signal full scale */
+    __fx64 m_scale;
+
+    /*! \brief phase response type */
+    fir_phase m_phase_type;
+
+    /*! \brief Q31 input buffer */
+    mirror_ring_buffer< __type > m_bx;
+
+    /*! \brief input samples Q31 conversion factor */
+    __fx64 m_kq;
+
+    /*!
+     *  \brief  Q31 conversion function
+     *  \param[x] - input sample
+     *  \return the function returns the rounded and saturated Q31 representation of the input sample ( 0 for NaN )
+    */
+    inline __type quantize( __fx64 x )
+    {
+        x *= m_kq;
+        if( x != x ) return 0;
+        if( x >=  2147483647.0 ) return 2147483647;
+        if( x <= -2147483648.0 ) return ( -2147483647 - 1 );
+        return ( __type )( ( x >= 0 ) ? ( x + 0.5 ) : ( x - 0.5 ) );
+    }
+
+    /*!
+     *  \brief  accumulator rounding and saturation function
+     *  \param[acc] - exact products sum
+     *  \return the function returns the Q31 output sample
+    */
+    inline __type round_sat( __ix64 acc )
+    {
+        acc = ( acc + ( ( __ix64 )1 << ( m_q - 1 ) ) ) >> m_q;
+        return ( acc > 2147483647 ) ? 2147483647 : ( acc < ( -2147483647 - 1 ) ) ? ( -2147483647 - 1 ) : ( __type )acc;
+    }
+
+    /*! \brief filter initialization function */
+    __void init( const fir_sp &sp )
+    {
+        m_sp    = sp;
+        m_cf    = 0;
+        m_cfq   = 0;
+        m_q     = 31;
+        m_out   = 0;
+        m_phase_type = fir_linear_phase;
+        m_wind.init( m_sp.N );
+    }
+
+public:
+
+    /*! \brief Q31 filter output */
+    __type m_out;
+
+    /*! \brief filter window function object */
+    wind_fcn m_wind;
+
+    /*! \brief filter memory allocation function */
+    __ix32 allocate()
+    {
+        m_cf  = __fir_wind_design__< __fx64 >( m_sp , m_wind );
+        if( m_cf != 0 && m_phase_type == fir_minimum_phase ) __fir_min_phase__< __fx64 >( m_cf , m_sp.N );
+        m_cfq = ( m_cf != 0 ) ? ( __type* ) calloc( m_sp.N , sizeof ( __type ) ) : 0;
+        if( m_cfq == 0 || !m_bx.allocate( m_sp.N ) ) return 0;
+        m_q = __fir_quantize__< __type >( m_cf , m_cfq , m_sp.N , 31 );
+        return 1;
+    }
+
+    /*! \brief filter memory deallocation function */
+    __void deallocate()
+    {
+        if( m_cf  != 0 ) { free( m_cf  ); m_cf  = 0; }
+        if( m_cfq != 0 ) { free( m_cfq ); m_cfq = 0; }
+        m_bx.deallocate();
+        m_wind.deallocate();
+    }
+
+    /*! \brief Lowpass initialization function
+     *  \param[Fs]      - sampling frequency , Hz
+     *  \param[Fn]      - nominal frequency  , Hz
+     *  \param[Fc]      - cut-off frequency  , Hz
+     *  \param[order]   - filter order
+     *  \param[scale]   - filter scaling flag ( 0 - not-scaled filter , 1 - scaled filter )
+    */
+    __void lp_init( __fx64 Fs, __fx64 Fn, __fx64 Fc, __ix32 order , __bool scale )
+    {
+        init( fir_sp{ Fs , Fn , Fc , -1 , 1 / Fs , order , order + 1 , scale , fir_type::lowpass_fir } );
+    }
+
+    /*! \brief Highpass initialization function
+     *  \param[Fs]      - sampling frequency , Hz
+     *  \param[Fn]      - nominal frequency  , Hz
+     *  \param[Fp]      - pass frequency     , Hz
+     *  \param[order]   - filter order
+     *  \param[scale]   - filter scaling flag ( 0 - not-scaled filter , 1 - scaled filter )
+    */
+    __void hp_init( __fx64 Fs, __fx64 Fn, __fx64 Fp , __ix32 order , __bool scale )
+    {
+        init( fir_sp{ Fs , Fn , Fp , -1 , 1 / Fs , order , order + 1 , scale , fir_type::highpass_fir } );
+    }
+
+    /*! \brief Bandpass initialization function
+     *  \param[Fs]      - sampling frequency , Hz
+     *  \param[Fn]      - nominal frequency  , Hz
+     *  \param[Fp]      - cut-off frequency  , Hz
+     *  \param[BW]      - pass bandwidth     , Hz
+     *  \param[order]   - filter order
+     *  \param[scale]   - filter scaling flag ( 0 - not-scaled filter , 1 - scaled filter )
+    */
+    __void bp_init( __fx64 Fs, __fx64 Fn, __fx64 Fp , __fx64 BW , __ix32 order , __bool scale )
+    {
+        init( fir_sp{ Fs , Fn , Fp , BW , 1 / Fs , order , order + 1 , scale , fir_type::bandpass_fir } );
+    }
+
+    /*! \brief Bandstop initialization function
+     *  \param[Fs]      - sampling frequency , Hz
+     *  \param[Fn]      - nominal frequency  , Hz
+     *  \param[Fc]      - cut-off frequency  , Hz
+     *  \param[BW]      - stop bandwidth     , Hz
+     *  \param[order]   - filter order
+     *  \param[scale]   - filter scaling flag ( 0 - not-scaled filter , 1 - scaled filter )
+    */
+    __void bs_init( __fx64 Fs, __fx64 Fn, __fx64 Fc , __fx64 BW , __ix32 order , __bool scale )
+    {
+        init( fir_sp{ Fs , Fn , Fc , BW , 1 / Fs , order , order + 1 , scale , fir_type::bandstop_fir } );
+    }
+
+    /*! \brief default constructor */
+    fir() { set_scale( 1.0 ); lp_init( 4000 , 50 , 100 , 80 , 1 ); }
+
+    /*! \brief  destructor */
+    ~fir() { deallocate(); }
+
+    /*!
+     *  \brief  input signal full scale setting function
+     *  \param[scale] - the input signal value that corresponds to the Q31 full scale
+     *  \details the scale is used by the floating point input samples conversion and by the value() function
+    */
+    inline __void set_scale( __fx64 scale ) { m_scale = scale; m_kq = 2147483648.0 / scale; }
+
+    /*!
+     *  \brief  frequency response computation function
+     *  \param[F] input frequency
+     *  \return the function returns the 64-bit floating point reference filter frequency response
+    */
+    inline fir_fr< __fx64 > freq_resp( __fx64 F ) { return __fir_freq_resp__< __fx64 , __fx64 >( m_sp.Fs , F , m_sp.order , m_cf ); }
+
+    /*!
+     *  \brief  dense frequency response computation function
+     *  \param[fr     ] frequency response grid
+     *  \param[npoints] number of the grid points over [ 0 ; Fs / 2 ] , rounded up to 2^m + 1
+     *  \return the function computes the response by means of one real FFT and returns the number of the grid points
+    */
+    inline __ix32 freq_resp_grid( fir_fr_grid &fr , __ix32 npoints ) { return __fir_freq_resp_grid__< __fx64 >( m_sp.Fs , m_sp.order , m_cf , fr , npoints ); }
+
+    /*!
+     *  \brief  FIR pulse response getting function
+     *  \param[n] pulse response sample number
+     *  \return the function returns the quantized impulse response sample
+    */
+    inline __fx64 get_coeff( __ix32 n ) { return ( n <= m_sp.order ) ? ldexp( ( __fx64 )m_cfq[ m_sp.order - n ] , -m_q ) : 1e6; }
+
+    /*!
+     *  \brief  quantized coefficients fractional bits number getting function
+     *  \return the function returns q , the coefficients are stored in Q( q ) format
+    */
+    inline __ix32 get_q() { return m_q; }
+
+    /*!
+     *  \brief phase response type setting function
+     *  \param[type] - phase response type
+     *  \details the type is applied at the coefficients design , the minimum phase filter has
+     *           the same amplitude response and the lower group delay , but the phase response is not linear
+    */
+    inline __void set_phase( fir_phase type ) { m_phase_type = type; }
+
+    /*!
+     *  \brief  phase response type getting function
+     *  \return the function returns the phase response type
+    */
+    inline fir_phase get_phase() { return m_phase_type; }
+
+    /*!
+     *  \brief  group delay computation function
+     *  \param[F] input frequency , Hz
+     *  \return the function returns the filter group delay at the frequency F , s ( order / 2 / Fs for the linear phase filter )
+    */
+    inline __fx64 group_delay( __fx64 F ) { return __fir_group_delay__< __fx64 >( m_sp.Fs , F , m_sp.order , m_cf ) / m_sp.Fs; }
+
+    /*!
+     *  \brief  coefficients quantization SNR computation function
+     *  \return the function returns the signal to noise ratio of the quantized coefficients relative to the
+     *          64-bit floating point reference coefficients , dB
+    */
+    __fx64 snr()
+    {
+        __fx64 s = 0 , e = 0;
+        for( __ix32 n = 0 ; n <= m_sp.order ; n++ )
+        {
+            __fx64 d = m_cf[ n ] - get_coeff( n );
+            s += m_cf[ n ] * m_cf[ n ];
+            e += d * d;
+        }
+        return ( e > 0 ) ? 10 * log10( s / e ) : 1e6;
+    }
+
+    /*!
+     *  \brief  output value function
+     *  \return the function returns the Q31 filter output converted back into the input signal scale
+    */
+    inline __fx64 value() { return m_out * m_scale * ( 1.0 / 2147483648.0 ); }
+
+    /*!
+     *  \brief  FIR filter state saving function
+     *  \param[blob] pointer to the state memory block or null pointer to compute the state size only
+     *  \return the function stores the filter specification , window and phase types , reference coefficients , input scale , input buffer
+     *          and output into the state memory block and returns the state size , bytes
+    */
+    __ix32 save_state( void *blob )
+    {
+        char  *data = ( char* )blob;
+        __ix32 pos  = 0;
+        if( m_cf == 0 ) return 0;
+
+        // the window type is kept , so the restored filter is redesigned with the same window:
+        wind_type wt = m_wind.type();
+        __fx64    wp = m_wind.param();
+        __state_begin__( data , pos , "fir<ix32>" );
+        __state_put__( data , pos , &m_sp );
+        __state_put__( data , pos , &wt );
+        __state_put__( data , pos , &wp );
+        __state_put__( data , pos , &m_phase_type );
+        __state_put__( data , pos , m_cf , m_sp.N );
+        __state_put__( data , pos , &m_scale );
+        __buff_put__ ( data , pos , m_bx );
+        __state_put__( data , pos , &m_out );
+        return __state_end__( data , pos );
+    }
+
+    /*!
+     *  \brief  FIR filter state loading function
+     *  \param[blob] pointer to the state memory block
+     *  \param[size] available memory size , bytes
+     *  \return the function restores the filter without the filter redesign and returns the number of the bytes read
+     *          or 0 if the state can not be restored. The filter is not changed if the state is not valid.
+    */
+    __ix32 load_state( const void *blob , __ix32 size )
+    {
+        const char *data = ( const char* )blob;
+        __ix32    pos = 0 , end = __state_open__( data , size , pos , "fir<ix32>" );
+        fir_sp    sp;
+        __ix32    wt    = wind_none;
+        __fx64    wp    = 0;
+        __ix32    pt    = fir_linear_phase;
+        __fx64    scale = 0;
+        __type    out   = 0;
+        if( end == 0 ) return 0;
+
+        if( !__state_get__( data , end , pos , &sp ) || !__state_get__( data , end , pos , &wt ) ||
+            !__state_get__( data , end , pos , &wp ) || !__state_get__( data , end , pos , &pt ) ) return 0;
+        if( sp.N <= 0 || sp.order != sp.N - 1 || !__state_room__< __fx64 >( end , pos , sp.N ) ) return 0;
+
+        // the state is restored into the temporaries , that replace the filter members only on success:
+        mirror_ring_buffer< __type > bx;
+        __fx64 *cf  = ( __fx64* ) calloc( sp.N , sizeof ( __fx64 ) );
+        __type *cfq = ( __type* ) calloc( sp.N , sizeof ( __type ) );
+        __ix32  ok  = cf && cfq && __state_get__( data , end , pos , cf , sp.N ) && __state_get__( data , end , pos , &scale ) &&
+                      ( scale > 0 ) && bx.allocate( sp.N ) && __buff_get__( data , end , pos , bx ) &&
+                      __state_get__( data , end , pos , &out ) && ( pos == end ) &&
+                      ( pt == fir_linear_phase || pt == fir_minimum_phase ) && ( wt >= wind_none && wt <= wind_tukey );
+        if( !ok )
+        {
+            free( cf );
+            free( cfq );
+            return 0;
+        }
+
+        deallocate();
+        m_sp         = sp;
+        m_cf         = cf;
+        m_cfq        = cfq;
+        m_phase_type = ( fir_phase )pt;
+        m_out        = out;
+        m_bx.swap( bx );
+        set_scale( scale );
+        m_wind.init( m_sp.N );
+        m_wind.restore( ( wind_type )wt , wp );
+        m_q = __fir_quantize__< __type >( m_cf , m_cfq , m_sp.N , 31 );
+        return end;
+    }
+
+    /*!
+     *  \brief  Q31 FIR filter buffer filling function
+     *  \param[input] pointer to the Q31 input sample
+    */
+    inline void fill_fir_buff( __type *input ) { m_bx( input ); }
+
+    /*!
+     *  \brief  floating point FIR filter buffer filling function
+     *  \param[input] pointer to the input sample
+     *  \details the input sample is converted into Q31 format
+    */
+    template< typename T2 > inline void fill_fir_buff( T2 *input )
+    {
+        __type x = quantize( *input );
+        m_bx( &x );
+    }
+
+    /*!
+     *  \brief  Q31 FIR filtering function
+     *  \param[input] pointer to the Q31 input sample
+     *  \return the function returns Q31 FIR filtering result
+    */
+    inline __type filt( __type *input )
+    {
+        m_bx( input );
+        return filt();
+    }
+
+    /*!
+     *  \brief  floating point FIR filtering function
+     *  \param[input] pointer to the input sample
+     *  \return the function returns Q31 FIR filtering result , the input sample is converted into Q31 format
+    */
+    template< typename T2 > inline __type filt( T2 *input )
+    {
+        fill_fir_buff( input );
+        return filt();
+    }
+
+    /*!
+     *  \brief  FIR filtering function
+     *  \return the function returns Q31 FIR filtering result
+    */
+    inline __type filt() { return ( m_out = round_sat( __qdot__( m_bx.view( m_sp.N ).data , m_cfq , m_sp.N ) ) ); }
+
+    /*!
+     *  \brief  Q31 FIR block filtering function
+     *  \param[in ] pointer to the input samples block
+     *  \param[out] pointer to the output samples block
+     *  \param[n  ] number of the samples
+     *  \details the function filters the whole block: out[ i ] is the filtering result for in[ i ]
+    */
+    inline void process( const __type *in , __type *out , __ix32 n )
+    {
+        for( __ix32 i = 0 ; i < n ; i++ )
+        {
+            m_bx.fill_buff( &in[i] );
+            out[i] = filt();
+        }
+    }
+
+    /*!
+     *  \brief Q31 FIR filtering () operator
+     *  \param[input] pointer to the input data
+     *  \return the () operator calls filt( T2 *input ) function that returns FIR filtering result
+    */
+    template< typename T2 > inline __type operator() ( T2 *input ) { return filt( input ); }
+};
+
+/*! \brief 32-bit floating point comb FIR filter */
+template<> class fcomb<__fx32>
+{
+    typedef __fx32 __type ;
+private:
+
+    /*! \brief input signal nominal frequency  , Hz */
+    __fx64 m_Fn;
+    /*! \brief input signal sampling frequency , Hz */
+    __fx64 m_Fs;
+    /*! \brief input signal nominal period     , s */
+    __fx64 m_Ts;
+    /*! \brief comb filter order */
+    __ix32 m_order;
+
+    /*! \brief comb filter buffer */
+     mirror_ring_buffer< __type , __DELAY_LINE_CAPACITY > m_bx;
+
+public:
+
+    /*! \brief filter output */
+    __fx64 m_out;
+    /*! \brief filter frequency phase response */
+    __fx64 m_pH;
+    /*! \brief filter frequency amplitude response */
+    __fx64 m_Km;
+
+    /*!
+     *  \brief comb filter initialization function
+     *  \param[Fs] - input signal sampling frequency
+     *  \param[Fn] - input signal nominal frequency
+    */
+    __ix32 init( __fx64 Fs , __fx64 Fn )
+    {
+        m_Fs      = Fs;
+        m_Fn      = Fn;
+        m_Ts      = 1 / m_Fs;
+        m_order   = m_Fs / m_Fn / 2;
+        m_out     = 0;
+        m_Km      = 0;
+        m_pH      = 0;
+        return 0;
+    }
+
+    /*! \brief memory allocation function */
+    __ix32 allocate()
+    {
+        return m_bx.allocate( m_order + 1 );
+    }
+
+    /*! \brief memory deallocation function */
+    void deallocate()
+    {
+        m_bx.deallocate();
+    }
+
+    /*! \brief default constructor */
+    fcomb()
+    {
+        m_Fs      = 4000;
+        m_Fn      = 50;
+        m_Ts      = 1 / m_Fs;
+        m_order   = m_Fs / m_Fn / 2;
+        m_out     = 0;
+        m_Km      = 0;
+        m_pH      = 0;
+    }
+
+    /*! \brief default destructor */
+    ~fcomb(){ deallocate(); };
+
+    /*!
+     *  \brief  comb filter state saving function
+     *  \param[blob] - pointer to the state memory block or null pointer to compute the state size only
+     *  \return The function stores the filter parameters , buffer and output into the state memory block
+     *          and returns the state size , bytes
+    */
+    __ix32 save_state( void *blob )
+    {
+        char  *data = ( char* )blob;
+        __ix32 pos  = 0;
+        __state_begin__( data , pos , "fcomb<fx32>" );
+        __state_put__( data , pos , &m_Fn );
+        __state_put__( data , pos , &m_Fs );
+        __state_put__( data , pos , &m_Ts );
+        __state_put__( data , pos , &m_order );
+        __buff_put__ ( data , pos , m_bx );
+        __state_put__( data , pos , &m_out );
+        return __state_end__( data , pos );
+    }
+
+    /*!
+     *  \brief  comb filter state loading function
+     *  \param[blob] - pointer to the state memory block
+     *  \param[size] - available memory size , bytes
+     *  \return The function restores the filter and returns the number of the bytes read
+     *          or 0 if the state can not be restored. The filter is not changed if the state is not valid.
+    */
+    __ix32 load_state( const void *blob , __ix32 size )
+    {
+        const char *data = ( const char* )blob;
+        __ix32 pos = 0 , end = __state_open__( data , size , pos , "fcomb<fx32>" ) , order = 0;
+        __fx64 Fn = 0 , Fs = 0 , Ts = 0 , out = 0;
+        if( end == 0 ) return 0;
+
+        if( !__state_get__( data , end , pos , &Fn ) || !__state_get__( data , end , pos , &Fs ) ||
+            !__state_get__( data , end , pos , &Ts ) || !__state_get__( data , end , pos , &order ) ) return 0;
+        if( order < 0 || !__state_room__< __type >( end , pos , order ) ) return 0;
+
+        // the buffer is restored into the temporary , that replaces the filter buffer only on success:
+        mirror_ring_buffer< __type , __DELAY_LINE_CAPACITY > bx;
+        if( !bx.allocate( order + 1 ) || !__buff_get__( data , end , pos , bx ) ||
+            !__state_get__( data , end , pos , &out ) || pos != end ) return 0;
+
+        m_Fn    = Fn;
+        m_Fs    = Fs;
+        m_Ts    = Ts;
+        m_order = order;
+        m_out   = out;
+        m_bx.swap( bx );
+        return end;
+    }
+
+    /*! \brief frequency response computation function */
+    fir_fr< __fx64 > freq_resp( __fx64 F )
+    {
+        __fx64 Re = 1 - cos(-6.283185307179586476925286766559  * m_order * F * m_Ts);
+        __fx64 Im = 0 - sin(-6.283185307179586476925286766559  * m_order * F * m_Ts);
+        m_pH = atan2(Im, Re);
+        m_Km = sqrt(Re * Re + Im * Im) * 0.5;
+        return { m_Km , m_pH };
+    }
+
+    /*!
+     *  \brief 32-bit floating point filtering function
+     *  \param[input] - pointer to the input signal samples buffer
+     *  \return The function returns filtering result
+    */
+    inline __fx64 filt( __type *input)
+    {
+        m_bx( input );
+        return ( m_out = (__fx64)*input - (__fx64)m_bx[ m_order ] );
+    }
+
+    /*!
+     *  \brief 64-bit floating point filtering function
+     *  \param[input] - pointer to the input signal samples buffer
+     *  \return The function returns filtering result
+    */
+    inline __fx64 filt( __fx64 *input)
+    {
+        m_bx( input );
+        return ( m_out = *input - m_bx[ m_order ] );
+    }
+
+    /*!
+     *  \brief 32-bit floating point filtering operator
+     *  \param[input] - pointer to the input signal samples buffer
+     *  \return The operatoe calls the function that returns filtering result
+    */
+    inline __fx64 operator ()( __type *input ) { return filt(input); }
+
+    /*!
+     *  \brief 64-bit floating point filtering operator
+     *  \param[input] - pointer to the input signal samples buffer
+     *  \return The operatoe calls the function that returns filtering result
+    */
+    inline __fx64 operator ()( __fx64 *input ) { return filt(input); }
+};
+
+/*! \brief 64-bit floating point comb FIR filter */
+template<> class fcomb<__fx64>
+{
+    typedef __fx64 __type ;
+private:
+
+    /*! \brief input signal nominal frequency  , Hz */
+    __fx64 m_Fn;
+    /*! \brief input signal sampling frequency , Hz */
+    __fx64 m_Fs;
+    /*! \brief input signal nominal period     , s */
+    __fx64 m_Ts;
+    /*! \brief comb filter order */
+    __ix32 m_order;
+
+    /*! \brief comb filter buffer */
+     mirror_ring_buffer< __type , __DELAY_LINE_CAPACITY > m_bx;
+
+public:
+
+    /*! \brief filter output */
+    __fx64 m_out;
+    /*! \brief filter frequency phase response */
+    __fx64 m_pH;
+    /*! \brief filter frequency amplitude response */
+    __fx64 m_Km;
+
+    /*!
+     *  \brief comb filter initialization function
+     *  \param[Fs] - input signal sampling frequency
+     *  \param[Fn] - input signal nominal frequency
+    */
+    __ix32 init( __fx64 Fs , __fx64 Fn )
+    {
+        m_Fs      = Fs;
+        m_Fn      = Fn;
+        m_Ts      = 1 / m_Fs;
+        m_order   = m_Fs / m_Fn / 2;
+        m_out     = 0;
+        m_Km      = 0;
+        m_pH      = 0;
+        return 0;
+    }
+
+    /*! \brief memory allocation function */
+    __ix32 allocate()
+    {
+        return m_bx.allocate( m_order + 1 );
+    }
+
+    /*! \brief memory deallocation function */
+    void deallocate()
+    {
+        m_bx.deallocate();
+    }
+
+    /*! \brief default constructor */
+    fcomb()
+    {
+        m_Fs      = 4000;
+        m_Fn      = 50;
+        m_Ts      = 1 / m_Fs;
+        m_order   = m_Fs / m_Fn / 2;
+        m_out     = 0;
+        m_Km      = 0;
+        m_pH      = 0;
+    }
+
+    /*! \brief default destructor */
+    ~fcomb(){ deallocate(); };
+
+    /*!
+     *  \brief  comb filter state saving function
+     *  \param[blob] - pointer to the state memory block or null pointer to compute the state size only
+     *  \return The function stores the filter parameters , buffer and output into the state memory block
+     *          and returns the state size , bytes
+    */
+    __ix32 save_state( void *blob )
+    {
+        char  *data = ( char* )blob;
+        __ix32 pos  = 0;
+        __state_begin__( data , pos , "fcomb<fx64>" );
+        __state_put__( data , pos , &m_Fn );
+        __state_put__( data , pos , &m_Fs );
+        __state_put__( data , pos , &m_Ts );
+        __state_put__( data , pos , &m_order );
+        __buff_put__ ( data , pos , m_bx );
+        __state_put__( data , pos , &m_out );
+        return __state_end__( data , pos );
+    }
+
+    /*!
+     *  \brief  comb filter state loading function
+     *  \param[blob] - pointer to the state memory block
+     *  \param[size] - available memory size , bytes
+     *  \return The function restores the filter and returns the number of the bytes read
+     *          or 0 if the state can not be restored. The filter is not changed if the state is not valid.
+    */
+    __ix32 load_state( const void *blob , __ix32 size )
+    {
+        const char *data = ( const char* )blob;
+        __ix32 pos = 0 , end = __state_open__( data , size , pos , "fcomb<fx64>" ) , order = 0;
+        __fx64 Fn = 0 , Fs = 0 , Ts = 0 , out = 0;
+        if( end == 0 ) return 0;
+
+        if( !__state_get__( data , end , pos , &Fn ) || !__state_get__( data , end , pos , &Fs ) ||
+            !__state_get__( data , end , pos , &Ts ) || !__state_get__( data , end , pos , &order ) ) return 0;
+        if( order < 0 || !__state_room__< __type >( end , pos , order ) ) return 0;
+
+        // the buffer is restored into the temporary , that replaces the filter buffer only on success:
+        mirror_ring_buffer< __type , __DELAY_LINE_CAPACITY > bx;
+        if( !bx.allocate( order + 1 ) || !__buff_get__( data , end , pos , bx ) ||
+            !__state_get__( data , end , pos , &out ) || pos != end ) return 0;
+
+        m_Fn    = Fn;
+        m_Fs    = Fs;
+        m_Ts    = Ts;
+        m_order = order;
+        m_out   = out;
+        m_bx.swap( bx );
+        return end;
+    }
+
+    /*! \brief frequency response computation function */
+    fir_fr< __fx64 > freq_resp( __fx64 F )
+    {
+        __fx64 Re = 1 - cos(-6.283185307179586476925286766559  * m_order * F * m_Ts);
+        __fx64 Im = 0 - sin(-6.283185307179586476925286766559  * m_order * F * m_Ts);
+        m_pH = atan2(Im, Re);
+        m_Km = sqrt(Re * Re + Im * Im) * 0.5;
+        return { m_Km , m_pH };
+    }
+
+    /*!
+     *  \brief 32-bit floating point filtering function
+     *  \param[input] - pointer to the input signal samples buffer
+     *  \return The function returns filtering result
+    */
+    inline __fx64 filt( __type *input)
+    {
+        m_bx( input );
+        m_out = (__fx64)*input - (__fx64)m_bx[ m_order ];
+        return m_out;
+    }
+
+    /*!
+     *  \brief 32-bit floating point filtering operator
+     *  \param[input] - pointer to the input signal samples buffer
+     *  \return The operatoe calls the function that returns filtering result
+    */
+    inline __fx64 operator ()( __type *input ) { return filt(input); }
+};
+
+/*! \brief 32-bit floating point equalized comb FIR filter */
+template<> class fcombeq<__fx32>
+{
+    typedef __fx32 __type ;
+private:
+
+    /*! \brief input signal frequency deviation from nominal for which the amplitude frequency response slope compensation is implemented , Hz */
+    __fx64 m_dF;
+    /*! \brief residual amplitude frequency response slope for the input signal frequency deviation dF from nominal , p.u. */
+    __fx64 m_d_Amp;
+    /*! \brief input signal nominal frequency  , Hz */
+    __fx64 m_Fn;
+    /*! \brief input signal sampling frequency , Hz */
+    __fx64 m_Fs;
+    /*! \brief input signal sampling period , Hz */
+    __fx64 m_Ts;
+    /*! \brief auxiliary coefficient K1 */
+    __fx64 m_K1;
+    /*! \brief auxiliary coefficient K2 */
+    __fx64 m_K2;
+    /*! \brief filter order */
+    __ix32 m_order;
+    /*! \brief auxiliary coefficient ElemNum1 */
+    __ix32 m_ElemNum1;
+    /*! \brief auxiliary coefficient ElemNum2 */
+    __ix32 m_ElemNum2;
+
+    /*! \brief comb filter buffer */
+     mirror_ring_buffer< __type , __DELAY_LINE_CAPACITY > m_bx;
+
+public:
+
+    /*! \brief filter output */
+    __fx64 m_out;
+    /*! \brief filter frequency phase response */
+    __fx64 m_pH;
+    /*! \brief filter frequency amplitude response */
+    __fx64 m_Km;
+
+    /*! \brief default constructor */
+    fcombeq()
+    {
+        m_Fs       = 4000;
+        m_Fn       = 50;
+        m_dF       = 5;
+        m_d_Amp    = 0;
+        m_order    = m_Fs / m_Fn / 2;
+        m_ElemNum1 = 1 * m_order;
+        m_ElemNum2 = 2 * m_order;
+        m_Ts       = 1 / m_Fs;
+        m_out      = 0;
+        m_Km       = 0;
+        m_pH       = 0;
+    }
+
+    /*! \brief default destructor */
+    ~fcombeq(){ deallocate(); }
+
+    /*!
+     *  \brief  equalized comb filter state saving function
+     *  \param[blob] - pointer to the state memory block or null pointer to compute the state size only
+     *  \return The function stores the filter parameters , coefficients , buffer and output into the state memory block
+     *          and returns the state size , bytes
+    */
+    __ix32 save_state( void *blob )
+    {
+        char  *data = ( char* )blob;
+        __ix32 pos  = 0;
+        __fx64 params[] = { m_dF , m_d_Amp , m_Fn , m_Fs , m_Ts , m_K1 , m_K2 };
+        __ix32 counts[] = { m_order , m_ElemNum1 , m_ElemNum2 };
+        __state_begin__( data , pos , "fcombeq<fx32>" );
+        __state_put__( data , pos , params , 7 );
+        __state_put__( data , pos , counts , 3 );
+        __buff_put__ ( data , pos , m_bx );
+        __state_put__( data , pos , &m_out );
+        return __state_end__( data , pos );
+    }
+
+    /*!
+     *  \brief  equalized comb filter state loading function
+     *  \param[blob] - pointer to the state memory block
+     *  \param[size] - available memory size , bytes
+     *  \return The function restores the filter without the coefficients recomputation and returns the number of the bytes read
+     *          or 0 if the state can not be restored. The filter is not changed if the state is not valid.
+    */
+    __ix32 load_state( const void *blob , __ix32 size )
+    {
+        const char *data = ( const char* )blob;
+        __ix32 pos = 0 , end = __state_open__( data , size , pos , "fcombeq<fx32>" ) , counts[ 3 ];
+        __fx64 params[ 7 ] , out = 0;
+        if( end == 0 ) return 0;
+
+        if( !__state_get__( data , end , pos , params , 7 ) || !__state_get__( data , end , pos , counts , 3 ) ) return 0;
+        if( !__state_room__< __type >( end , pos , counts[0] ) || counts[1] != counts[0] || counts[2] != 2 * counts[0] ||
+            !__state_room__< __type >( end , pos , counts[2] ) ) return 0;
+
+        // the buffer is restored into the temporary , that replaces the filter buffer only on success:
+        mirror_ring_buffer< __type , __DELAY_LINE_CAPACITY > bx;
+        if( !bx.allocate( counts[2] + 1 ) || !__buff_get__( data , end , pos , bx ) ||
+            !__state_get__( data , end , pos , &out ) || pos != end ) return 0;
+
+        m_dF       = params[0];
+        m_d_Amp    = params[1];
+        m_Fn       = params[2];
+        m_Fs       = params[3];
+        m_Ts       = params[4];
+        m_K1       = params[5];
+        m_K2       = params[6];
+        m_order    = counts[0];
+        m_ElemNum1 = counts[1];
+        m_ElemNum2 = counts[2];
+        m_out      = out;
+        m_bx.swap( bx );
+        return end;
+    }
+
+    /*!
+     *  \brief comb filter initialization function
+     *  \param[ Fs    ] - input signal sampling frequency
+     *  \param[ Fn    ] - input signal nominal frequency
+     *  \param[ dF    ] - input signal frequency deviation from nominal for which the amplitude frequency response slope compensation is implemented , Hz
+     *  \param[ d_Amp ] - residual amplitude frequency response slope for the input signal frequency deviation dF from nominal , p.u.
+    */
+    void init( __fx64 Fs, __fx64 Fn, __fx64 dF, __fx64 d_Amp )
+    {
+        m_Fs       = Fs;
+        m_Fn       = Fn;
+        m_dF       = dF;
+        m_d_Amp	   = d_Amp;
+        m_order    = m_Fs / m_Fn / 2;
+        m_ElemNum1 = 1 * m_order;
+        m_ElemNum2 = 2 * m_order;
+        m_Ts       = 1 / m_Fs;
+        m_K1       = ( 1 + 0.19/0.5 );
+        m_K2       =  0.19 / 0.5;
+        m_out      = 0;
+        m_Km       = 0;
+        m_pH       = 0;
+    }
+
+    /*! \brief memory allocation function */
+    __ix32 allocate()
+    {
+        // auxiliary coefficients:
+        __fx64 A =  0.5 - 0.5 * cos(-6.283185307179586476925286766559 * (m_Fn + m_dF) * (__fx64)m_order * m_Ts );
+        __fx64 B =  1.0 - cos(-6.283185307179586476925286766559 * (m_Fn + m_dF) * (__fx64)m_order * 2.0 * m_Ts);
+        __fx64 C = -0.5 * sin(-6.283185307179586476925286766559 * (m_Fn + m_dF) * (__fx64)m_order * m_Ts);
+        __fx64 D = -sin(-6.283185307179586476925286766559 * (m_Fn + m_dF) * (__fx64)m_order * 2.0 * m_Ts);
+
+        // square equation coefficients:
+        __fx64 a  = 1;
+        __fx64 b  = 2 * ( A * B + C * D ) / (B * B + D * D);
+        __fx64 c  = (A * A + C * C - (1 + m_d_Amp / 100) * (1 + m_d_Amp / 100) ) / (B * B + D * D);
+
+        // square equation solve:
+        __fx64 discr  = b * b - 4 * a * c;
+        __fx64 K1     = 0;
+        __fx64 K2     = 0;
+
+        if ( discr > 0 ) // discriminant check
+        {
+            // roots computation:
+            K1 = ( -b - sqrt( discr ) ) * 0.5;
+            K2 = ( -b + sqrt( discr ) ) * 0.5;
+
+            // take the greates of the roots ( although, it does not matter which root you take... ):
+            m_K1 = (1 + fmax(K1 , K2) / 0.5);
+            m_K2 = fmax(K1, K2) / 0.5;
+        }
+        else // if discriminant is negative, then the amplitude frequency slope is not compensated
+        {
+            m_K1 = 1;
+            m_K2 = 0;
+        }
+
+        return m_bx.allocate( m_ElemNum2 + 1 );;
+    }
+
+    /*! \brief memory deallocation function */
+    void deallocate()
+    {
+        m_bx.deallocate();
+    }
+
+    /*! \brief frequency response computation function */
+    fir_fr< __fx64 > freq_resp( __fx64 F , bool mode = 0 )
+    {
+        __fx64 Re  = 0 , Im  = 0;
+
+        if( !mode ) // even filter
+        {
+            Re = m_K1 - cos(-PI2 * (__fx64)m_order * F * m_Ts) - m_K2 * cos(-PI2 * 2 * (__fx64)m_order * F * m_Ts);
+            Im = 0    - sin(-PI2 * (__fx64)m_order * F * m_Ts) - m_K2 * sin(-PI2 * 2 * (__fx64)m_order * F * m_Ts);
+        }
+        else // odd filter
+        {
+            Re = m_K1 + cos(-PI2 * (__fx64)m_order * F * m_Ts) - m_K2 * cos(-PI2 * 2 * (__fx64)m_order * F * m_Ts);
+            Im = 0    + sin(-PI2 * (__fx64)m_order * F * m_Ts) - m_K2 * sin(-PI2 * 2 * (__fx64)m_order * F * m_Ts);
+        }
+
+        m_pH = atan2(Im, Re);
+        m_Km = sqrt(Re * Re + Im * Im);
+        return { m_Km , m_pH };
+    }
+
+    /*!
+     *  \brief 32-bit floating point filtering function
+     *  \param[input] - pointer to the input signal samples buffer
+     *  \return The function returns filtering result
+    */
+    inline __fx64 filt( __type *input , bool odd = true)
+    {
+        m_bx(input);
+        return ( m_out = ( odd ) ? ( (__fx64)*input * m_K1 - (__fx64)m_bx[m_ElemNum1] - (__fx64)m_bx[m_ElemNum2] * m_K2 ) : ( (__fx64)*input * m_K1 + (__fx64)m_bx[m_ElemNum1] - (__fx64)m_bx[m_ElemNum2] * m_K2 ) );
+    }
+
+    /*!
+     *  \brief 64-bit floating point filtering function
+     *  \param[input] - pointer to the input signal samples buffer
+     *  \return The function returns filtering result
+    */
+    inline __fx64 filt( __fx64 *input , bool odd = true)
+    {
+        m_bx(input);
+        return ( m_out = ( odd ) ? ( *input * m_K1 - m_bx[m_ElemNum1] - m_bx[m_ElemNum2] * m_K2 ) : ( *input * m_K1 + (__fx64)m_bx[m_ElemNum1] - m_bx[m_ElemNum2] * m_K2 ) );
+    }
+
+    /*!
+     *  \brief 32-bit floating point filtering operator
+     *  \param[input] - pointer to the input signal samples buffer
+     *  \return The operatoe calls the function that returns filtering result
+    */
+    inline __fx64 operator ()( __type *input , bool odd = true ) { return filt( input , odd ); }
+
+    /*!
+     *  \brief 64-bit floating point filtering operator
+     *  \param[input] - pointer to the input signal samples buffer
+     *  \return The operatoe calls the function that returns filtering result
+    */
+    inline __fx64 operator ()( __fx64 *input , bool odd = true ) { return filt( input , odd ); }
+};
+
+/*! \brief 64-bit floating point equalized comb FIR filter */
+template<> class fcombeq<__fx64>
+{
+    typedef __fx64 __type ;
+private:
+
+    /*! \brief input signal frequency deviation from nominal for which the amplitude frequency response slope compensation is implemented , Hz */
+    __fx64 m_dF;
+    /*! \brief residual amplitude frequency response slope for the input signal frequency deviation dF from nominal , p.u. */
+    __fx64 m_d_Amp;
+    /*! \brief input signal nominal frequency  , Hz */
+    __fx64 m_Fn;
+    /*! \brief input signal sampling frequency , Hz */
+    __fx64 m_Fs;
+    /*! \brief input signal sampling period , Hz */
+    __fx64 m_Ts;
+    /*! \brief auxiliary coefficient K1 */
+    __fx64 m_K1;
+    /*! \brief auxiliary coefficient K2 */
+    __fx64 m_K2;
+    /*! \brief filter order */
+    __ix32 m_order;
+    /*! \brief auxiliary coefficient ElemNum1 */
+    __ix32 m_ElemNum1;
+    /*! \brief auxiliary coefficient ElemNum2 */
+    __ix32 m_ElemNum2;
+
+    /*! \brief comb filter buffer */
+     mirror_ring_buffer< __type , __DELAY_LINE_CAPACITY > m_bx;
+
+public:
+
+    /*! \brief filter output */
+    __fx64 m_out;
+    /*! \brief filter frequency phase response */
+    __fx64 m_pH;
+    /*! \brief filter frequency amplitude response */
+    __fx64 m_Km;
+
+    /*! \brief default constructor */
+    fcombeq()
+    {
+        m_Fs       = 4000;
+        m_Fn       = 50;
+        m_dF       = 5;
+        m_d_Amp    = 0;
+        m_order    = m_Fs / m_Fn / 2;
+        m_ElemNum1 = 1 * m_order;
+        m_ElemNum2 = 2 * m_order;
+        m_Ts       = 1 / m_Fs;
+        m_out      = 0;
+        m_Km       = 0;
+        m_pH       = 0;
+    }
+
+    /*! \brief default destructor */
+    ~fcombeq(){ deallocate(); }
+
+    /*!
+     *  \brief  equalized comb filter state saving function
+     *  \param[blob] - pointer to the state memory block or null pointer to compute the state size only
+     *  \return The function stores the filter parameters , coefficients , buffer and output into the state memory block
+     *          and returns the state size , bytes
+    */
+    __ix32 save_state( void *blob )
+    {
+        char  *data = ( char* )blob;
+        __ix32 pos  = 0;
+        __fx64 params[] = { m_dF , m_d_Amp , m_Fn , m_Fs , m_Ts , m_K1 , m_K2 };
+        __ix32 counts[] = { m_order , m_ElemNum1 , m_ElemNum2 };
+        __state_begin__( data , pos , "fcombeq<fx64>" );
+        __state_put__( data , pos , params , 7 );
+        __state_put__( data , pos , counts , 3 );
+        __buff_put__ ( data , pos , m_bx );
+        __state_put__( data , pos , &m_out );
+        return __state_end__( data , pos );
+    }
+
+    /*!
+     *  \brief  equalized comb filter state loading function
+     *  \param[blob] - pointer to the state memory block
+     *  \param[size] - available memory size , bytes
+     *  \return The function restores the filter without the coefficients recomputation and returns the number of the bytes read
+     *          or 0 if the state can not be restored. The filter is not changed if the state is not valid.
+    */
+    __ix32 load_state( const void *blob , __ix32 size )
+    {
+        const char *data = ( const char* )blob;
+        __ix32 pos = 0 , end = __state_open__( data , size , pos , "fcombeq<fx64>" ) , counts[ 3 ];
+        __fx64 params[ 7 ] , out = 0;
+        if( end == 0 ) return 0;
+
+        if( !__state_get__( data , end , pos , params , 7 ) || !__state_get__( data , end , pos , counts , 3 ) ) return 0;
+        if( !__state_room__< __type >( end , pos , counts[0] ) || counts[1] != counts[0] || counts[2] != 2 * counts[0] ||
+            !__state_room__< __type >( end , pos , counts[2] ) ) return 0;
+
+        // the buffer is restored into the temporary , that replaces the filter buffer only on success:
+        mirror_ring_buffer< __type , __DELAY_LINE_CAPACITY > bx;
+        if( !bx.allocate( counts[2] + 1 ) || !__buff_get__( data , end , pos , bx ) ||
+            !__state_get__( data , end , pos , &out ) || pos != end ) return 0;
+
+        m_dF       = params[0];
+        m_d_Amp    = params[1];
+        m_Fn       = params[2];
+        m_Fs       = params[3];
+        m_Ts       = params[4];
+        m_K1       = params[5];
+        m_K2       = params[6];
+        m_order    = counts[0];
+        m_ElemNum1 = counts[1];
+        m_ElemNum2 = counts[2];
+        m_out      = out;
+        m_bx.swap( bx );
+        return end;
+    }
+
+    /*!
+     *  \brief comb filter initialization function
+     *  \param[ Fs    ] - input signal sampling frequency
+     *  \param[ Fn    ] - input signal nominal frequency
+     *  \param[ dF    ] - input signal frequency deviation from nominal for which the amplitude frequency response slope compensation is implemented , Hz
+     *  \param[ d_Amp ] - residual amplitude frequency response slope for the input signal frequency deviation dF from nominal , p.u.
+    */
+    void init( __fx64 Fs, __fx64 Fn, __fx64 dF, __fx64 d_Amp )
+    {
+        m_Fs       = Fs;
+        m_Fn       = Fn;
+        m_dF       = dF;
+        m_d_Amp	   = d_Amp;
+        m_order    = m_Fs / m_Fn / 2;
+        m_ElemNum1 = 1 * m_order;
+        m_ElemNum2 = 2 * m_order;
+        m_Ts       = 1 / m_Fs;
+        m_K1       = ( 1 + 0.19/0.5 );
+        m_K2       =  0.19 / 0.5;
+        m_out      = 0;
+        m_Km       = 0;
+        m_pH       = 0;
+    }
+
+    /*! \brief memory allocation function */
+    __ix32 allocate()
+    {
+        // auxiliary coefficients:
+        __fx64 A =  0.5 - 0.5 * cos(-6.283185307179586476925286766559 * (m_Fn + m_dF) * (__fx64)m_order * m_Ts );
+        __fx64 B =  1.0 - cos(-6.283185307179586476925286766559 * (m_Fn + m_dF) * (__fx64)m_order * 2.0 * m_Ts);
+        __fx64 C = -0.5 * sin(-6.283185307179586476925286766559 * (m_Fn + m_dF) * (__fx64)m_order * m_Ts);
+        __fx64 D = -sin(-6.283185307179586476925286766559 * (m_Fn + m_dF) * (__fx64)m_order * 2.0 * m_Ts);
+
+        // square equation coefficients:
+        __fx64 a  = 1;
+        __fx64 b  = 2 * ( A * B + C * D ) / (B * B + D * D);
+        __fx64 c  = (A * A + C * C - (1 + m_d_Amp / 100) * (1 + m_d_Amp / 100) ) / (B * B + D * D);
+
+        // square equation solve:
+        __fx64 discr  = b * b - 4 * a * c;
+        __fx64 K1     = 0;
+        __fx64 K2     = 0;
+
+        if ( discr > 0 ) // discriminant check
+        {
+            // roots computation:
+            K1 = ( -b - sqrt( discr ) ) * 0.5;
+            K2 = ( -b + sqrt( discr ) ) * 0.5;
+
+            // take the greates of the roots ( although, it does not matter which root you take... ):
+            m_K1 = (1 + fmax(K1 , K2) / 0.5);
+            m_K2 = fmax(K1, K2) / 0.5;
+        }
+        else // if discriminant is negative, then the amplitude frequency slope is not compensated
+        {
+            m_K1 = 1;
+            m_K2 = 0;
+        }
+
+        return m_bx.allocate( m_ElemNum2 + 1 );;
+    }
+
+    /*! \brief memory deallocation function */
+    void deallocate()
+    {
+        m_bx.deallocate();
+    }
+
+    /*! \brief frequency response computation function */
+    fir_fr< __fx64 > freq_resp( __fx64 F , bool mode = 0 )
+    {
+        __fx64 Re  = 0 , Im  = 0;
+
+        if( !mode ) // even filter
+        {
+            Re = m_K1 - cos(-PI2 * (__fx64)m_order * F * m_Ts) - m_K2 * cos(-PI2 * 2 * (__fx64)m_order * F * m_Ts);
+            Im = 0    - sin(-PI2 * (__fx64)m_order * F * m_Ts) - m_K2 * sin(-PI2 * 2 * (__fx64)m_order * F * m_Ts);
+        }
+        else // odd filter
+        {
+            Re = m_K1 + cos(-PI2 * (__fx64)m_order * F * m_Ts) - m_K2 * cos(-PI2 * 2 * (__fx64)m_order * F * m_Ts);
+            Im = 0    + sin(-PI2 * (__fx64)m_order * F * m_Ts) - m_K2 * sin(-PI2 * 2 * (__fx64)m_order * F * m_Ts);
+        }
+
+        m_pH = atan2(Im, Re);
+        m_Km = sqrt(Re * Re + Im * Im);
+        return { m_Km , m_pH };
+    }
+
+    /*!
+     *  \brief 32-bit floating point filtering function
+     *  \param[input] - pointer to the input signal samples buffer
+     *  \return The function returns filtering result
+    */
+    inline __fx64 filt( __type *input , bool odd = true)
+    {
+        m_bx(input);
+        return ( m_out = ( odd ) ? ( (__fx64)*input * m_K1 - (__fx64)m_bx[m_ElemNum1] - (__fx64)m_bx[m_ElemNum2] * m_K2 ) : ( (__fx64)*input * m_K1 + (__fx64)m_bx[m_ElemNum1] - (__fx64)m_bx[m_ElemNum2] * m_K2 ) );
+    }
+
+    /*!
+     *  \brief 32-bit floating point filtering operator
+     *  \param[input] - pointer to the input signal samples buffer
+     *  \return The operatoe calls the function that returns filtering result
+    */
+    inline __fx64 operator ()( __type *input , bool odd = true ) { return filt( input , odd ); }
+};
+
+/*! \brief defines the maximum sparse FIR filter tap delay , samples */
+#ifndef __SPARSE_FIR_MAX_DELAY
+#define __SPARSE_FIR_MAX_DELAY ( 1 << 24 )
+#endif
+
+/*!
+ *  \brief sparse FIR filter
+ *  \details The filter output is computed as y[n] = sum( cf[ i ] * x[ n - taps[ i ] ] ) , i = 0 ... ntaps - 1.
+ *           The filter keeps the whole delay line , but reads only the taps by means of the buffer gathering
+ *           function , so the comb and notch structures having long delays and few taps cost O( ntaps ).
+*/
+template< typename T > class sparse_fir
+{
+    typedef T    __type ;
+    typedef void __void ;
+
+    /*! \brief taps list ( delays , samples ) */
+    __ix32 *m_taps;
+    /*! \brief taps coefficients */
+    __type *m_cf;
+    /*! \brief gathered taps samples */
+    __type *m_gx;
+    /*! \brief number of the taps */
+    __ix32  m_ntaps;
+    /*! \brief maximum delay , samples */
+    __ix32  m_delay;
+
+    /*! \brief input buffer */
+    mirror_ring_buffer< __type , __DELAY_LINE_CAPACITY > m_bx;
+
+public:
+
+    /*! \brief filter output */
+    __type m_out;
+
+    /*!
+     *  \brief sparse FIR filter initialization function
+     *  \param[taps ] - pointer to the taps list ( delays , samples )
+     *  \param[cf   ] - pointer to the taps coefficients
+     *  \param[ntaps] - number of the taps
+     *  \return the function allocates memory for the taps and the input buffer and returns 1 on success. The function
+     *          returns 0 if a tap delay is negative or exceeds __SPARSE_FIR_MAX_DELAY.
+    */
+    __ix32 init( const __ix32 *taps , const __type *cf , __ix32 ntaps )
+    {
+        deallocate();
+        m_ntaps = 0;
+        m_delay = 0;
+        m_out   = 0;
+        if( taps == 0 || cf == 0 || ntaps <= 0 ) return 0;
+        for( __ix32 i = 0 ; i < ntaps ; i++ )
+        {
+            if( taps[i] < 0 || taps[i] > __SPARSE_FIR_MAX_DELAY ) return 0;
+            if( taps[i] > m_delay ) m_delay = taps[i];
+        }
+        m_ntaps = ntaps;
+
+        m_taps = ( __ix32* ) calloc( ntaps , sizeof ( __ix32 ) );
+        m_cf   = ( __type* ) calloc( ntaps , sizeof ( __type ) );
+        m_gx   = ( __type* ) calloc( ntaps , sizeof ( __type ) );
+        if( m_taps == 0 || m_cf == 0 || m_gx == 0 ) return 0;
+
+        memcpy( m_taps , taps , ntaps * sizeof ( __ix32 ) );
+        memcpy( m_cf   , cf   , ntaps * sizeof ( __type ) );
+        if( !m_bx.allocate( m_delay + 1 ) || m_bx.getBuffSize() <= m_delay ) { deallocate(); m_ntaps = 0; return 0; }
+        return 1;
+    }
+
+    /*! \brief memory deallocation function */
+    __void deallocate()
+    {
+        if( m_taps != 0 ) { free( m_taps ); m_taps = 0; }
+        if( m_cf   != 0 ) { free( m_cf   ); m_cf   = 0; }
+        if( m_gx   != 0 ) { free( m_gx   ); m_gx   = 0; }
+        m_bx.deallocate();
+    }
+
+    /*! \brief default constructor */
+    sparse_fir()
+    {
+        m_taps  = 0;
+        m_cf    = 0;
+        m_gx    = 0;
+        m_ntaps = 0;
+        m_delay = 0;
+        m_out   = 0;
+    }
+
+    /*! \brief destructor */
+    ~sparse_fir() { deallocate(); }
+
+    /*!
+     *  \brief  frequency response computation function
+     *  \param[Fs] sampling frequency , Hz
+     *  \param[F ] input frequency    , Hz
+     *  \return the function returns fir_fr data structure
+    */
+    fir_fr< __fx64 > freq_resp( __fx64 Fs , __fx64 F )
+    {
+        __fx64 Re = 0 , Im = 0 , Ts = 1 / Fs;
+        for( __ix32 i = 0 ; i < m_ntaps ; i++ )
+        {
+            Re += cos( -PI2 * m_taps[i] * F * Ts ) * m_cf[i];
+            Im += sin( -PI2 * m_taps[i] * F * Ts ) * m_cf[i];
+        }
+        return { sqrt( Re * Re + Im * Im ) , atan2( Im , Re ) };
+    }
+
+    /*!
+     *  \brief  sparse FIR filter state saving function
+     *  \param[blob] pointer to the state memory block or null pointer to compute the state size only
+     *  \return the function stores the taps , coefficients , input buffer and output into the state memory block
+     *          and returns the state size , bytes. The function returns 0 if the filter is not initialized.
+    */
+    __ix32 save_state( void *blob )
+    {
+        char  *data = ( char* )blob;
+        __ix32 pos  = 0;
+        if( m_taps == 0 ) return 0;
+        __state_begin__( data , pos , "sparse_fir" );
+        __state_put__( data , pos , &m_ntaps );
+        __state_put__( data , pos , m_taps , m_ntaps );
+        __state_put__( data , pos , m_cf   , m_ntaps );
+        __buff_put__ ( data , pos , m_bx );
+        __state_put__( data , pos , &m_out );
+        return __state_end__( data , pos );
+    }
+
+    /*!
+     *  \brief  sparse FIR filter state loading function
+     *  \param[blob] pointer to the state memory block
+     *  \param[size] available memory size , bytes
+     *  \return the function restores the filter and returns the number of the bytes read or 0 if the state can not be restored.
+     *          The tap delays are checked as well as by init. The filter is not changed if the state is not valid.
+    */
+    __ix32 load_state( const void *blob , __ix32 size )
+    {
+        const char *data = ( const char* )blob;
+        __ix32 pos = 0 , end = __state_open__( data , size , pos , "sparse_fir" ) , ntaps = 0 , delay = 0 , ok = 0;
+        __type out = 0;
+        if( end == 0 ) return 0;
+
+        if( !__state_get__( data , end , pos , &ntaps ) ) return 0;
+        if( ntaps <= 0 || !__state_room__< __ix32 >( end , pos , ntaps ) ) return 0;
+
+        // the state is restored into the temporaries , that replace the filter members only on success:
+        mirror_ring_buffer< __type , __DELAY_LINE_CAPACITY > bx;
+        __ix32 *taps = ( __ix32* ) calloc( ntaps , sizeof ( __ix32 ) );
+        __type *cf   = ( __type* ) calloc( ntaps , sizeof ( __type ) );
+        __type *gx   = ( __type* ) calloc( ntaps , sizeof ( __type ) );
+        ok = taps && cf && gx && __state_get__( data , end , pos , taps , ntaps );
+        for( __ix32 i = 0 ; ok && i < ntaps ; i++ )
+        {
+            ok = ( taps[i] >= 0 && taps[i] <= __SPARSE_FIR_MAX_DELAY );
+            if( taps[i] > delay ) delay = taps[i];
+        }
+        ok = ok && __state_get__( data , end , pos , cf , ntaps ) && __state_room__< __type >( end , pos , delay ) &&
+             bx.allocate( delay + 1 ) && ( bx.getBuffSize() > delay ) && __buff_get__( data , end , pos , bx ) &&
+             __state_get__( data , end , pos , &out ) && ( pos == end );
+        if( !ok )
+        {
+            free( taps );
+            free( cf );
+            free( gx );
+            return 0;
+        }
+
+        deallocate();
+        m_taps  = taps;
+        m_cf    = cf;
+        m_gx    = gx;
+        m_ntaps = ntaps;
+        m_delay = delay;
+        m_out   = out;
+        m_bx.swap( bx );
+        return end;
+    }
+
+    /*!
+     *  \brief  filtering function
+     *  \param[input] pointer to the input data
+     *  \return the function returns filtering result
+    */
+    template< typename T2 > inline __type filt( T2 *input )
+    {
+        m_bx( input );
+        m_bx.gather( m_taps , m_gx , m_ntaps );
+        m_out = 0;
+        for( __ix32 i = 0 ; i < m_ntaps ; i++ ) m_out += m_gx[i] * m_cf[i];
+        return m_out;
+    }
+
+    /*!
+     *  \brief filtering () operator
+     *  \param[input] pointer to the input data
+     *  \return the () operator calls filt( T2 *input ) function that returns filtering result
+    */
+    template< typename T2 > inline __type operator() ( T2 *input ) { return filt( input ); }
+};
+
+/*!
+ *  \brief polyphase decimating lowpass FIR filter template class
+ *  \details The filter keeps one output per M input samples. The coefficients h[ i ] are split into M phases
+ *           h_p[ k ] = h[ k * M + p ] and every input sample is routed into its phase history , so the
+ *           output is computed as follows:
+ *           \f[
+ *               y[ m ] = \sum_{ p = 0 }^{ M - 1 } \sum_{ k = 0 }^{ K - 1 } h_p[ k ] * u_p[ m - k ] , \quad
+ *               u_p[ m ] = x[ m * M + M - 1 - p ] , \quad K = \lceil N / M \rceil
+ *           \f]
+ *           Only N multiplications per output are computed instead of N * M for the full rate filter.
+*/
+template< typename T > class fir_decimator
+{
+    typedef T      __type ;
+    typedef bool   __bool ;
+    typedef void   __void ;
+
+    /*! \brief lowpass specification data structure */
+    fir_sp  m_sp;
+
+    /*! \brief decimation factor */
+    __ix32 m_M;
+
+    /*! \brief phase coefficients number */
+    __ix32 m_K;
+
+    /*! \brief lowpass coefficients buffer */
+    __type *m_cf;
+
+    /*! \brief time-reversed phases coefficients ( M rows of K coefficients ) */
+    __type *m_cfp;
+
+    /*! \brief phases histories ( M mirrored rows of 2 * K samples ) */
+    __type *m_bx;
+
+    /*! \brief phases histories write position */
+    __ix32 m_pos;
+
+    /*! \brief decimation phase counter */
+    __ix32 m_phase;
+
+    /*! \brief phase response type */
+    fir_phase m_phase_type;
+
+    /*! \brief time-reversed phases coefficients computation function */
+    __void split()
+    {
+        for( __ix32 p = 0 ; p < m_M ; p++ )
+        {
+            for( __ix32 k = 0 ; k < m_K ; k++ )
+            {
+                __ix32 i = ( m_K - 1 - k ) * m_M + p;
+                m_cfp[ p * m_K + k ] = ( i < m_sp.N ) ? m_cf[ i ] : 0;
+            }
+        }
+    }
+
+public:
+
+    /*! \brief lowpass output */
+    __type m_out;
+
+    /*! \brief lowpass window function object */
+    wind_fcn m_wind;
+
+    /*!
+     *  \brief Lowpass initialization function
+     *  \param[Fs]    - input sampling frequency , Hz
+     *  \param[Fn]    - nominal frequency        , Hz
+     *  \param[Fc]    - cut-off frequency        , Hz
+     *  \param[order] - filter order
+     *  \param[M]     - decimation factor
+     *  \param[scale] - filter scaling flag ( 0 - not-scaled filter , 1 - scaled filter )
+    */
+    __void init( __fx64 Fs , __fx64 Fn , __fx64 Fc , __ix32 order , __ix32 M , __bool scale )
+    {
+        m_sp    = fir_sp{ Fs , Fn , Fc , -1 , 1 / Fs , order , order + 1 , scale , fir_type::lowpass_fir };
+        m_M     = ( M > 0 ) ? M : 1;
+        m_K     = ( m_sp.N + m_M - 1 ) / m_M;
+        m_cf    = 0;
+        m_cfp   = 0;
+        m_bx    = 0;
+        m_pos   = 0;
+        m_phase = 0;
+        m_out   = 0;
+        m_phase_type = fir_linear_phase;
+        m_wind.init( m_sp.N );
+    }
+
+    /*! \brief lowpass memory allocation function */
+    __ix32 allocate()
+    {
+        m_cf  = __fir_wind_design__< __type >( m_sp , m_wind );
+        if( m_cf != 0 && m_phase_type == fir_minimum_phase ) __fir_min_phase__< __type >( m_cf , m_sp.N );
+        m_cfp = ( __type* ) calloc( m_M * m_K , sizeof ( __type ) );
+        m_bx  = ( __type* ) calloc( m_M * m_K * 2 , sizeof ( __type ) );
+        if( m_cf == 0 || m_cfp == 0 || m_bx == 0 ) return 0;
+        split();
+        return 1;
+    }
+
+    /*! \brief lowpass memory deallocation function */
+    __void deallocate()
+    {
+        if( m_cf  != 0 ) { free( m_cf  ); m_cf  = 0; }
+        if( m_cfp != 0 ) { free( m_cfp ); m_cfp = 0; }
+        if( m_bx  != 0 ) { free( m_bx  ); m_bx  = 0; }
+        m_wind.deallocate();
+    }
+
+    /*! \brief default constructor */
+    fir_decimator() { init( 16000 , 50 , 1000 , 64 , 4 , 1 ); }
+
+    /*! \brief destructor */
+    ~fir_decimator() { deallocate(); }
+
+    /*! \brief decimation factor getting function */
+    inline __ix32 factor() { return m_M; }
+
+    /*!
+     *  \brief phase response type setting function
+     *  \param[type] - phase response type
+     *  \details the type is applied at the lowpass design before the polyphase split
+    */
+    inline __void set_phase( fir_phase type ) { m_phase_type = type; }
+
+    /*!
+     *  \brief  phase response type getting function
+     *  \return the function returns the phase response type
+    */
+    inline fir_phase get_phase() { return m_phase_type; }
+
+    /*!
+     *  \brief  group delay computation function
+     *  \param[F] input frequency , Hz
+     *  \return the function returns the lowpass group delay at the frequency F , s
+    */
+    inline __fx64 group_delay( __fx64 F ) { return __fir_group_delay__< __type >( m_sp.Fs , F , m_sp.order , m_cf ) / m_sp.Fs; }
+
+    /*!
+     *  \brief  lowpass frequency response computation function
+     *  \param[F] - input frequency , Hz
+     *  \return the function returns the frequency response at the input sampling frequency
+    */
+    inline fir_fr< __fx64 > freq_resp( __fx64 F ) { return __fir_freq_resp__< __fx64 , __type >( m_sp.Fs , F , m_sp.order , m_cf ); }
+
+    /*!
+     *  \brief  dense frequency response computation function
+     *  \param[fr     ] frequency response grid
+     *  \param[npoints] number of the grid points over [ 0 ; Fs / 2 ] , rounded up to 2^m + 1
+     *  \return the function computes the response by means of one real FFT and returns the number of the grid points
+    */
+    inline __ix32 freq_resp_grid( fir_fr_grid &fr , __ix32 npoints ) { return __fir_freq_resp_grid__< __type >( m_sp.Fs , m_sp.order , m_cf , fr , npoints ); }
+
+    /*!
+     *  \brief  FIR decimator state saving function
+     *  \param[blob] pointer to the state memory block or null pointer to compute the state size only
+     *  \return the function stores the filter specification , phase type , coefficients , phases histories and output
+     *          into the state memory block and returns the state size , bytes
+    */
+    __ix32 save_state( void *blob )
+    {
+        char  *data = ( char* )blob;
+        __ix32 pos  = 0;
+        if( m_cf == 0 ) return 0;
+        __state_begin__( data , pos , "fir_decimator" );
+        __state_put__( data , pos , &m_sp );
+        __state_put__( data , pos , &m_M );
+        __state_put__( data , pos , &m_phase_type );
+        __state_put__( data , pos , m_cf , m_sp.N );
+        __state_put__( data , pos , m_bx , m_M * m_K * 2 );
+        __state_put__( data , pos , &m_pos );
+        __state_put__( data , pos , &m_phase );
+        __state_put__( data , pos , &m_out );
+        return __state_end__( data , pos );
+    }
+
+    /*!
+     *  \brief  FIR decimator state loading function
+     *  \param[blob] pointer to the state memory block
+     *  \param[size] available memory size , bytes
+     *  \return the function restores the filter without the filter redesign and returns the number of the bytes read
+     *          or 0 if the state can not be restored. The filter is not changed if the state is not valid.
+    */
+    __ix32 load_state( const void *blob , __ix32 size )
+    {
+        const char *data = ( const char* )blob;
+        __ix32    pos = 0 , end = __state_open__( data , size , pos , "fir_decimator" ) , M = 0 , K = 0 , bpos = 0 , phase = 0;
+        fir_sp    sp;
+        __ix32    pt  = fir_linear_phase;
+        __type    out = 0;
+        if( end == 0 ) return 0;
+
+        if( !__state_get__( data , end , pos , &sp ) || !__state_get__( data , end , pos , &M ) ||
+            !__state_get__( data , end , pos , &pt ) ) return 0;
+        if( sp.N <= 0 || sp.order != sp.N - 1 || M <= 0 ||
+            !__state_room__< __type >( end , pos , sp.N ) || !__state_room__< __type >( end , pos , M ) ) return 0;
+        K = ( sp.N + M - 1 ) / M;
+        if( !__state_room__< __type >( end , pos , M * K * 2 ) ) return 0;
+
+        // the state is restored into the temporaries , that replace the filter members only on success:
+        __type *cf  = ( __type* ) calloc( sp.N , sizeof ( __type ) );
+        __type *cfp = ( __type* ) calloc( M * K , sizeof ( __type ) );
+        __type *bx  = ( __type* ) calloc( M * K * 2 , sizeof ( __type ) );
+        __ix32  ok  = cf && cfp && bx &&
+                      __state_get__( data , end , pos , cf , sp.N ) && __state_get__( data , end , pos , bx , M * K * 2 ) &&
+                      __state_get__( data , end , pos , &bpos ) && __state_get__( data , end , pos , &phase ) &&
+                      __state_get__( data , end , pos , &out ) && ( pos == end ) &&
+                      ( bpos >= 0 && bpos < K ) && ( phase >= 0 && phase < M ) &&
+                      ( pt == fir_linear_phase || pt == fir_minimum_phase );
+        if( !ok )
+        {
+            free( cf );
+            free( cfp );
+            free( bx );
+            return 0;
+        }
+
+        deallocate();
+        m_sp         = sp;
+        m_M          = M;
+        m_K          = K;
+        m_cf         = cf;
+        m_cfp        = cfp;
+        m_bx         = bx;
+        m_pos        = bpos;
+        m_phase      = phase;
+        m_out        = out;
+        m_phase_type = ( fir_phase )pt;
+        m_wind.init( m_sp.N );
+        split();
+        return end;
+    }
+
+    /*!
+     *  \brief  FIR decimator buffer filling function
+     *  \param[input] pointer to the input sample
+     *  \return the function returns 1 if the input sample completes the decimation cycle and 0 otherwise
+     *  \details the sample is routed into its phase history only , the output is not computed
+    */
+    template< typename T2 > inline __ix32 fill_fir_buff( T2 *input )
+    {
+        __type *row = &m_bx[ ( m_M - 1 - m_phase ) * m_K * 2 ];
+        row[ m_pos ] = row[ m_pos + m_K ] = ( __type )( *input );
+        if( ++m_phase < m_M ) return 0;
+
+        // the decimation cycle is completed , the histories are shifted:
+        m_phase = 0;
+        if( ++m_pos >= m_K ) m_pos = 0;
+        return 1;
+    }
+
+    /*!
+     *  \brief  FIR decimator output computation function
+     *  \return the function returns the output for the last completed decimation cycle
+    */
+    inline __type filt()
+    {
+        __type y = 0;
+        for( __ix32 p = 0 ; p < m_M ; p++ ) y += __dot__( &m_bx[ p * m_K * 2 + m_pos ] , &m_cfp[ p * m_K ] , m_K );
+        return ( m_out = y );
+    }
+
+    /*!
+     *  \brief  FIR decimator filtering function
+     *  \param[input] pointer to the input sample
+     *  \return the function returns 1 if the new output m_out is computed and 0 otherwise
+    */
+    template< typename T2 > inline __ix32 filt( T2 *input )
+    {
+        if( !fill_fir_buff( input ) ) return 0;
+        filt();
+        return 1;
+    }
+
+    /*!
+     *  \brief  FIR decimator block filtering function
+     *  \param[in ] pointer to the input samples block
+     *  \param[n  ] number of the input samples
+     *  \param[out] pointer to the output samples
+     *  \return the function returns the number of the computed output samples. The decimation phase is
+     *          kept between the calls , so the block size does not need to be a multiple of the factor.
+    */
+    inline __ix32 process( const __type *in , __ix32 n , __type *out )
+    {
+        __ix32 k = 0;
+        for( __ix32 i = 0 ; i < n ; i++ ) if( filt( &in[i] ) ) out[k++] = m_out;
+        return k;
+    }
+
+    /*!
+     *  \brief FIR decimator filtering () operator
+     *  \param[input] pointer to the input sample
+     *  \return the () operator calls filt( T2 *input ) function
+    */
+    template< typename T2 > inline __ix32 operator() ( T2 *input ) { return filt( input ); }
+};
+
+/*!
+ *  \brief polyphase rational L / M resampler template class
+ *  \details The input is virtually upsampled by L , lowpass filtered at the rate L * Fs and downsampled by M.
+ *           The lowpass coefficients h[ i ] are split into L phases h_p[ k ] = h[ k * L + p ] , so only the
+ *           K = ceil( N / L ) nonzero products are computed for every output sample:
+ *           \f[
+ *               y[ n ] = L * \sum_{ k = 0 }^{ K - 1 } h_p[ k ] * x[ b - k ] , \quad
+ *               b = \lfloor n * M / L \rfloor , \quad p = n * M - b * L
+ *           \f]
+*/
+template< typename T > class fir_resampler
+{
+    typedef T      __type ;
+    typedef bool   __bool ;
+    typedef void   __void ;
+
+    /*! \brief lowpass specification data structure ( at the upsampled rate L * Fs ) */
+    fir_sp  m_sp;
+
+    /*! \brief interpolation factor */
+    __ix32 m_L;
+
+    /*! \brief decimation factor */
+    __ix32 m_M;
+
+    /*! \brief phase coefficients number */
+    __ix32 m_K;
+
+    /*! \brief next output position relative to the current input sample at the upsampled rate */
+    __ix32 m_acc;
+
+    /*! \brief lowpass coefficients buffer */
+    __type *m_cf;
+
+    /*! \brief time-reversed phases coefficients scaled by L ( L rows of K coefficients ) */
+    __type *m_cfp;
+
+    /*! \brief input buffer */
+    mirror_ring_buffer< __type , __DELAY_LINE_CAPACITY > m_bx;
+
+    /*! \brief time-reversed phases coefficients computation function */
+    __void split()
+    {
+        for( __ix32 p = 0 ; p < m_L ; p++ )
+        {
+            for( __ix32 k = 0 ; k < m_K ; k++ )
+            {
+                __ix32 i = ( m_K - 1 - k ) * m_L + p;
+                m_cfp[ p * m_K + k ] = ( i < m_sp.N ) ? m_L * m_cf[ i ] : 0;
+            }
+        }
+    }
+
+public:
+
+    /*! \brief resampler output */
+    __type m_out;
+
+    /*! \brief lowpass window function object */
+    wind_fcn m_wind;
+
+    /*!
+     *  \brief Resampler initialization function
+     *  \param[Fs]    - input sampling frequency  , Hz
+     *  \param[Fout]  - output sampling frequency , Hz
+     *  \param[Fc]    - cut-off frequency , Hz ( Fc <= 0 - 0.45 of the lowest sampling frequency )
+     *  \param[order] - phase filter order ( the lowpass order is ( order + 1 ) * L - 1 )
+     *  \details the sampling frequencies are rounded to the integer Hz and the L / M ratio is reduced
+    */
+    __void init( __fx64 Fs , __fx64 Fout , __fx64 Fc , __ix32 order )
+    {
+        // L / M ratio reduction:
+        __ix32 a = ( __ix32 )( Fout + 0.5 ) , b = ( __ix32 )( Fs + 0.5 );
+        if( a < 1 ) a = 1;
+        if( b < 1 ) b = 1;
+        __ix32 x = a , y = b;
+        while( y != 0 ) { __ix32 r = x % y; x = y; y = r; }
+        m_L = a / x;
+        m_M = b / x;
+
+        // the lowpass is designed at the upsampled rate:
+        if( Fc <= 0 ) Fc = 0.45 * ( ( Fs < Fout ) ? Fs : Fout );
+        m_K     = order + 1;
+        m_sp    = fir_sp{ Fs * m_L , 0 , Fc , -1 , 1 / ( Fs * m_L ) , m_K * m_L - 1 , m_K * m_L , 1 , fir_type::lowpass_fir };
+        m_acc   = 0;
+        m_cf    = 0;
+        m_cfp   = 0;
+        m_out   = 0;
+        m_wind.init( m_sp.N );
+    }
+
+    /*! \brief resampler memory allocation function */
+    __ix32 allocate()
+    {
+        m_cf  = __fir_wind_design__< __type >( m_sp , m_wind );
+        m_cfp = ( __type* ) calloc( m_L * m_K , sizeof ( __type ) );
+        if( m_cf == 0 || m_cfp == 0 || !m_bx.allocate( m_K ) ) return 0;
+        split();
+        return 1;
+    }
+
+    /*! \brief resampler memory deallocation function */
+    __void deallocate()
+    {
+        if( m_cf  != 0 ) { free( m_cf  ); m_cf  = 0; }
+        if( m_cfp != 0 ) { free( m_cfp ); m_cfp = 0; }
+        m_bx.deallocate();
+        m_wind.deallocate();
+    }
+
+    /*! \brief default constructor */
+    fir_resampler() { init( 4000 , 4800 , 0 , 15 ); }
+
+    /*! \brief destructor */
+    ~fir_resampler() { deallocate(); }
+
+    /*! \brief interpolation factor getting function */
+    inline __ix32 up() { return m_L; }
+
+    /*! \brief decimation factor getting function */
+    inline __ix32 down() { return m_M; }
+
+    /*!
+     *  \brief  output block size estimation function
+     *  \param[n] - number of the input samples
+     *  \return the function returns the maximum number of the output samples for n input samples
+    */
+    inline __ix32 capacity( __ix32 n ) { return ( __ix32 )( ( ( long long )n * m_L ) / m_M ) + 1; }
+
+    /*!
+     *  \brief  lowpass frequency response computation function
+     *  \param[F] - input frequency , Hz
+     *  \return the function returns the resampler lowpass frequency response at the upsampled rate
+    */
+    inline fir_fr< __fx64 > freq_resp( __fx64 F ) { return __fir_freq_resp__< __fx64 , __type >( m_sp.Fs , F , m_sp.order , m_cf ); }
+
+    /*!
+     *  \brief  dense frequency response computation function
+     *  \param[fr     ] frequency response grid
+     *  \param[npoints] number of the grid points over [ 0 ; Fs / 2 ] , rounded up to 2^m + 1
+     *  \return the function computes the response by means of one real FFT and returns the number of the grid points
+    */
+    inline __ix32 freq_resp_grid( fir_fr_grid &fr , __ix32 npoints ) { return __fir_freq_resp_grid__< __type >( m_sp.Fs , m_sp.order , m_cf , fr , npoints ); }
+
+    /*!
+     *  \brief  resampler state saving function
+     *  \param[blob] pointer to the state memory block or null pointer to compute the state size only
+     *  \return the function stores the resampler specification , coefficients , input buffer and output
+     *          into the state memory block and returns the state size , bytes
+    */
+    __ix32 save_state( void *blob )
+    {
+        char  *data = ( char* )blob;
+        __ix32 pos  = 0;
+        if( m_cf == 0 ) return 0;
+        __state_begin__( data , pos , "fir_resampler" );
+        __state_put__( data , pos , &m_sp );
+        __state_put__( data , pos , &m_L );
+        __state_put__( data , pos , &m_M );
+        __state_put__( data , pos , &m_acc );
+        __state_put__( data , pos , m_cf , m_sp.N );
+        __buff_put__ ( data , pos , m_bx );
+        __state_put__( data , pos , &m_out );
+        return __state_end__( data , pos );
+    }
+
+    /*!
+     *  \brief  resampler state loading function
+     *  \param[blob] pointer to the state memory block
+     *  \param[size] available memory size , bytes
+     *  \return the function restores the resampler without the filter redesign and returns the number of the bytes read
+     *          or 0 if the state can not be restored. The resampler is not changed if the state is not valid.
+    */
+    __ix32 load_state( const void *blob , __ix32 size )
+    {
+        const char *data = ( const char* )blob;
+        __ix32 pos = 0 , end = __state_open__( data , size , pos , "fir_resampler" ) , L = 0 , M = 0 , acc = 0;
+        fir_sp sp;
+        __type out = 0;
+        if( end == 0 ) return 0;
+
+        if( !__state_get__( data , end , pos , &sp ) || !__state_get__( data , end , pos , &L ) ||
+            !__state_get__( data , end , pos , &M  ) || !__state_get__( data , end , pos , &acc ) ) return 0;
+        if( L <= 0 || M <= 0 || acc < 0 || acc >= M || sp.N <= 0 || sp.N % L != 0 || sp.order != sp.N - 1 ||
+            !__state_room__< __type >( end , pos , sp.N ) ) return 0;
+
+        // the state is restored into the temporaries , that replace the resampler members only on success:
+        mirror_ring_buffer< __type , __DELAY_LINE_CAPACITY > bx;
+        __type *cf  = ( __type* ) calloc( sp.N , sizeof ( __type ) );
+        __type *cfp = ( __type* ) calloc( sp.N , sizeof ( __type ) );
+        __ix32  ok  = cf && cfp && bx.allocate( sp.N / L ) &&
+                      __state_get__( data , end , pos , cf , sp.N ) && __buff_get__( data , end , pos , bx ) &&
+                      __state_get__( data , end , pos , &out ) && ( pos == end );
+        if( !ok )
+        {
+            free( cf );
+            free( cfp );
+            return 0;
+        }
+
+        deallocate();
+        m_sp  = sp;
+        m_L   = L;
+        m_M   = M;
+        m_K   = sp.N / L;
+        m_acc = acc;
+        m_cf  = cf;
+        m_cfp = cfp;
+        m_out = out;
+        m_bx.swap( bx );
+        m_wind.init( m_sp.N );
+        split();
+        return end;
+    }
+
+    /*!
+     *  \brief  resampling function
+     *  \param[input] pointer to the input sample
+     *  \param[out  ] pointer to the output samples , at least ceil( L / M ) samples
+     *  \return the function returns the number of the output samples produced by the input sample
+    */
+    template< typename T2 > inline __ix32 filt( T2 *input , __type *out )
+    {
+        __ix32 k = 0;
+        m_bx.fill_buff( input );
+        const __type *x = m_bx.view( m_K ).data;
+        for( ; m_acc < m_L ; m_acc += m_M ) out[k++] = m_out = __dot__( x , &m_cfp[ m_acc * m_K ] , m_K );
+        m_acc -= m_L;
+        return k;
+    }
+
+    /*!
+     *  \brief  resampler block processing function
+     *  \param[in ] pointer to the input samples block
+     *  \param[n  ] number of the input samples
+     *  \param[out] pointer to the output samples , at least capacity( n ) samples
+     *  \return the function returns the number of the output samples. The resampling phase is kept
+     *          between the calls , so the stream may be split into the arbitrary blocks.
+    */
+    inline __ix32 process( const __type *in , __ix32 n , __type *out )
+    {
+        __ix32 k = 0;
+        for( __ix32 i = 0 ; i < n ; i++ ) k += filt( &in[i] , out + k );
+        return k;
+    }
+};
+
+/*!
+ *  \brief multichannel FIR filter bank template class
+ *  \details The bank filters C channels with the same coefficients , so the coefficients are designed and stored
+ *           once. The channels histories are kept by the multichannel mirror ring buffer ( one aligned row of C
+ *           samples per time sample ) , so all the channels outputs are computed at once with the channels mapped
+ *           onto the SIMD lanes:
+ *           \f[
+ *               y_c[ n ] = \sum_{ i = 0 }^{ N - 1 } h[ i ] * x_c[ n - i ] , \quad c = 0 , 1 , ... , C - 1
+ *           \f]
+*/
+template< typename T > class fir_bank
+{
+    typedef T      __type ;
+    typedef bool   __bool ;
+    typedef void   __void ;
+
+    /*! \brief filter specification data structure */
+    fir_sp  m_sp;
+
+    /*! \brief channels number */
+    __ix32 m_C;
+
+    /*! \brief filter coefficients buffer */
+    __type *m_cf;
+
+    /*! \brief time-reversed filter coefficients buffer */
+    __type *m_cfr;
+
+    /*! \brief channels histories ( N aligned rows of C samples ) */
+    multichannel_ring_buffer< __type > m_bx;
+
+    /*! \brief filter bank initialization function */
+    __void init( const fir_sp &sp , __ix32 C )
+    {
+        m_sp  = sp;
+        m_C   = ( C > 0 ) ? C : 1;
+        m_cf  = 0;
+        m_cfr = 0;
+        m_out = 0;
+        m_wind.init( m_sp.N );
+    }
+
+    /*! \brief time-reversed coefficients computation function */
+    __void reverse() { for( __ix32 i = 0 ; i < m_sp.N ; i++ ) m_cfr[ i ] = m_cf[ m_sp.N - 1 - i ]; }
+
+public:
+
+    /*! \brief pointer to the C channels outputs ( the buffer row stride long , the padding lanes outputs are zero ) */
+    __type *m_out;
+
+    /*! \brief filter window function object */
+    wind_fcn m_wind;
+
+    /*!
+     *  \brief Lowpass filter bank initialization function
+     *  \param[Fs]    - sampling frequency , Hz
+     *  \param[Fn]    - nominal frequency  , Hz
+     *  \param[Fc]    - cut-off frequency  , Hz
+     *  \param[order] - filter order
+     *  \param[C]     - channels number
+     *  \param[scale] - filter scaling flag ( 0 - not-scaled filter , 1 - scaled filter )
+    */
+    __void lp_init( __fx64 Fs , __fx64 Fn , __fx64 Fc , __ix32 order , __ix32 C , __bool scale )
+    {
+        init( fir_sp{ Fs , Fn , Fc , -1 , 1 / Fs , order , order + 1 , scale , fir_type::lowpass_fir } , C );
+    }
+
+    /*!
+     *  \brief Highpass filter bank initialization function
+     *  \param[Fs]    - sampling frequency , Hz
+     *  \param[Fn]    - nominal frequency  , Hz
+     *  \param[Fp]    - pass frequency     , Hz
+     *  \param[order] - filter order
+     *  \param[C]     - channels number
+     *  \param[scale] - filter scaling flag ( 0 - not-scaled filter , 1 - scaled filter )
+    */
+    __void hp_init( __fx64 Fs , __fx64 Fn , __fx64 Fp , __ix32 order , __ix32 C , __bool scale )
+    {
+        init( fir_sp{ Fs , Fn , Fp , -1 , 1 / Fs , order , order + 1 , scale , fir_type::highpass_fir } , C );
+    }
+
+    /*!
+     *  \brief Bandpass filter bank initialization function
+     *  \param[Fs]    - sampling frequency , Hz
+     *  \param[Fn]    - nominal frequency  , Hz
+     *  \param[Fp]    - pass frequency     , Hz
+     *  \param[BW]    - pass band width    , Hz
+     *  \param[order] - filter order
+     *  \param[C]     - channels number
+     *  \param[scale] - filter scaling flag ( 0 - not-scaled filter , 1 - scaled filter )
+    */
+    __void bp_init( __fx64 Fs , __fx64 Fn , __fx64 Fp , __fx64 BW , __ix32 order , __ix32 C , __bool scale )
+    {
+        init( fir_sp{ Fs , Fn , Fp , BW , 1 / Fs , order , order + 1 , scale , fir_type::bandpass_fir } , C );
+    }
+
+    /*!
+     *  \brief Bandstop filter bank initialization function
+     *  \param[Fs]    - sampling frequency , Hz
+     *  \param[Fn]    - nominal frequency  , Hz
+     *  \param[Fc]    - stop frequency     , Hz
+     *  \param[BW]    - stop band width    , Hz
+     *  \param[order] - filter order
+     *  \param[C]     - channels number
+     *  \param[scale] - filter scaling flag ( 0 - not-scaled filter , 1 - scaled filter )
+    */
+    __void bs_init( __fx64 Fs , __fx64 Fn , __fx64 Fc , __fx64 BW , __ix32 order , __ix32 C , __bool scale )
+    {
+        init( fir_sp{ Fs , Fn , Fc , BW , 1 / Fs , order , order + 1 , scale , fir_type::bandstop_fir } , C );
+    }
+
+    /*! \brief filter bank memory allocation function */
+    __ix32 allocate()
+    {
+        m_cf  = __fir_wind_design__< __type >( m_sp , m_wind );
+        m_cfr = ( __type* ) calloc( m_sp.N , sizeof ( __type ) );
+        if( m_cf == 0 || m_cfr == 0 || !m_bx.allocate( m_sp.N , m_C ) ) return 0;
+        m_out = ( __type* ) calloc( m_bx.getStride() , sizeof ( __type ) );
+        if( m_out == 0 ) return 0;
+        reverse();
+        return 1;
+    }
+
+    /*! \brief filter bank memory deallocation function */
+    __void deallocate()
+    {
+        if( m_cf  != 0 ) { free( m_cf  ); m_cf  = 0; }
+        if( m_cfr != 0 ) { free( m_cfr ); m_cfr = 0; }
+        if( m_out != 0 ) { free( m_out ); m_out = 0; }
+        m_bx.deallocate();
+        m_wind.deallocate();
+    }
+
+    /*! \brief default constructor */
+    fir_bank() { lp_init( 4000 , 50 , 100 , 80 , 24 , 1 ); }
+
+    /*! \brief destructor */
+    ~fir_bank() { deallocate(); }
+
+    /*! \brief channels number getting function */
+    inline __ix32 channels() { return m_C; }
+
+    /*!
+     *  \brief  filter frequency response computation function
+     *  \param[F] - input frequency , Hz
+     *  \return the function returns the frequency response common for all the channels
+    */
+    inline fir_fr< __fx64 > freq_resp( __fx64 F ) { return __fir_freq_resp__< __fx64 , __type >( m_sp.Fs , F , m_sp.order , m_cf ); }
+
+    /*!
+     *  \brief  dense frequency response computation function
+     *  \param[fr     ] frequency response grid
+     *  \param[npoints] number of the grid points over [ 0 ; Fs / 2 ] , rounded up to 2^m + 1
+     *  \return the function computes the response by means of one real FFT and returns the number of the grid points
+    */
+    inline __ix32 freq_resp_grid( fir_fr_grid &fr , __ix32 npoints ) { return __fir_freq_resp_grid__< __type >( m_sp.Fs , m_sp.order , m_cf , fr , npoints ); }
+
+    /*!
+     *  \brief  filter bank state saving function
+     *  \param[blob] pointer to the state memory block or null pointer to compute the state size only
+     *  \return the function stores the filter specification , coefficients , channels histories and outputs
+     *          into the state memory block and returns the state size , bytes. The histories rows are stored
+     *          from the oldest to the most recent one without the padding.
+    */
+    __ix32 save_state( void *blob )
+    {
+        char  *data = ( char* )blob;
+        __ix32 pos  = 0;
+        if( m_cf == 0 ) return 0;
+        __state_begin__( data , pos , "fir_bank" );
+        __state_put__( data , pos , &m_sp );
+        __state_put__( data , pos , &m_C );
+        __state_put__( data , pos , m_cf , m_sp.N );
+        for( __ix32 n = m_sp.N - 1 ; n >= 0 ; n-- ) __state_put__( data , pos , m_bx[ n ] , m_C );
+        __state_put__( data , pos , m_out , m_C );
+        return __state_end__( data , pos );
+    }
+
+    /*!
+     *  \brief  filter bank state loading function
+     *  \param[blob] pointer to the state memory block
+     *  \param[size] available memory size , bytes
+     *  \return the function restores the filter bank without the filter redesign and returns the number of the bytes read
+     *          or 0 if the state can not be restored. The filter bank is not changed if the state is not valid.
+    */
+    __ix32 load_state( const void *blob , __ix32 size )
+    {
+        const char *data = ( const char* )blob;
+        __ix32 pos = 0 , end = __state_open__( data , size , pos , "fir_bank" ) , C = 0 , row = 0;
+        fir_sp sp;
+        if( end == 0 ) return 0;
+
+        if( !__state_get__( data , end , pos , &sp ) || !__state_get__( data , end , pos , &C ) ) return 0;
+        if( sp.N <= 0 || sp.order != sp.N - 1 || C <= 0 ||
+            !__state_room__< __type >( end , pos , sp.N ) || !__state_room__< __type >( end , pos , C ) ) return 0;
+
+        // N rows of C samples follow the coefficients , every row is padded up to 8 bytes:
+        row = ( ( C * sizeof ( __type ) + 7 ) / 8 ) * 8;
+        if( ( __ix64 )sp.N * row > end - pos ) return 0;
+
+        // the state is restored into the temporaries , that replace the filter bank members only on success ,
+        // the rows are refilled through the output buffer , that is restored afterwards:
+        multichannel_ring_buffer< __type > bx;
+        __type *cf  = ( __type* ) calloc( sp.N , sizeof ( __type ) );
+        __type *cfr = ( __type* ) calloc( sp.N , sizeof ( __type ) );
+        __type *out = 0;
+        __ix32  ok  = cf && cfr && bx.allocate( sp.N , C ) &&
+                      ( out = ( __type* ) calloc( bx.getStride() , sizeof ( __type ) ) ) != 0 &&
+                      __state_get__( data , end , pos , cf , sp.N );
+        for( __ix32 n = 0 ; ok && n < sp.N ; n++ )
+        {
+            ok = __state_get__( data , end , pos , out , C );
+            if( ok ) bx.fill_buff( out );
+        }
+        ok = ok && __state_get__( data , end , pos , out , C ) && ( pos == end );
+        if( !ok )
+        {
+            free( cf );
+            free( cfr );
+            free( out );
+            return 0;
+        }
+
+        deallocate();
+        m_sp  = sp;
+        m_C   = C;
+        m_cf  = cf;
+        m_cfr = cfr;
+        m_out = out;
+        m_bx.swap( bx );
+        m_wind.init( m_sp.N );
+        reverse();
+        return end;
+    }
+
+    /*!
+     *  \brief  filter bank filtering function
+     *  \param[input] pointer to the C channels input samples
+     *  \return the function returns the pointer to the C channels outputs
+     *  \details the padding lanes of the rows are zero , so the whole row stride is filtered at once
+    */
+    template< typename T2 > inline __type *filt( T2 *input )
+    {
+        m_bx( input );
+        __bank_dot__( m_bx.view( m_sp.N ).data , m_cfr , m_sp.N , m_bx.getStride() , m_out );
+        return m_out;
+    }
+
+    /*!
+     *  \brief  filter bank block processing function
+     *  \param[in ] - pointer to the channel-interleaved input block ( n rows of C samples )
+     *  \param[out] - pointer to the channel-interleaved output block ( n rows of C samples )
+     *  \param[n  ] - number of the rows
+     *  \details the channels histories are kept between the calls , so the stream may be split into the arbitrary blocks
+    */
+    inline __void process( const __type *in , __type *out , __ix32 n )
+    {
+        for( __ix32 i = 0 ; i < n ; i++ ) memcpy( out + i * m_C , filt( in + i * m_C ) , m_C * sizeof ( __type ) );
+    }
+
+    /*!
+     *  \brief FIR filter bank filtering () operator
+     *  \param[input] pointer to the C channels input samples
+     *  \return the () operator calls filt( T2 *input ) function
+    */
+    template< typename T2 > inline __type *operator() ( T2 *input ) { return filt( input ); }
+};
+
+/*! \brief defines the maximum number of the half-band decimation chain stages */
+#ifndef __HALFBAND_MAX_STAGES
+#define __HALFBAND_MAX_STAGES 8
+#endif
+
+/*!
+ *  \brief defines the half-band decimator block processing size , output samples
+ *  \details the block input samples are written into the histories before the block outputs are computed , so the
+ *           dot products do not load the just stored samples , that stalls the store to load forwarding
+*/
+#ifndef __HALFBAND_BLOCK_SIZE
+#define __HALFBAND_BLOCK_SIZE 32
+#endif
+
+/*!
+ *  \brief half-band decimating FIR filter template class
+ *  \details The lowpass with the cut-off frequency Fc = Fs / 4 and the order N = 4 * k + 2 has every second coefficient
+ *           equal to zero , except the centre one: h[ N / 2 + 2 * i ] = 0 , i != 0. The input is split into the even
+ *           samples e[ m ] = x[ 2 * m ] and the odd samples o[ m ] = x[ 2 * m - 1 ] , so the output is computed at
+ *           the decimated rate by means of the k + 1 folded nonzero coefficients and the centre one:
+ *           \f[
+ *               y[ m ] = \sum_{ i = 0 }^{ k } h[ 2 * i ] * ( e[ m - i ] + e[ m - 2 * k - 1 + i ] ) + h[ 2 * k + 1 ] * o[ m - k ]
+ *           \f]
+ *           The filter takes k + 2 multiplications per output sample instead of the N + 1 ones of the fir class
+ *           computed at the input rate.
+*/
+template< typename T > class halfband_fir
+{
+    typedef T      __type ;
+    typedef bool   __bool ;
+    typedef void   __void ;
+
+    /*! \brief lowpass specification data structure */
+    fir_sp  m_sp;
+
+    /*! \brief even samples history length ( the even nonzero coefficients number ) */
+    __ix32 m_K;
+
+    /*! \brief even nonzero coefficients h[ 2 * i ] , i = 0 ... k ( the second half is symmetric ) */
+    __type *m_cf;
+
+    /*! \brief centre coefficient h[ 2 * k + 1 ] */
+    __type m_hc;
+
+    /*! \brief histories length ( K + __HALFBAND_BLOCK_SIZE ) */
+    __ix32 m_R;
+
+    /*! \brief even and odd samples histories ( two mirrored rows of 2 * R samples ) */
+    __type *m_bx;
+
+    /*! \brief histories write position */
+    __ix32 m_pos;
+
+    /*! \brief decimation phase counter */
+    __ix32 m_phase;
+
+    /*! \brief full coefficients buffer restoration function */
+    __void expand( __type *cf )
+    {
+        for( __ix32 i = 0 ; i <= m_sp.order ; i++ ) cf[ i ] = 0;
+        for( __ix32 i = 0 ; i < m_K / 2 ; i++ ) cf[ 2 * i ] = cf[ m_sp.order - 2 * i ] = m_cf[ i ];
+        cf[ m_sp.order / 2 ] = m_hc;
+    }
+
+    /*!
+     *  \brief  delayed output computation function
+     *  \param[d] - number of the decimation cycles completed after the computed one , d < __HALFBAND_BLOCK_SIZE
+     *  \return the function returns the output for the d-th cycle before the last completed one
+    */
+    inline __type filt( __ix32 d )
+    {
+        __ix32 s = ( m_pos - d - m_K + 2 * m_R ) % m_R;
+        return __fold_dot__( &m_bx[ s ] , m_cf , m_K , 1 ) + m_hc * m_bx[ m_R * 2 + s + m_K / 2 ];
+    }
+
+public:
+
+    /*! \brief lowpass output */
+    __type m_out;
+
+    /*! \brief lowpass window function object */
+    wind_fcn m_wind;
+
+    /*!
+     *  \brief half-band lowpass initialization function
+     *  \param[Fs]    - input sampling frequency , Hz
+     *  \param[Fn]    - nominal frequency        , Hz
+     *  \param[order] - filter order , rounded up to 4 * k + 2
+     *  \param[scale] - filter scaling flag ( 0 - not-scaled filter , 1 - scaled filter )
+    */
+    __void init( __fx64 Fs , __fx64 Fn , __ix32 order , __bool scale )
+    {
+        order   = ( order > 2 ) ? order + ( 6 - order % 4 ) % 4 : 2;
+        m_sp    = fir_sp{ Fs , Fn , Fs / 4 , -1 , 1 / Fs , order , order + 1 , scale , fir_type::lowpass_fir };
+        m_K     = order / 2 + 1;
+        m_R     = m_K + __HALFBAND_BLOCK_SIZE;
+        m_cf    = 0;
+        m_hc    = 0;
+        m_bx    = 0;
+        m_pos   = 0;
+        m_phase = 0;
+        m_out   = 0;
+        m_wind.init( m_sp.N );
+    }
+
+    /*! \brief half-band lowpass memory allocation function */
+    __ix32 allocate()
+    {
+        __type *cf = __fir_wind_design__< __type >( m_sp , m_wind );
+        m_cf = ( __type* ) calloc( m_K / 2 , sizeof ( __type ) );
+        m_bx = ( __type* ) calloc( m_R * 4 , sizeof ( __type ) );
+        if( cf == 0 || m_cf == 0 || m_bx == 0 ) { if( cf != 0 ) free( cf ); return 0; }
+
+        // the zero coefficients are not stored:
+        for( __ix32 i = 0 ; i < m_K / 2 ; i++ ) m_cf[ i ] = cf[ 2 * i ];
+        m_hc = cf[ m_sp.order / 2 ];
+        free( cf );
+        return 1;
+    }
+
+    /*! \brief half-band lowpass memory deallocation function */
+    __void deallocate()
+    {
+        if( m_cf != 0 ) { free( m_cf ); m_cf = 0; }
+        if( m_bx != 0 ) { free( m_bx ); m_bx = 0; }
+        m_wind.deallocate();
+    }
+
+    /*! \brief default constructor */
+    halfband_fir() { init( 16000 , 50 , 30 , 1 ); }
+
+    /*! \brief destructor */
+    ~halfband_fir() { deallocate(); }
 
-    /*! \brief frequency response computation function */
+    /*! \brief filter order getting function */
+    inline __ix32 order() { return m_sp.order; }
+
+    /*!
+     *  \brief  half-band lowpass frequency response computation function
+     *  \param[F] - input frequency , Hz
+     *  \return the function returns the frequency response at the input sampling frequency
+    */
     fir_fr< __fx64 > freq_resp( __fx64 F )
     {
-        __fx64 Re = 1 - cos(-6.283185307179586476925286766559  * m_order * F * m_Ts);
-        __fx64 Im = 0 - sin(-6.283185307179586476925286766559  * m_order * F * m_Ts);
-        m_pH = atan2(Im, Re);
-        m_Km = sqrt(Re * Re + Im * Im) * 0.5;
-        return { m_Km , m_pH };
+        fir_fr< __fx64 > fr = fir_fr< __fx64 >{ 0 , 0 };
+        __type *cf = ( m_cf != 0 ) ? ( __type* ) calloc( m_sp.N , sizeof ( __type ) ) : 0;
+        if( cf == 0 ) return fr;
+        expand( cf );
+        fr = __fir_freq_resp__< __fx64 , __type >( m_sp.Fs , F , m_sp.order , cf );
+        free( cf );
+        return fr;
     }
 
     /*!
-     *  \brief 32-bit floating point filtering function
-     *  \param[input] - pointer to the input signal samples buffer
-     *  \return The function returns filtering result
+     *  \brief  half-band decimator state saving function
+     *  \param[blob] pointer to the state memory block or null pointer to compute the state size only
+     *  \return the function stores the filter specification , nonzero coefficients , histories and output
+     *          into the state memory block and returns the state size , bytes
     */
-    inline __fx64 filt( __type *input)
+    __ix32 save_state( void *blob )
     {
-        m_bx( input );
-        return ( m_out = (__fx64)*input - (__fx64)m_bx[ m_order ] );
+        char  *data = ( char* )blob;
+        __ix32 pos  = 0;
+        if( m_cf == 0 ) return 0;
+        __state_begin__( data , pos , "halfband_fir" );
+        __state_put__( data , pos , &m_sp );
+        __state_put__( data , pos , m_cf , m_K / 2 );
+        __state_put__( data , pos , &m_hc );
+        __state_put__( data , pos , m_bx , m_R * 4 );
+        __state_put__( data , pos , &m_pos );
+        __state_put__( data , pos , &m_phase );
+        __state_put__( data , pos , &m_out );
+        return __state_end__( data , pos );
     }
 
     /*!
-     *  \brief 64-bit floating point filtering function
-     *  \param[input] - pointer to the input signal samples buffer
-     *  \return The function returns filtering result
+     *  \brief  half-band decimator state loading function
+     *  \param[blob] pointer to the state memory block
+     *  \param[size] available memory size , bytes
+     *  \return the function restores the filter without the filter redesign and returns the number of the bytes read
+     *          or 0 if the state can not be restored. The filter is not changed if the state is not valid.
     */
-    inline __fx64 filt( __fx64 *input)
+    __ix32 load_state( const void *blob , __ix32 size )
     {
-        m_bx( input );
-        return ( m_out = *input - m_bx[ m_order ] );
+        const char *data = ( const char* )blob;
+        __ix32 pos = 0 , end = __state_open__( data , size , pos , "halfband_fir" ) , K = 0 , R = 0 , bpos = 0 , phase = 0 , ok = 0;
+        fir_sp sp;
+        __type hc = 0 , out = 0;
+        if( end == 0 ) return 0;
+
+        if( !__state_get__( data , end , pos , &sp ) ) return 0;
+        if( sp.order < 2 || sp.order % 4 != 2 || sp.N != sp.order + 1 || !__state_room__< __type >( end , pos , sp.order ) ) return 0;
+        K = sp.order / 2 + 1;
+        R = K + __HALFBAND_BLOCK_SIZE;
+
+        // the state is restored into the temporaries , that replace the filter members only on success:
+        __type *cf = ( __type* ) calloc( K / 2 , sizeof ( __type ) );
+        __type *bx = ( __type* ) calloc( R * 4 , sizeof ( __type ) );
+        ok = cf && bx && __state_get__( data , end , pos , cf , K / 2 ) && __state_get__( data , end , pos , &hc ) &&
+             __state_get__( data , end , pos , bx , R * 4 ) && __state_get__( data , end , pos , &bpos ) &&
+             __state_get__( data , end , pos , &phase ) && __state_get__( data , end , pos , &out ) && ( pos == end ) &&
+             ( bpos >= 0 && bpos < R ) && ( phase == 0 || phase == 1 );
+        if( !ok )
+        {
+            free( cf );
+            free( bx );
+            return 0;
+        }
+
+        deallocate();
+        m_sp    = sp;
+        m_K     = K;
+        m_R     = R;
+        m_cf    = cf;
+        m_hc    = hc;
+        m_bx    = bx;
+        m_pos   = bpos;
+        m_phase = phase;
+        m_out   = out;
+        m_wind.init( m_sp.N );
+        return end;
     }
 
     /*!
-     *  \brief 32-bit floating point filtering operator
-     *  \param[input] - pointer to the input signal samples buffer
-     *  \return The operatoe calls the function that returns filtering result
+     *  \brief  half-band decimator buffer filling function
+     *  \param[input] pointer to the input sample
+     *  \return the function returns 1 if the input sample is the even one , so the decimated output is due , and 0 otherwise
     */
-    inline __fx64 operator ()( __type *input ) { return filt(input); }
+    template< typename T2 > inline __ix32 fill_fir_buff( T2 *input )
+    {
+        __type *row = &m_bx[ ( 1 - m_phase ) * m_R * 2 ];
+        row[ m_pos ] = row[ m_pos + m_R ] = ( __type )( *input );
+        if( ++m_phase < 2 ) return 0;
+
+        // the decimation cycle is completed , the histories are shifted:
+        m_phase = 0;
+        if( ++m_pos >= m_R ) m_pos = 0;
+        return 1;
+    }
 
     /*!
-     *  \brief 64-bit floating point filtering operator
-     *  \param[input] - pointer to the input signal samples buffer
-     *  \return The operatoe calls the function that returns filtering result
+     *  \brief  half-band decimator output computation function
+     *  \return the function returns the output for the last completed decimation cycle
     */
-    inline __fx64 operator ()( __fx64 *input ) { return filt(input); }
+    inline __type filt() { return ( m_out = filt( 0 ) ); }
+
+    /*!
+     *  \brief  half-band decimator filtering function
+     *  \param[input] pointer to the input sample
+     *  \return the function returns 1 if the new output m_out is computed and 0 otherwise
+    */
+    template< typename T2 > inline __ix32 filt( T2 *input )
+    {
+        if( !fill_fir_buff( input ) ) return 0;
+        filt();
+        return 1;
+    }
+
+    /*!
+     *  \brief  half-band decimator block filtering function
+     *  \param[in ] pointer to the input samples block
+     *  \param[n  ] number of the input samples
+     *  \param[out] pointer to the output samples
+     *  \return the function returns the number of the computed output samples. The decimation phase is
+     *          kept between the calls , so the block size may be odd. The output may be written over the input.
+    */
+    __ix32 process( const __type *in , __ix32 n , __type *out )
+    {
+        __ix32 k = 0;
+        for( __ix32 i = 0 ; i < n ; )
+        {
+            __ix32 c = 0;
+            for( ; i < n && c < __HALFBAND_BLOCK_SIZE ; i++ ) c += fill_fir_buff( &in[i] );
+            while( c > 0 ) out[k++] = m_out = filt( --c );
+        }
+        return k;
+    }
+
+    /*!
+     *  \brief half-band decimator filtering () operator
+     *  \param[input] pointer to the input sample
+     *  \return the () operator calls filt( T2 *input ) function
+    */
+    template< typename T2 > inline __ix32 operator() ( T2 *input ) { return filt( input ); }
 };
 
-/*! \brief 64-bit floating point comb FIR filter */
-template<> class fcomb<__fx64>
+/*!
+ *  \brief half-band multistage decimation chain template class
+ *  \details The chain of S half-band decimators decimates the input by 2^S. The stage i works at the sampling
+ *           frequency Fs / 2^i , so every stage takes less than a half of the previous stage work , and the whole
+ *           chain takes less than two stages work per input sample pair:
+ *           \code
+ *           halfband_chain< __fx32 > dec;
+ *           dec.init( 16000 , 50 , 2 , 30 ); // 16 kHz -> 8 kHz -> 4 kHz
+ *           dec.allocate();
+ *           \endcode
+ *           The stages may be reinitialized by means of the stage() function before the memory allocation.
+*/
+template< typename T > class halfband_chain
 {
-    typedef __fx64 __type ;
-private:
+    typedef T      __type ;
+    typedef bool   __bool ;
+    typedef void   __void ;
 
-    /*! \brief input signal nominal frequency  , Hz */
-    __fx64 m_Fn;
-    /*! \brief input signal sampling frequency , Hz */
-    __fx64 m_Fs;
-    /*! \brief input signal nominal period     , s */
-    __fx64 m_Ts;
-    /*! \brief comb filter order */
-    __ix32 m_order;
+    /*! \brief decimation stages */
+    halfband_fir< __type > m_stage[ __HALFBAND_MAX_STAGES ];
 
-    /*! \brief comb filter buffer */
-     mirror_ring_buffer< __type > m_bx;
+    /*! \brief stages number */
+    __ix32 m_S;
+
+    /*! \brief stages block processing buffer ( __HALFBAND_BLOCK_SIZE samples ) */
+    __type *m_buff;
 
 public:
 
-    /*! \brief filter output */
-    __fx64 m_out;
-    /*! \brief filter frequency phase response */
-    __fx64 m_pH;
-    /*! \brief filter frequency amplitude response */
-    __fx64 m_Km;
+    /*! \brief decimation chain output */
+    __type m_out;
 
     /*!
-     *  \brief comb filter initialization function
-     *  \param[Fs] - input signal sampling frequency
-     *  \param[Fn] - input signal nominal frequency
+     *  \brief decimation chain initialization function
+     *  \param[Fs]    - input sampling frequency , Hz
+     *  \param[Fn]    - nominal frequency        , Hz
+     *  \param[S]     - stages number , the decimation factor is 2^S
+     *  \param[order] - stages filters order
+     *  \param[scale] - filters scaling flag ( 0 - not-scaled filters , 1 - scaled filters )
     */
-    __ix32 init( __fx64 Fs , __fx64 Fn )
+    __void init( __fx64 Fs , __fx64 Fn , __ix32 S , __ix32 order , __bool scale = 1 )
     {
-        m_Fs      = Fs;
-        m_Fn      = Fn;
-        m_Ts      = 1 / m_Fs;
-        m_order   = m_Fs / m_Fn / 2;
-        m_out     = 0;
-        m_Km      = 0;
-        m_pH      = 0;
-        return 0;
+        deallocate();
+        m_S   = ( S < 1 ) ? 1 : ( S > __HALFBAND_MAX_STAGES ) ? __HALFBAND_MAX_STAGES : S;
+        m_out = 0;
+        for( __ix32 i = 0 ; i < m_S ; i++ , Fs /= 2 ) m_stage[ i ].init( Fs , Fn , order , scale );
     }
 
-    /*! \brief memory allocation function */
+    /*! \brief decimation chain memory allocation function */
     __ix32 allocate()
     {
-        return m_bx.allocate( m_order + 1 );
+        for( __ix32 i = 0 ; i < m_S ; i++ ) if( !m_stage[ i ].allocate() ) return 0;
+        m_buff = ( __type* ) calloc( __HALFBAND_BLOCK_SIZE , sizeof ( __type ) );
+        return ( m_buff != 0 );
     }
 
-    /*! \brief memory deallocation function */
-    void deallocate()
+    /*! \brief decimation chain memory deallocation function */
+    __void deallocate()
     {
-        m_bx.deallocate();
+        for( __ix32 i = 0 ; i < __HALFBAND_MAX_STAGES ; i++ ) m_stage[ i ].deallocate();
+        if( m_buff != 0 ) { free( m_buff ); m_buff = 0; }
     }
 
     /*! \brief default constructor */
-    fcomb()
+    halfband_chain() : m_S( 0 ) , m_buff( 0 ) { init( 16000 , 50 , 2 , 30 ); }
+
+    /*! \brief destructor */
+    ~halfband_chain() { deallocate(); }
+
+    /*! \brief decimation factor getting function */
+    inline __ix32 factor() { return 1 << m_S; }
+
+    /*!
+     *  \brief  decimation stage getting function
+     *  \param[i] - stage number
+     *  \return the function returns the reference to the i-th stage
+    */
+    inline halfband_fir< __type > &stage( __ix32 i ) { return m_stage[ i ]; }
+
+    /*!
+     *  \brief  decimation chain frequency response computation function
+     *  \param[F] - input frequency , Hz
+     *  \return the function returns the product of the stages frequency responses , so the aliased stages responses are
+     *          not taken into account
+    */
+    fir_fr< __fx64 > freq_resp( __fx64 F )
     {
-        m_Fs      = 4000;
-        m_Fn      = 50;
-        m_Ts      = 1 / m_Fs;
-        m_order   = m_Fs / m_Fn / 2;
-        m_out     = 0;
-        m_Km      = 0;
-        m_pH      = 0;
+        fir_fr< __fx64 > fr = fir_fr< __fx64 >{ 1 , 0 };
+        for( __ix32 i = 0 ; i < m_S ; i++ )
+        {
+            fir_fr< __fx64 > fs = m_stage[ i ].freq_resp( F );
+            fr.Km *= fs.Km;
+            fr.pH += fs.pH;
+        }
+        return fr;
     }
 
-    /*! \brief default destructor */
-    ~fcomb(){ deallocate(); };
+    /*!
+     *  \brief  decimation chain state saving function
+     *  \param[blob] pointer to the state memory block or null pointer to compute the state size only
+     *  \return the function stores the stages number , output and stages states into the state memory block
+     *          and returns the state size , bytes
+    */
+    __ix32 save_state( void *blob )
+    {
+        char  *data = ( char* )blob;
+        __ix32 pos  = 0 , n = 0;
+        if( m_buff == 0 ) return 0;
+        __state_begin__( data , pos , "halfband_chain" );
+        __state_put__( data , pos , &m_S );
+        __state_put__( data , pos , &m_out );
+        for( __ix32 i = 0 ; i < m_S ; i++ ) if( ( n = m_stage[ i ].save_state( data ? data + pos : 0 ) ) == 0 ) return 0; else pos += n;
+        return __state_end__( data , pos );
+    }
 
-    /*! \brief frequency response computation function */
-    fir_fr< __fx64 > freq_resp( __fx64 F )
+    /*!
+     *  \brief  decimation chain state loading function
+     *  \param[blob] pointer to the state memory block
+     *  \param[size] available memory size , bytes
+     *  \return the function restores the chain without the stages redesign and returns the number of the bytes read
+     *          or 0 if the state can not be restored. The chain is not changed if the state is not valid.
+    */
+    __ix32 load_state( const void *blob , __ix32 size )
     {
-        __fx64 Re = 1 - cos(-6.283185307179586476925286766559  * m_order * F * m_Ts);
-        __fx64 Im = 0 - sin(-6.283185307179586476925286766559  * m_order * F * m_Ts);
-        m_pH = atan2(Im, Re);
-        m_Km = sqrt(Re * Re + Im * Im) * 0.5;
-        return { m_Km , m_pH };
+        const char *data = ( const char* )blob;
+        __ix32 pos = 0 , end = __state_open__( data , size , pos , "halfband_chain" ) , S = 0 , nested = 0 , ok = 0;
+        __type out = 0;
+        if( end == 0 ) return 0;
+
+        if( !__state_get__( data , end , pos , &S ) || !__state_get__( data , end , pos , &out ) ) return 0;
+        if( S < 1 || S > __HALFBAND_MAX_STAGES ) return 0;
+
+        // the stages states are validated by means of the temporary stage:
+        halfband_fir< __type > stage;
+        nested = pos;
+        ok     = 1;
+        for( __ix32 i = 0 ; ok && i < S ; i++ ) ok = __state_nested__( stage , data , end , pos );
+        __type *buff = ( ok && pos == end ) ? ( __type* ) calloc( __HALFBAND_BLOCK_SIZE , sizeof ( __type ) ) : 0;
+        if( buff == 0 ) return 0;
+
+        deallocate();
+        m_S    = S;
+        m_out  = out;
+        m_buff = buff;
+
+        // the validated stages states are loaded into the stages , only the memory allocation can fail here:
+        pos = nested;
+        for( __ix32 i = 0 ; i < m_S ; i++ ) if( !__state_nested__( m_stage[ i ] , data , end , pos ) ) { deallocate(); return 0; }
+        return end;
     }
 
     /*!
-     *  \brief 32-bit floating point filtering function
-     *  \param[input] - pointer to the input signal samples buffer
-     *  \return The function returns filtering result
+     *  \brief  decimation chain filtering function
+     *  \param[input] pointer to the input sample
+     *  \return the function returns 1 if the last stage computes the new output m_out and 0 otherwise
     */
-    inline __fx64 filt( __type *input)
+    template< typename T2 > inline __ix32 filt( T2 *input )
     {
-        m_bx( input );
-        m_out = (__fx64)*input - (__fx64)m_bx[ m_order ];
-        return m_out;
+        if( !m_stage[ 0 ]( input ) ) return 0;
+        for( __ix32 i = 1 ; i < m_S ; i++ ) if( !m_stage[ i ]( &m_stage[ i - 1 ].m_out ) ) return 0;
+        m_out = m_stage[ m_S - 1 ].m_out;
+        return 1;
     }
 
     /*!
-     *  \brief 32-bit floating point filtering operator
-     *  \param[input] - pointer to the input signal samples buffer
-     *  \return The operatoe calls the function that returns filtering result
+     *  \brief  decimation chain block filtering function
+     *  \param[in ] pointer to the input samples block
+     *  \param[n  ] number of the input samples
+     *  \param[out] pointer to the output samples
+     *  \return the function returns the number of the computed output samples
+     *  \details the input is processed stage by stage by the blocks of 2 * __HALFBAND_BLOCK_SIZE samples
     */
-    inline __fx64 operator ()( __type *input ) { return filt(input); }
+    __ix32 process( const __type *in , __ix32 n , __type *out )
+    {
+        __ix32 k = 0;
+        for( __ix32 i = 0 ; i < n ; i += 2 * __HALFBAND_BLOCK_SIZE )
+        {
+            __ix32 len = ( n - i < 2 * __HALFBAND_BLOCK_SIZE ) ? n - i : 2 * __HALFBAND_BLOCK_SIZE;
+            __type *y  = ( m_S > 1 ) ? m_buff : &out[k];
+
+            // every stage output is written over its input , the last stage writes the chain output:
+            len = m_stage[ 0 ].process( &in[i] , len , y );
+            for( __ix32 s = 1 ; s < m_S ; s++ ) len = m_stage[ s ].process( m_buff , len , ( s < m_S - 1 ) ? m_buff : &out[k] );
+            k += len;
+        }
+        if( k > 0 ) m_out = out[ k - 1 ];
+        return k;
+    }
+
+    /*!
+     *  \brief decimation chain filtering () operator
+     *  \param[input] pointer to the input sample
+     *  \return the () operator calls filt( T2 *input ) function
+    */
+    template< typename T2 > inline __ix32 operator() ( T2 *input ) { return filt( input ); }
 };
 
-/*! \brief 32-bit floating point equalized comb FIR filter */
-template<> class fcombeq<__fx32>
+/*!
+ *  \brief CIC decimator with the FIR compensation template class
+ *  \details The S-stage cascaded integrator-comb decimator needs no multiplications: S integrators run at the input
+ *           sampling frequency Fs , S combs with the differential delay M run at the decimated frequency Fs / R:
+ *           \f[
+ *               H( z ) = \left( \frac{ 1 - z^{ -R * M } }{ 1 - z^{ -1 } } \right)^S
+ *           \f]
+ *           The integrators and combs use the modulo 2^64 integer arithmetic , so the integrators overflows are
+ *           cancelled by the combs as long as the input bits number plus the gain growth S * log2( R * M ) does not
+ *           exceed 64. The CIC output is scaled by 1 / ( R * M )^S and is filtered by the optional lowpass , that
+ *           compensates the CIC passband droop and decimates the output by D once more:
+ *           \code
+ *           cic_decimator< __ix16 > cic;
+ *           cic.init( 1e6 , 50 , 125 , 5 );    // 1 MHz -> 8 kHz
+ *           cic.comp_init( 1500 , 30 , 2 );   // 8 kHz -> 4 kHz
+ *           cic.allocate();
+ *           \endcode
+ *  \tparam T - input samples integer type ( __ix16 , __ix32 )
+*/
+template< typename T > class cic_decimator
 {
-    typedef __fx32 __type ;
-private:
+    typedef T                  __type ;
+    typedef unsigned long long __ux64 ;
+    typedef bool               __bool ;
+    typedef void               __void ;
 
-    /*! \brief input signal frequency deviation from nominal for which the amplitude frequency response slope compensation is implemented , Hz */
-    __fx64 m_dF;
-    /*! \brief residual amplitude frequency response slope for the input signal frequency deviation dF from nominal , p.u. */
-    __fx64 m_d_Amp;
-    /*! \brief input signal nominal frequency  , Hz */
-    __fx64 m_Fn;
-    /*! \brief input signal sampling frequency , Hz */
+    /*! \brief input sampling frequency , Hz */
     __fx64 m_Fs;
-    /*! \brief input signal sampling period , Hz */
-    __fx64 m_Ts;
-    /*! \brief auxiliary coefficient K1 */
-    __fx64 m_K1;
-    /*! \brief auxiliary coefficient K2 */
-    __fx64 m_K2;
-    /*! \brief filter order */
-    __ix32 m_order;
-    /*! \brief auxiliary coefficient ElemNum1 */
-    __ix32 m_ElemNum1;
-    /*! \brief auxiliary coefficient ElemNum2 */
-    __ix32 m_ElemNum2;
 
-    /*! \brief comb filter buffer */
-     mirror_ring_buffer< __type > m_bx;
+    /*! \brief nominal frequency , Hz */
+    __fx64 m_Fn;
+
+    /*! \brief CIC decimation ratio */
+    __ix32 m_R;
+
+    /*! \brief CIC stages number */
+    __ix32 m_S;
+
+    /*! \brief CIC comb differential delay */
+    __ix32 m_M;
+
+    /*! \brief CIC gain inverse 1 / ( R * M )^S */
+    __fx64 m_gain;
+
+    /*! \brief integrators */
+    __ux64 *m_integ;
+
+    /*! \brief combs delay lines ( S rows of M samples ) */
+    __ux64 *m_comb;
+
+    /*! \brief combs delay lines position */
+    __ix32 m_comb_pos;
+
+    /*! \brief CIC decimation phase counter */
+    __ix32 m_phase;
+
+    /*! \brief compensation lowpass specification data structure ( zero order - the compensation is not used ) */
+    fir_sp m_sp;
+
+    /*! \brief compensation lowpass decimation factor */
+    __ix32 m_D;
+
+    /*! \brief compensation lowpass time-reversed coefficients */
+    __fx64 *m_cfr;
+
+    /*! \brief compensation lowpass mirrored history ( 2 * N samples ) */
+    __fx64 *m_bx;
+
+    /*! \brief compensation lowpass history write position */
+    __ix32 m_pos;
+
+    /*! \brief compensation lowpass decimation phase counter */
+    __ix32 m_comp_phase;
+
+    /*!
+     *  \brief integrators block function
+     *  \param[x] - pointer to the input samples
+     *  \param[n] - number of the input samples
+     *  \details the integrators are kept in the registers within the block for the fixed stages number S ,
+     *           S = 0 - the stages number is taken from m_S
+    */
+    template< __ix32 S > __void integrate( const __type *x , __ix32 n )
+    {
+        __ux64 a[ S > 0 ? S : 1 ];
+        for( __ix32 s = 0 ; s < S ; s++ ) a[ s ] = m_integ[ s ];
+        for( __ix32 i = 0 ; i < n ; i++ )
+        {
+            a[ 0 ] += ( __ux64 )( __ix64 )x[i];
+            for( __ix32 s = 1 ; s < S ; s++ ) a[ s ] += a[ s - 1 ];
+        }
+        for( __ix32 s = 0 ; s < S ; s++ ) m_integ[ s ] = a[ s ];
+    }
+
+    /*!
+     *  \brief integrators block function dispatcher
+     *  \param[x] - pointer to the input samples
+     *  \param[n] - number of the input samples
+    */
+    __void integrate( const __type *x , __ix32 n )
+    {
+        switch( m_S )
+        {
+            case 1 : integrate< 1 >( x , n ); break;
+            case 2 : integrate< 2 >( x , n ); break;
+            case 3 : integrate< 3 >( x , n ); break;
+            case 4 : integrate< 4 >( x , n ); break;
+            case 5 : integrate< 5 >( x , n ); break;
+            case 6 : integrate< 6 >( x , n ); break;
+            default:
+                for( __ix32 i = 0 ; i < n ; i++ )
+                {
+                    __ux64 y = m_integ[ 0 ] += ( __ux64 )( __ix64 )x[i];
+                    for( __ix32 s = 1 ; s < m_S ; s++ ) y = m_integ[ s ] += y;
+                }
+                break;
+        }
+    }
+
+    /*!
+     *  \brief  combs and compensation lowpass function
+     *  \return the function computes the CIC output at the end of the decimation cycle and returns 1
+     *          if the new output m_out is computed and 0 otherwise
+    */
+    __ix32 decimate()
+    {
+        __ux64 y = m_integ[ m_S - 1 ];
+        for( __ix32 s = 0 ; s < m_S ; s++ )
+        {
+            __ux64 *d = &m_comb[ s * m_M + m_comb_pos ] , z = *d;
+            *d = y;
+            y -= z;
+        }
+        if( ++m_comb_pos >= m_M ) m_comb_pos = 0;
+        m_cic_out = ( __fx64 )( __ix64 )y * m_gain;
+        if( m_sp.order == 0 ) { m_out = m_cic_out; return 1; }
+
+        m_bx[ m_pos ] = m_bx[ m_pos + m_sp.N ] = m_cic_out;
+        if( ++m_pos >= m_sp.N ) m_pos = 0;
+        if( ++m_comp_phase < m_D ) return 0;
+        m_comp_phase = 0;
+        m_out = __dot__( &m_bx[ m_pos ] , m_cfr , m_sp.N );
+        return 1;
+    }
 
 public:
 
-    /*! \brief filter output */
+    /*! \brief CIC decimator output */
+    __fx64 m_cic_out;
+
+    /*! \brief compensated output ( the CIC decimator output if the compensation is not used ) */
     __fx64 m_out;
-    /*! \brief filter frequency phase response */
-    __fx64 m_pH;
-    /*! \brief filter frequency amplitude response */
-    __fx64 m_Km;
 
-    /*! \brief default constructor */
-    fcombeq()
+    /*! \brief compensation lowpass window function object */
+    wind_fcn m_wind;
+
+    /*!
+     *  \brief CIC decimator initialization function
+     *  \param[Fs] - input sampling frequency , Hz
+     *  \param[Fn] - nominal frequency        , Hz
+     *  \param[R]  - decimation ratio
+     *  \param[S]  - integrator and comb stages number
+     *  \param[M]  - comb differential delay ( 1 or 2 )
+     *  \details the compensation is disabled , the comp_init() function enables it
+    */
+    __void init( __fx64 Fs , __fx64 Fn , __ix32 R , __ix32 S , __ix32 M = 1 )
     {
-        m_Fs       = 4000;
-        m_Fn       = 50;
-        m_dF       = 5;
-        m_d_Amp    = 0;
-        m_order    = m_Fs / m_Fn / 2;
-        m_ElemNum1 = 1 * m_order;
-        m_ElemNum2 = 2 * m_order;
-        m_Ts       = 1 / m_Fs;
-        m_out      = 0;
-        m_Km       = 0;
-        m_pH       = 0;
+        deallocate();
+        m_Fs         = Fs;
+        m_Fn         = Fn;
+        m_R          = ( R > 0 ) ? R : 1;
+        m_S          = ( S > 0 ) ? S : 1;
+        m_M          = ( M > 0 ) ? M : 1;
+        m_gain       = pow( ( __fx64 )m_R * m_M , -m_S );
+        m_comb_pos   = 0;
+        m_phase      = 0;
+        m_sp         = fir_sp{ Fs / m_R , Fn , 0 , -1 , m_R / Fs , 0 , 1 , true , fir_type::lowpass_fir };
+        m_D          = 1;
+        m_pos        = 0;
+        m_comp_phase = 0;
+        m_cic_out    = 0;
+        m_out        = 0;
     }
 
-    /*! \brief default destructor */
-    ~fcombeq(){ deallocate(); }
-
     /*!
-     *  \brief comb filter initialization function
-     *  \param[ Fs    ] - input signal sampling frequency
-     *  \param[ Fn    ] - input signal nominal frequency
-     *  \param[ dF    ] - input signal frequency deviation from nominal for which the amplitude frequency response slope compensation is implemented , Hz
-     *  \param[ d_Amp ] - residual amplitude frequency response slope for the input signal frequency deviation dF from nominal , p.u.
+     *  \brief compensation lowpass initialization function
+     *  \param[Fc]    - cut-off frequency , Hz
+     *  \param[order] - filter order ( 0 - the compensation is not used )
+     *  \param[D]     - decimation factor at the CIC output
+     *  \details the lowpass runs at the CIC output sampling frequency Fs / R , the function must be called before
+     *           the memory allocation
     */
-    void init( __fx64 Fs, __fx64 Fn, __fx64 dF, __fx64 d_Amp )
+    __void comp_init( __fx64 Fc , __ix32 order , __ix32 D = 1 )
     {
-        m_Fs       = Fs;
-        m_Fn       = Fn;
-        m_dF       = dF;
-        m_d_Amp	   = d_Amp;
-        m_order    = m_Fs / m_Fn / 2;
-        m_ElemNum1 = 1 * m_order;
-        m_ElemNum2 = 2 * m_order;
-        m_Ts       = 1 / m_Fs;
-        m_K1       = ( 1 + 0.19/0.5 );
-        m_K2       =  0.19 / 0.5;
-        m_out      = 0;
-        m_Km       = 0;
-        m_pH       = 0;
+        order = ( order > 0 ) ? order : 0;
+        m_sp  = fir_sp{ m_Fs / m_R , m_Fn , Fc , -1 , m_R / m_Fs , order , order + 1 , true , fir_type::lowpass_fir };
+        m_D   = ( D > 0 ) ? D : 1;
+        m_wind.init( m_sp.N );
     }
 
-    /*! \brief memory allocation function */
+    /*!
+     *  \brief  memory allocation function
+     *  \return the function returns 1 if the memory is allocated and 0 otherwise or if the CIC registers
+     *          bits number exceeds 64
+    */
     __ix32 allocate()
     {
-        // auxiliary coefficients:
-        __fx64 A =  0.5 - 0.5 * cos(-6.283185307179586476925286766559 * (m_Fn + m_dF) * (__fx64)m_order * m_Ts );
-        __fx64 B =  1.0 - cos(-6.283185307179586476925286766559 * (m_Fn + m_dF) * (__fx64)m_order * 2.0 * m_Ts);
-        __fx64 C = -0.5 * sin(-6.283185307179586476925286766559 * (m_Fn + m_dF) * (__fx64)m_order * m_Ts);
-        __fx64 D = -sin(-6.283185307179586476925286766559 * (m_Fn + m_dF) * (__fx64)m_order * 2.0 * m_Ts);
+        if( 8 * sizeof ( __type ) + ceil( m_S * log2( ( __fx64 )m_R * m_M ) ) > 64 ) return 0;
+        m_integ = ( __ux64* ) calloc( m_S , sizeof ( __ux64 ) );
+        m_comb  = ( __ux64* ) calloc( m_S * m_M , sizeof ( __ux64 ) );
+        if( m_integ == 0 || m_comb == 0 ) return 0;
+        if( m_sp.order == 0 ) return 1;
+
+        __fx64 *cf = __fir_wind_cic_comp__< __fx64 >( m_sp.Fs , m_sp.Fc , m_sp.order , m_R , m_S , m_M , m_sp.scale , m_wind );
+        m_cfr = ( __fx64* ) calloc( m_sp.N , sizeof ( __fx64 ) );
+        m_bx  = ( __fx64* ) calloc( m_sp.N * 2 , sizeof ( __fx64 ) );
+        if( cf == 0 || m_cfr == 0 || m_bx == 0 ) { if( cf != 0 ) free( cf ); return 0; }
+        for( __ix32 n = 0 ; n <= m_sp.order ; n++ ) m_cfr[ n ] = cf[ m_sp.order - n ];
+        free( cf );
+        return 1;
+    }
 
-        // square equation coefficients:
-        __fx64 a  = 1;
-        __fx64 b  = 2 * ( A * B + C * D ) / (B * B + D * D);
-        __fx64 c  = (A * A + C * C - (1 + m_d_Amp / 100) * (1 + m_d_Amp / 100) ) / (B * B + D * D);
+    /*! \brief memory deallocation function */
+    __void deallocate()
+    {
+        if( m_integ != 0 ) { free( m_integ ); m_integ = 0; }
+        if( m_comb  != 0 ) { free( m_comb  ); m_comb  = 0; }
+        if( m_cfr   != 0 ) { free( m_cfr   ); m_cfr   = 0; }
+        if( m_bx    != 0 ) { free( m_bx    ); m_bx    = 0; }
+        m_wind.deallocate();
+    }
 
-        // square equation solve:
-        __fx64 discr  = b * b - 4 * a * c;
-        __fx64 K1     = 0;
-        __fx64 K2     = 0;
+    /*! \brief default constructor */
+    cic_decimator() : m_integ( 0 ) , m_comb( 0 ) , m_cfr( 0 ) , m_bx( 0 ) { init( 1e6 , 50 , 125 , 5 ); }
 
-        if ( discr > 0 ) // discriminant check
-        {
-            // roots computation:
-            K1 = ( -b - sqrt( discr ) ) * 0.5;
-            K2 = ( -b + sqrt( discr ) ) * 0.5;
+    /*! \brief destructor */
+    ~cic_decimator() { deallocate(); }
 
-            // take the greates of the roots ( although, it does not matter which root you take... ):
-            m_K1 = (1 + fmax(K1 , K2) / 0.5);
-            m_K2 = fmax(K1, K2) / 0.5;
-        }
-        else // if discriminant is negative, then the amplitude frequency slope is not compensated
-        {
-            m_K1 = 1;
-            m_K2 = 0;
-        }
+    /*! \brief total decimation factor getting function */
+    inline __ix32 factor() { return m_R * ( ( m_sp.order > 0 ) ? m_D : 1 ); }
 
-        return m_bx.allocate( m_ElemNum2 + 1 );;
+    /*!
+     *  \brief  frequency response computation function
+     *  \param[F] - input frequency , Hz
+     *  \return the function returns the CIC decimator and the compensation lowpass frequency response at the input sampling frequency
+    */
+    fir_fr< __fx64 > freq_resp( __fx64 F )
+    {
+        fir_fr< __fx64 > fr = __cic_freq_resp__( m_Fs , F , m_R , m_S , m_M );
+        if( m_sp.order == 0 || m_cfr == 0 ) return fr;
+
+        // the time-reversed coefficients of the symmetric lowpass are equal to the direct ones:
+        fir_fr< __fx64 > fc = __fir_freq_resp__< __fx64 , __fx64 >( m_sp.Fs , F , m_sp.order , m_cfr );
+        return fir_fr< __fx64 >{ fr.Km * fc.Km , atan2( sin( fr.pH + fc.pH ) , cos( fr.pH + fc.pH ) ) };
     }
 
-    /*! \brief memory deallocation function */
-    void deallocate()
+    /*!
+     *  \brief  CIC decimator state saving function
+     *  \param[blob] pointer to the state memory block or null pointer to compute the state size only
+     *  \return the function stores the parameters , integrators , combs , compensation lowpass coefficients , history
+     *          and outputs into the state memory block and returns the state size , bytes
+    */
+    __ix32 save_state( void *blob )
     {
-        m_bx.deallocate();
+        char  *data = ( char* )blob;
+        __ix32 pos  = 0;
+        if( m_integ == 0 || m_comb == 0 || ( m_sp.order > 0 && ( m_cfr == 0 || m_bx == 0 ) ) ) return 0;
+
+        __fx64 params[] = { m_Fs , m_Fn , m_gain , m_cic_out , m_out };
+        __ix32 counts[] = { m_R , m_S , m_M , m_comb_pos , m_phase , m_D , m_pos , m_comp_phase };
+        __state_begin__( data , pos , "cic_decimator" );
+        __state_put__( data , pos , params , 5 );
+        __state_put__( data , pos , counts , 8 );
+        __state_put__( data , pos , &m_sp );
+        __state_put__( data , pos , m_integ , m_S );
+        __state_put__( data , pos , m_comb  , m_S * m_M );
+        if( m_sp.order > 0 )
+        {
+            __state_put__( data , pos , m_cfr , m_sp.N );
+            __state_put__( data , pos , m_bx  , m_sp.N * 2 );
+        }
+        return __state_end__( data , pos );
     }
 
-    /*! \brief frequency response computation function */
-    fir_fr< __fx64 > freq_resp( __fx64 F , bool mode = 0 )
+    /*!
+     *  \brief  CIC decimator state loading function
+     *  \param[blob] pointer to the state memory block
+     *  \param[size] available memory size , bytes
+     *  \return the function restores the decimator without the compensation lowpass redesign and returns the number of
+     *          the bytes read or 0 if the state can not be restored. The decimator is not changed if the state is not valid.
+    */
+    __ix32 load_state( const void *blob , __ix32 size )
     {
-        __fx64 Re  = 0 , Im  = 0;
-
-        if( !mode ) // even filter
+        const char *data = ( const char* )blob;
+        __ix32  pos = 0 , end = __state_open__( data , size , pos , "cic_decimator" ) , counts[ 8 ] , ok = 0;
+        __fx64  params[ 5 ];
+        fir_sp  sp;
+        __ux64 *integ = 0 , *comb = 0;
+        __fx64 *cfr = 0 , *bx = 0;
+        if( end == 0 ) return 0;
+
+        if( !__state_get__( data , end , pos , params , 5 ) || !__state_get__( data , end , pos , counts , 8 ) ||
+            !__state_get__( data , end , pos , &sp ) ) return 0;
+
+        // R , S , M , the combs position and the phases are checked as well as the compensation lowpass size:
+        const __ix32 R = counts[0] , S = counts[1] , M = counts[2];
+        if( R <= 0 || S <= 0 || M <= 0 || !__state_room__< __ux64 >( end , pos , S ) || !__state_room__< __ux64 >( end , pos , M ) ||
+            ( __ix64 )S * M > ( end - pos ) / ( __ix32 )sizeof ( __ux64 ) ||
+            8 * sizeof ( __type ) + ceil( S * log2( ( __fx64 )R * M ) ) > 64 ) return 0;
+        if( counts[3] < 0 || counts[3] >= M || counts[4] < 0 || counts[4] >= R || sp.order < 0 || sp.N != sp.order + 1 ) return 0;
+        if( sp.order > 0 && ( counts[5] <= 0 || counts[6] < 0 || counts[6] >= sp.N || counts[7] < 0 || counts[7] >= counts[5] ||
+                              !__state_room__< __fx64 >( end , pos , sp.N ) ) ) return 0;
+
+        // the state is restored into the temporaries , that replace the decimator members only on success:
+        integ = ( __ux64* ) calloc( S , sizeof ( __ux64 ) );
+        comb  = ( __ux64* ) calloc( S * M , sizeof ( __ux64 ) );
+        ok    = integ && comb && __state_get__( data , end , pos , integ , S ) && __state_get__( data , end , pos , comb , S * M );
+        if( ok && sp.order > 0 )
         {
-            Re = m_K1 - cos(-PI2 * (__fx64)m_order * F * m_Ts) - m_K2 * cos(-PI2 * 2 * (__fx64)m_order * F * m_Ts);
-            Im = 0    - sin(-PI2 * (__fx64)m_order * F * m_Ts) - m_K2 * sin(-PI2 * 2 * (__fx64)m_order * F * m_Ts);
+            cfr = ( __fx64* ) calloc( sp.N , sizeof ( __fx64 ) );
+            bx  = ( __fx64* ) calloc( sp.N * 2 , sizeof ( __fx64 ) );
+            ok  = cfr && bx && __state_get__( data , end , pos , cfr , sp.N ) && __state_get__( data , end , pos , bx , sp.N * 2 );
         }
-        else // odd filter
+        if( !ok || pos != end )
         {
-            Re = m_K1 + cos(-PI2 * (__fx64)m_order * F * m_Ts) - m_K2 * cos(-PI2 * 2 * (__fx64)m_order * F * m_Ts);
-            Im = 0    + sin(-PI2 * (__fx64)m_order * F * m_Ts) - m_K2 * sin(-PI2 * 2 * (__fx64)m_order * F * m_Ts);
+            free( integ );
+            free( comb );
+            free( cfr );
+            free( bx );
+            return 0;
         }
 
-        m_pH = atan2(Im, Re);
-        m_Km = sqrt(Re * Re + Im * Im);
-        return { m_Km , m_pH };
+        deallocate();
+        m_Fs         = params[0];
+        m_Fn         = params[1];
+        m_gain       = params[2];
+        m_cic_out    = params[3];
+        m_out        = params[4];
+        m_R          = R;
+        m_S          = S;
+        m_M          = M;
+        m_comb_pos   = counts[3];
+        m_phase      = counts[4];
+        m_D          = counts[5];
+        m_pos        = counts[6];
+        m_comp_phase = counts[7];
+        m_sp         = sp;
+        m_integ      = integ;
+        m_comb       = comb;
+        m_cfr        = cfr;
+        m_bx         = bx;
+        m_wind.init( m_sp.N );
+        return end;
     }
 
     /*!
-     *  \brief 32-bit floating point filtering function
-     *  \param[input] - pointer to the input signal samples buffer
-     *  \return The function returns filtering result
+     *  \brief  CIC decimator filtering function
+     *  \param[input] pointer to the input sample
+     *  \return the function returns 1 if the new output m_out is computed and 0 otherwise
     */
-    inline __fx64 filt( __type *input , bool odd = true)
+    template< typename T2 > inline __ix32 filt( T2 *input )
     {
-        m_bx(input);
-        return ( m_out = ( odd ) ? ( (__fx64)*input * m_K1 - (__fx64)m_bx[m_ElemNum1] - (__fx64)m_bx[m_ElemNum2] * m_K2 ) : ( (__fx64)*input * m_K1 + (__fx64)m_bx[m_ElemNum1] - (__fx64)m_bx[m_ElemNum2] * m_K2 ) );
+        __ux64 y = m_integ[ 0 ] += ( __ux64 )( __ix64 )( __type )( *input );
+        for( __ix32 s = 1 ; s < m_S ; s++ ) y = m_integ[ s ] += y;
+        if( ++m_phase < m_R ) return 0;
+        m_phase = 0;
+        return decimate();
     }
 
     /*!
-     *  \brief 64-bit floating point filtering function
-     *  \param[input] - pointer to the input signal samples buffer
-     *  \return The function returns filtering result
+     *  \brief  CIC decimator block filtering function
+     *  \param[in ] pointer to the input samples block
+     *  \param[n  ] number of the input samples
+     *  \param[out] pointer to the output samples
+     *  \return the function returns the number of the computed output samples. The decimation phases are
+     *          kept between the calls , so the block size does not need to be a multiple of the factor.
+     *          The input is integrated by the decimation cycles with the integrators kept in the registers.
     */
-    inline __fx64 filt( __fx64 *input , bool odd = true)
+    __ix32 process( const __type *in , __ix32 n , __fx64 *out )
     {
-        m_bx(input);
-        return ( m_out = ( odd ) ? ( *input * m_K1 - m_bx[m_ElemNum1] - m_bx[m_ElemNum2] * m_K2 ) : ( *input * m_K1 + (__fx64)m_bx[m_ElemNum1] - m_bx[m_ElemNum2] * m_K2 ) );
+        __ix32 k = 0;
+        for( __ix32 i = 0 ; i < n ; )
+        {
+            __ix32 len = ( n - i < m_R - m_phase ) ? n - i : m_R - m_phase;
+            integrate( &in[i] , len );
+            i += len;
+            if( ( m_phase += len ) < m_R ) break;
+            m_phase = 0;
+            if( decimate() ) out[k++] = m_out;
+        }
+        return k;
     }
 
     /*!
-     *  \brief 32-bit floating point filtering operator
-     *  \param[input] - pointer to the input signal samples buffer
-     *  \return The operatoe calls the function that returns filtering result
-    */
-    inline __fx64 operator ()( __type *input , bool odd = true ) { return filt( input , odd ); }
-
-    /*!
-     *  \brief 64-bit floating point filtering operator
-     *  \param[input] - pointer to the input signal samples buffer
-     *  \return The operatoe calls the function that returns filtering result
+     *  \brief CIC decimator filtering () operator
+     *  \param[input] pointer to the input sample
+     *  \return the () operator calls filt( T2 *input ) function
     */
-    inline __fx64 operator ()( __fx64 *input , bool odd = true ) { return filt( input , odd ); }
+    template< typename T2 > inline __ix32 operator() ( T2 *input ) { return filt( input ); }
 };
 
-/*! \brief 64-bit floating point equalized comb FIR filter */
-template<> class fcombeq<__fx64>
+/*!
+ *  \brief compile-time FIR filter template class
+ *  \details The coefficients of the fixed configuration are computed during compilation by the constexpr
+ *           design functions into the std::array , and the input history is kept in the fixed size mirrored
+ *           buffer , so the filter needs neither the heap nor the startup design work. The frequencies are
+ *           passed in mHz , since the floating point template parameters are not allowed:
+ *           \code
+ *           static_fir< __fx32 , 32 , 4000000 , 100000 > lp; // 32-th order Fs = 4000 Hz , Fc = 100 Hz lowpass
+ *           \endcode
+ *           The coefficients are equal to the ones computed by the fir class with the same window.
+ *  \tparam T       - samples and coefficients type ( float , double )
+ *  \tparam Order   - filter order
+ *  \tparam FsMilli - sampling frequency , mHz
+ *  \tparam FcMilli - cut-off ( pass ) frequency , mHz
+ *  \tparam Window  - window function type , the windows having parameters and the Chebyshev window are not supported
+ *  \tparam Type    - filter type
+ *  \tparam BWMilli - bandpass or bandstop width , mHz
+ *  \tparam Scale   - filter scaling flag ( 0 - not-scaled filter , 1 - scaled filter )
+*/
+template< typename T , __ix32 Order , __ix64 FsMilli , __ix64 FcMilli , wind_type Window , fir_type Type , __ix64 BWMilli , __ix32 Scale > class static_fir
 {
-    typedef __fx64 __type ;
-private:
-
-    /*! \brief input signal frequency deviation from nominal for which the amplitude frequency response slope compensation is implemented , Hz */
-    __fx64 m_dF;
-    /*! \brief residual amplitude frequency response slope for the input signal frequency deviation dF from nominal , p.u. */
-    __fx64 m_d_Amp;
-    /*! \brief input signal nominal frequency  , Hz */
-    __fx64 m_Fn;
-    /*! \brief input signal sampling frequency , Hz */
-    __fx64 m_Fs;
-    /*! \brief input signal sampling period , Hz */
-    __fx64 m_Ts;
-    /*! \brief auxiliary coefficient K1 */
-    __fx64 m_K1;
-    /*! \brief auxiliary coefficient K2 */
-    __fx64 m_K2;
-    /*! \brief filter order */
-    __ix32 m_order;
-    /*! \brief auxiliary coefficient ElemNum1 */
-    __ix32 m_ElemNum1;
-    /*! \brief auxiliary coefficient ElemNum2 */
-    __ix32 m_ElemNum2;
+    typedef T    __type ;
+    typedef void __void ;
 
-    /*! \brief comb filter buffer */
-     mirror_ring_buffer< __type > m_bx;
-
-public:
+    static_assert( Order > 0 , "static_fir: the filter order must be positive" );
+    static_assert( FcMilli > 0 && BWMilli >= 0 && 2 * ( FcMilli + BWMilli ) <= FsMilli , "static_fir: the frequencies must be within ( 0 ; Fs / 2 ]" );
+    static_assert( __cx_wind_supported__( Window ) , "static_fir: the window function is not supported by the compile-time design" );
+    static_assert( Type != bandstop_fir || Order % 2 == 0 , "static_fir: the bandstop filter order must be even" );
 
-    /*! \brief filter output */
-    __fx64 m_out;
-    /*! \brief filter frequency phase response */
-    __fx64 m_pH;
-    /*! \brief filter frequency amplitude response */
-    __fx64 m_Km;
+    /*! \brief mirrored input buffer , x[ n - k ] = m_bx[ m_pos + k ] , k = 0 ... Order */
+    __type m_bx[ 2 * ( Order + 1 ) ];
 
-    /*! \brief default constructor */
-    fcombeq()
-    {
-        m_Fs       = 4000;
-        m_Fn       = 50;
-        m_dF       = 5;
-        m_d_Amp    = 0;
-        m_order    = m_Fs / m_Fn / 2;
-        m_ElemNum1 = 1 * m_order;
-        m_ElemNum2 = 2 * m_order;
-        m_Ts       = 1 / m_Fs;
-        m_out      = 0;
-        m_Km       = 0;
-        m_pH       = 0;
-    }
+    /*! \brief newest sample position */
+    __ix32 m_pos;
 
-    /*! \brief default destructor */
-    ~fcombeq(){ deallocate(); }
+    /*!
+     *  \brief  gain computation function
+     *  \param[re] frequency response real part
+     *  \param[im] frequency response imaginary part
+     *  \return the function returns sqrt( re^2 + im^2 )
+    */
+    static constexpr __fx64 gain( __fx64 re , __fx64 im ) { return __cx_sqrt__( re * re + im * im ); }
 
     /*!
-     *  \brief comb filter initialization function
-     *  \param[ Fs    ] - input signal sampling frequency
-     *  \param[ Fn    ] - input signal nominal frequency
-     *  \param[ dF    ] - input signal frequency deviation from nominal for which the amplitude frequency response slope compensation is implemented , Hz
-     *  \param[ d_Amp ] - residual amplitude frequency response slope for the input signal frequency deviation dF from nominal , p.u.
+     *  \brief  convolution function
+     *  \return The function returns sum( m_cf[ k ] * x[ n - k ] ) , k = 0 ... Order. The trip count and the coefficients
+     *          are the compile-time constants , so the eight independent partial sums are unrolled and vectorized by the compiler.
     */
-    void init( __fx64 Fs, __fx64 Fn, __fx64 dF, __fx64 d_Amp )
+    inline __type dot() const
     {
-        m_Fs       = Fs;
-        m_Fn       = Fn;
-        m_dF       = dF;
-        m_d_Amp	   = d_Amp;
-        m_order    = m_Fs / m_Fn / 2;
-        m_ElemNum1 = 1 * m_order;
-        m_ElemNum2 = 2 * m_order;
-        m_Ts       = 1 / m_Fs;
-        m_K1       = ( 1 + 0.19/0.5 );
-        m_K2       =  0.19 / 0.5;
-        m_out      = 0;
-        m_Km       = 0;
-        m_pH       = 0;
+        const __type *x = m_bx + m_pos;
+        __type a0 = 0 , a1 = 0 , a2 = 0 , a3 = 0 , a4 = 0 , a5 = 0 , a6 = 0 , a7 = 0;
+        __ix32 k = 0;
+        for( ; k + 8 <= Order + 1 ; k += 8 )
+        {
+            a0 += m_cf[ k + 0 ] * x[ k + 0 ];
+            a1 += m_cf[ k + 1 ] * x[ k + 1 ];
+            a2 += m_cf[ k + 2 ] * x[ k + 2 ];
+            a3 += m_cf[ k + 3 ] * x[ k + 3 ];
+            a4 += m_cf[ k + 4 ] * x[ k + 4 ];
+            a5 += m_cf[ k + 5 ] * x[ k + 5 ];
+            a6 += m_cf[ k + 6 ] * x[ k + 6 ];
+            a7 += m_cf[ k + 7 ] * x[ k + 7 ];
+        }
+        for( ; k <= Order ; k++ ) a0 += m_cf[ k ] * x[ k ];
+        return ( ( a0 + a4 ) + ( a1 + a5 ) ) + ( ( a2 + a6 ) + ( a3 + a7 ) );
     }
 
-    /*! \brief memory allocation function */
-    __ix32 allocate()
-    {
-        // auxiliary coefficients:
-        __fx64 A =  0.5 - 0.5 * cos(-6.283185307179586476925286766559 * (m_Fn + m_dF) * (__fx64)m_order * m_Ts );
-        __fx64 B =  1.0 - cos(-6.283185307179586476925286766559 * (m_Fn + m_dF) * (__fx64)m_order * 2.0 * m_Ts);
-        __fx64 C = -0.5 * sin(-6.283185307179586476925286766559 * (m_Fn + m_dF) * (__fx64)m_order * m_Ts);
-        __fx64 D = -sin(-6.283185307179586476925286766559 * (m_Fn + m_dF) * (__fx64)m_order * 2.0 * m_Ts);
-
-        // square equation coefficients:
-        __fx64 a  = 1;
-        __fx64 b  = 2 * ( A * B + C * D ) / (B * B + D * D);
-        __fx64 c  = (A * A + C * C - (1 + m_d_Amp / 100) * (1 + m_d_Amp / 100) ) / (B * B + D * D);
+public:
 
-        // square equation solve:
-        __fx64 discr  = b * b - 4 * a * c;
-        __fx64 K1     = 0;
-        __fx64 K2     = 0;
+    /*! \brief compile-time specification */
+    static constexpr fir_static_sp m_sp = { Type , Window , Order , ( __fx64 )FcMilli / FsMilli , ( __fx64 )( FcMilli + BWMilli ) / FsMilli };
 
-        if ( discr > 0 ) // discriminant check
-        {
-            // roots computation:
-            K1 = ( -b - sqrt( discr ) ) * 0.5;
-            K2 = ( -b + sqrt( discr ) ) * 0.5;
+    /*! \brief compile-time coefficients */
+    static constexpr std::array< __type , Order + 1 > m_cf = __fir_static_design__< __type >( m_sp ,
+        Scale ? gain( m_sp.re( m_sp.scale_freq() , 0 , Order + 1 ) , m_sp.im( m_sp.scale_freq() , 0 , Order + 1 ) ) : 1.0 ,
+        typename __cx_make_index__< Order + 1 >::type() );
 
-            // take the greates of the roots ( although, it does not matter which root you take... ):
-            m_K1 = (1 + fmax(K1 , K2) / 0.5);
-            m_K2 = fmax(K1, K2) / 0.5;
-        }
-        else // if discriminant is negative, then the amplitude frequency slope is not compensated
-        {
-            m_K1 = 1;
-            m_K2 = 0;
-        }
+    /*! \brief filter output */
+    __type m_out;
 
-        return m_bx.allocate( m_ElemNum2 + 1 );;
-    }
+    /*! \brief default constructor */
+    static_fir() : m_bx() , m_pos( 0 ) , m_out( 0 ) {}
 
-    /*! \brief memory deallocation function */
-    void deallocate()
+    /*! \brief filter history reset function */
+    __void reset()
     {
-        m_bx.deallocate();
+        for( __ix32 k = 0 ; k < 2 * ( Order + 1 ) ; k++ ) m_bx[ k ] = 0;
+        m_pos = 0;
+        m_out = 0;
     }
 
-    /*! \brief frequency response computation function */
-    fir_fr< __fx64 > freq_resp( __fx64 F , bool mode = 0 )
-    {
-        __fx64 Re  = 0 , Im  = 0;
+    /*!
+     *  \brief  filter order getting function
+     *  \return the function returns the filter order
+    */
+    static constexpr __ix32 order() { return Order; }
 
-        if( !mode ) // even filter
-        {
-            Re = m_K1 - cos(-PI2 * (__fx64)m_order * F * m_Ts) - m_K2 * cos(-PI2 * 2 * (__fx64)m_order * F * m_Ts);
-            Im = 0    - sin(-PI2 * (__fx64)m_order * F * m_Ts) - m_K2 * sin(-PI2 * 2 * (__fx64)m_order * F * m_Ts);
-        }
-        else // odd filter
-        {
-            Re = m_K1 + cos(-PI2 * (__fx64)m_order * F * m_Ts) - m_K2 * cos(-PI2 * 2 * (__fx64)m_order * F * m_Ts);
-            Im = 0    + sin(-PI2 * (__fx64)m_order * F * m_Ts) - m_K2 * sin(-PI2 * 2 * (__fx64)m_order * F * m_Ts);
-        }
+    /*!
+     *  \brief  filter coefficient getting function
+     *  \param[n] coefficient number
+     *  \return the function returns n-th filter coefficient
+    */
+    inline __type get_coeff( __ix32 n ) { return ( n <= Order ) ? m_cf[ n ] : 1e6; }
 
-        m_pH = atan2(Im, Re);
-        m_Km = sqrt(Re * Re + Im * Im);
-        return { m_Km , m_pH };
-    }
+    /*!
+     *  \brief  frequency response computation function
+     *  \param[F] input frequency , Hz
+     *  \return the function returns fir_fr data structure
+    */
+    inline fir_fr< __fx64 > freq_resp( __fx64 F ) { return __fir_freq_resp__< __fx64 , const __type >( FsMilli / 1000.0 , F , Order , m_cf.data() ); }
 
     /*!
-     *  \brief 32-bit floating point filtering function
-     *  \param[input] - pointer to the input signal samples buffer
-     *  \return The function returns filtering result
+     *  \brief  dense frequency response computation function
+     *  \param[fr     ] frequency response grid
+     *  \param[npoints] number of the grid points over [ 0 ; Fs / 2 ] , rounded up to 2^m + 1
+     *  \return the function computes the response by means of one real FFT and returns the number of the grid points
     */
-    inline __fx64 filt( __type *input , bool odd = true)
+    inline __ix32 freq_resp_grid( fir_fr_grid &fr , __ix32 npoints ) { return __fir_freq_resp_grid__< __type >( FsMilli / 1000.0 , Order , m_cf.data() , fr , npoints ); }
+
+    /*!
+     *  \brief  filtering function
+     *  \param[input] pointer to the input data
+     *  \return the function returns filtering result
+    */
+    template< typename T2 > inline __type filt( T2 *input )
     {
-        m_bx(input);
-        return ( m_out = ( odd ) ? ( (__fx64)*input * m_K1 - (__fx64)m_bx[m_ElemNum1] - (__fx64)m_bx[m_ElemNum2] * m_K2 ) : ( (__fx64)*input * m_K1 + (__fx64)m_bx[m_ElemNum1] - (__fx64)m_bx[m_ElemNum2] * m_K2 ) );
+        m_pos = ( m_pos == 0 ) ? Order : m_pos - 1;
+        m_bx[ m_pos ] = m_bx[ m_pos + Order + 1 ] = ( __type )*input;
+        return m_out = dot();
     }
 
     /*!
-     *  \brief 32-bit floating point filtering operator
-     *  \param[input] - pointer to the input signal samples buffer
-     *  \return The operatoe calls the function that returns filtering result
+     *  \brief  block filtering function
+     *  \param[in ] pointer to the input samples
+     *  \param[out] pointer to the output samples
+     *  \param[n  ] number of the samples
     */
-    inline __fx64 operator ()( __type *input , bool odd = true ) { return filt( input , odd ); }
+    inline __void process( const __type *in , __type *out , __ix32 n ) { for( __ix32 i = 0 ; i < n ; i++ ) out[ i ] = filt( in + i ); }
+
+    /*!
+     *  \brief filtering () operator
+     *  \param[input] pointer to the input data
+     *  \return the () operator calls filt( T2 *input ) function that returns filtering result
+    */
+    template< typename T2 > inline __type operator() ( T2 *input ) { return filt( input ); }
 };
 
+// the static constexpr members definitions ( required by C++11 when the members are odr-used ):
+template< typename T , __ix32 Order , __ix64 FsMilli , __ix64 FcMilli , wind_type Window , fir_type Type , __ix64 BWMilli , __ix32 Scale >
+constexpr fir_static_sp static_fir< T , Order , FsMilli , FcMilli , Window , Type , BWMilli , Scale >::m_sp;
+
+template< typename T , __ix32 Order , __ix64 FsMilli , __ix64 FcMilli , wind_type Window , fir_type Type , __ix64 BWMilli , __ix32 Scale >
+constexpr std::array< T , Order + 1 > static_fir< T , Order , FsMilli , FcMilli , Window , Type , BWMilli , Scale >::m_cf;
+
 /*! @} */
 
 #undef __fx32
 #undef __fx64
+#undef __ix16
 #undef __ix32
+#undef __ix64
 #undef __fxx64
 
 // customized pi undef:
@@ -16,6 +16,7 @@
 #include "cmath"
 #include "math.h"
 #include <iostream>
+#include <new>
 #endif
 
 /*! \defgroup <IIR_FILTERS> ( IIR filters )
@@ -130,22 +131,25 @@ template< typename T > struct iir_bf;
  *  \param[bx] pointer to the IIR filter second order sections input buffers
  *  \param[by] pointer to the IIR filter second order sections output buffers
  *  \param[N]  number of the IIR filter coefficients
+ *  \param[arena] pointer to the memory block that holds the buffers and the IIR filter coefficients
 */
-template<> struct iir_bf< __fx32  >{ mirror_ring_buffer< __fx32  > *bx , *by; __ix32 N; };
+template<> struct iir_bf< __fx32  >{ mirror_ring_buffer< __fx32  > *bx , *by; __ix32 N; void *arena; };
 /*!
  *  \brief 64-bit floating point IIR filter coefficients matrix data structure
  *  \param[bx] pointer to the IIR filter second order sections input buffers
  *  \param[by] pointer to the IIR filter second order sections output buffers
  *  \param[N]  number of the IIR filter coefficients
+ *  \param[arena] pointer to the memory block that holds the buffers and the IIR filter coefficients
 */
-template<> struct iir_bf< __fx64  >{ mirror_ring_buffer< __fx64  > *bx , *by; __ix32 N; };
+template<> struct iir_bf< __fx64  >{ mirror_ring_buffer< __fx64  > *bx , *by; __ix32 N; void *arena; };
 /*!
  *  \brief extended 64-bit floating point IIR filter coefficients matrix data structure
  *  \param[bx] pointer to the IIR filter second order sections input buffers
  *  \param[by] pointer to the IIR filter second order sections output buffers
  *  \param[N]  number of the IIR filter coefficients
+ *  \param[arena] pointer to the memory block that holds the buffers and the IIR filter coefficients
 */
-template<> struct iir_bf< __fxx64 >{ mirror_ring_buffer< __fxx64 > *bx , *by; __ix32 N; };
+template<> struct iir_bf< __fxx64 >{ mirror_ring_buffer< __fxx64 > *bx , *by; __ix32 N; void *arena; };
 
 /*! \brief template IIR filter frequency response data structure */
 template < typename T > struct iir_fr;
@@ -1531,51 +1535,81 @@ template < typename T > iir_cf<T> __cheb2_ellip_digital_bs__( __fx64 Fs , __fx64
     return iir_cf< T >{ cfnum , cfden , gains , 2*L , R , 2*L+R  };
 }
 
+/*! \brief defines IIR filter memory arena alignment , bytes */
+#ifndef __IIR_ARENA_ALIGNMENT
+#define __IIR_ARENA_ALIGNMENT 64
+#endif
+
 /*!
- * \brief    IIR filter input/output buffers memory allocation function
- * \param[N] IIR filer input/output buffers size
- * \return   The function allocates memory for IIR filter input/output buffers
+ * \brief     IIR filter input/output buffers memory allocation function
+ * \param[cf] IIR filer coefficients data structure
+ * \return    The function allocates a single aligned memory block ( arena ) for IIR filter input/output buffers
+ *            and moves the IIR filter coefficients into it. The arena holds the buffers objects , the second order sections
+ *            states ( every section input and output states are placed next to each other ) and the coefficients.
+ *            The coefficients previous memory is released , so cf must not be released by means of __iir_cf_free__ then.
+ *            If the arena allocation fails , the coefficients are left untouched.
 */
 
-template< typename T > iir_bf<T> __iir_bf_alloc__( __ix32 N )
+template< typename T > iir_bf<T> __iir_bf_alloc__( iir_cf<T> &cf )
 {
-    mirror_ring_buffer<T> *bx = new mirror_ring_buffer<T> [ N ];
-    mirror_ring_buffer<T> *by = new mirror_ring_buffer<T> [ N ];
+    __ix32 N  = cf.N;
+    size_t So = ( ( 2 * N * sizeof ( mirror_ring_buffer<T> ) + __IIR_ARENA_ALIGNMENT - 1 ) / __IIR_ARENA_ALIGNMENT ) * __IIR_ARENA_ALIGNMENT;
+    size_t Sd = ( 14 * N + 7 * N + 1 ) * sizeof ( T );
+    void *arena = calloc( So + Sd + __IIR_ARENA_ALIGNMENT , 1 );
+    if( arena == 0 ) return iir_bf< T >{ 0 , 0 , -1 , 0 };
+
+    // memory layout: buffers objects , sections states , numerator , denominator and gains coefficients:
+    char *base = ( char* )( ( ( size_t )arena + __IIR_ARENA_ALIGNMENT - 1 ) & ~( size_t )( __IIR_ARENA_ALIGNMENT - 1 ) );
+    mirror_ring_buffer<T> *bx = ( mirror_ring_buffer<T>* )base;
+    mirror_ring_buffer<T> *by = bx + N;
+    T *state = ( T* )( base + So );
+    T *cfnum = state + 14 * N;
+    T *cfden = cfnum +  3 * N;
+    T *gains = cfden +  3 * N;
+
     for( __ix32 i = 0 ; i < N ; i++ )
     {
-        bx[i].allocate( 4 );
-        by[i].allocate( 3 );
+        new ( &bx[i] ) mirror_ring_buffer<T>();
+        new ( &by[i] ) mirror_ring_buffer<T>();
+        bx[i].attach( &state[ 14 * i + 0 ] , 4 );
+        by[i].attach( &state[ 14 * i + 8 ] , 3 );
     }
 
-    return iir_bf< T >{ bx , by , N };
+    // coefficients moving:
+    memcpy( cfnum , cf.cfnum , 3 * N * sizeof ( T ) );
+    memcpy( cfden , cf.cfden , 3 * N * sizeof ( T ) );
+    memcpy( gains , cf.gains , ( N + 1 ) * sizeof ( T ) );
+    free( cf.cfnum );
+    free( cf.cfden );
+    free( cf.gains );
+    cf.cfnum = cfnum;
+    cf.cfden = cfden;
+    cf.gains = gains;
+
+    return iir_bf< T >{ bx , by , N , arena };
 }
 
 /*!
  * \brief     IIR filter input/output buffers memory deallocation function
  * \param[bf] IIR filer input/output buffers data structure
- * \return    The function deallocates memory for IIR filter input/output buffers
+ * \param[cf] IIR filer coefficients data structure that refers to the arena
+ * \return    The function deallocates the IIR filter memory arena and resets the coefficients data structure
 */
 
-template< typename T > iir_bf<T> __iir_bf_free__( iir_bf<T> bf )
+template< typename T > iir_bf<T> __iir_bf_free__( iir_bf<T> bf , iir_cf<T> &cf )
 {
-    mirror_ring_buffer<T> *bx = bf.bx , *by = bf.by;
-    __ix32 N = bf.N;
-
-    if( bx != 0 )
+    if( bf.arena != 0 )
     {
-        for( __ix32 i = 0 ; i < N ; i++ ) bx[i].deallocate();
-        delete[] bx;
-        bx = 0;
-    }
-
-    if( by != 0 )
-    {
-        for( __ix32 i = 0 ; i < N ; i++ ) by[i].deallocate();
-        delete[] by;
-        by = 0;
+        for( __ix32 i = 0 ; i < bf.N ; i++ )
+        {
+            bf.bx[i].~mirror_ring_buffer<T>();
+            bf.by[i].~mirror_ring_buffer<T>();
+        }
+        free( bf.arena );
+        cf = iir_cf< T >{ 0 , 0 , 0 , -1 , -1 , -1 };
     }
 
-    return { bx , by , -1 };
+    return iir_bf< T >{ 0 , 0 , -1 , 0 };
 }
 
 /*!
@@ -1608,6 +1642,100 @@ template< typename T > iir_cf< T > __iir_cf_free__( iir_cf< T > cf )
     return { 0 , 0 , 0 , -1 , -1 , -1 };
 }
 
+/*!
+ * \brief       IIR filter state saving function
+ * \param[blob] pointer to the state memory block or null pointer to compute the state size only
+ * \param[name] IIR filter class name
+ * \param[sp  ] IIR filter specification data structure
+ * \param[cf  ] IIR filter coefficients data structure
+ * \param[bf  ] IIR filter input/output buffers data structure
+ * \param[out ] IIR filter output
+ * \return      The function stores the IIR filter specification , coefficients , second order sections buffers and output
+ *              into the state memory block and returns the state size , bytes. The function returns 0 if the filter is not allocated.
+*/
+
+template< typename T > __ix32 __iir_save__( char *blob , const char *name , iir_sp &sp , iir_cf< T > &cf , iir_bf< T > &bf , T &out )
+{
+    __ix32 pos = 0;
+    if( bf.arena == 0 ) return 0;
+
+    __state_begin__( blob , pos , name );
+    __state_put__( blob , pos , &sp );
+    __state_put__( blob , pos , &cf.L );
+    __state_put__( blob , pos , &cf.R );
+    __state_put__( blob , pos , &cf.N );
+    __state_put__( blob , pos , cf.cfnum , 3 * cf.N );
+    __state_put__( blob , pos , cf.cfden , 3 * cf.N );
+    __state_put__( blob , pos , cf.gains , cf.N + 1 );
+    for( __ix32 i = 0 ; i < bf.N ; i++ )
+    {
+        __buff_put__( blob , pos , bf.bx[i] );
+        __buff_put__( blob , pos , bf.by[i] );
+    }
+    __state_put__( blob , pos , &out );
+
+    return __state_end__( blob , pos );
+}
+
+/*!
+ * \brief       IIR filter state loading function
+ * \param[blob] pointer to the state memory block
+ * \param[size] available memory size , bytes
+ * \param[name] IIR filter class name
+ * \param[sp  ] IIR filter specification data structure
+ * \param[cf  ] IIR filter coefficients data structure
+ * \param[bf  ] IIR filter input/output buffers data structure
+ * \param[out ] IIR filter output
+ * \return      The function restores the filter specification and coefficients without the filter redesign , allocates
+ *              the filter buffers and restores their history. The function returns the number of the bytes read or 0 if
+ *              the state can not be restored. The filter is not changed if the state is not valid.
+*/
+
+template< typename T > __ix32 __iir_load__( const char *blob , __ix32 size , const char *name , iir_sp &sp , iir_cf< T > &cf , iir_bf< T > &bf , T &out )
+{
+    __ix32 pos = 0 , end = __state_open__( blob , size , pos , name ) , L = 0 , R = 0 , N = 0 , ok = 0;
+    iir_sp sp2;
+    T      out2 = 0;
+    if( end == 0 ) return 0;
+
+    if( !__state_get__( blob , end , pos , &sp2 ) || !__state_get__( blob , end , pos , &L ) ||
+        !__state_get__( blob , end , pos , &R   ) || !__state_get__( blob , end , pos , &N ) ) return 0;
+    if( N <= 0 || L < 0 || R < 0 || N > end / ( 7 * ( __ix32 )sizeof ( T ) ) ) return 0; // the coefficients must fit the block
+
+    // the state is restored into the temporaries , that replace the filter data structures only on success:
+    T *cfnum = ( T* )calloc( 3 * N , sizeof ( T ) );
+    T *cfden = ( T* )calloc( 3 * N , sizeof ( T ) );
+    T *gains = ( T* )calloc( N + 1 , sizeof ( T ) );
+    iir_cf< T > cf2 = { cfnum , cfden , gains , L , R , N };
+    iir_bf< T > bf2 = { 0 , 0 , -1 , 0 };
+    ok = cfnum && cfden && gains &&
+         __state_get__( blob , end , pos , cfnum , 3 * N ) &&
+         __state_get__( blob , end , pos , cfden , 3 * N ) &&
+         __state_get__( blob , end , pos , gains , N + 1 );
+    if( ok ) bf2 = __iir_bf_alloc__< T >( cf2 );
+    if( bf2.arena == 0 )
+    {
+        __iir_cf_free__< T >( cf2 );
+        return 0;
+    }
+
+    for( __ix32 i = 0 ; ok && i < N ; i++ ) ok = __buff_get__( blob , end , pos , bf2.bx[i] ) && __buff_get__( blob , end , pos , bf2.by[i] );
+    ok = ok && __state_get__( blob , end , pos , &out2 ) && ( pos == end );
+    if( !ok )
+    {
+        __iir_bf_free__< T >( bf2 , cf2 );
+        return 0;
+    }
+
+    bf  = __iir_bf_free__< T >( bf , cf );
+    cf  = __iir_cf_free__< T >( cf );
+    sp  = sp2;
+    cf  = cf2;
+    bf  = bf2;
+    out = out2;
+    return end;
+}
+
 /*!
  * \brief     IIR filter template filtering function
  * \param[input  ] - input samples
@@ -1874,7 +2002,7 @@ public:
             break;
         }
 
-        m_bf = ( ( m_cf.cfnum != 0 ) && ( m_cf.cfden != 0 ) && ( m_cf.gains != 0 ) ) ? __iir_bf_alloc__< __type >( m_cf.N ) : iir_bf< __type >{ 0 , 0 , -1 } ;
+        m_bf = ( ( m_cf.cfnum != 0 ) && ( m_cf.cfden != 0 ) && ( m_cf.gains != 0 ) ) ? __iir_bf_alloc__< __type >( m_cf ) : iir_bf< __type >{ 0 , 0 , -1 , 0 } ;
         return ( m_bf.bx != 0 && m_bf.by != 0 );
     }
 
@@ -1883,7 +2011,7 @@ public:
     */
     void deallocate()
     {
-        m_bf = __iir_bf_free__< __type >( m_bf );
+        m_bf = __iir_bf_free__< __type >( m_bf , m_cf );
         m_cf = __iir_cf_free__< __type >( m_cf );
     }
 
@@ -1891,7 +2019,7 @@ public:
     butterworth()
     {
         m_cf = iir_cf<__type>{ 0 , 0 , 0 , -1 , -1 , -1 };
-        m_bf = iir_bf<__type>{ 0 , 0 , -1 };
+        m_bf = iir_bf<__type>{ 0 , 0 , -1 , 0 };
         m_sp = iir_sp        { 4000 , 1 / 4000 , 50 , 100 , -1 , 1 , -1 , 4 , 0 };
     }
 
@@ -1905,6 +2033,21 @@ public:
     */
     __type filt( __type *input ) { return ( m_out = __filt__< __type >( input , m_cf.cfnum , m_cf.cfden , m_cf.gains , m_cf.N , m_bf.bx , m_bf.by ) ); }
 
+    /*! \brief  IIR filter state saving function
+     *  \param[blob] - pointer to the state memory block or null pointer to compute the state size only
+     *  \return The function stores the filter specification , coefficients , buffers and output into the state memory block
+     *          and returns the state size , bytes.
+    */
+    __ix32 save_state( void *blob ) { return __iir_save__< __type >( ( char* )blob , "butterworth<fx32>" , m_sp , m_cf , m_bf , m_out ); }
+
+    /*! \brief  IIR filter state loading function
+     *  \param[blob] - pointer to the state memory block
+     *  \param[size] - available memory size , bytes
+     *  \return The function restores the filter without the filter redesign and returns the number of the bytes read
+     *          or 0 if the state can not be restored. The filter is not changed if the state is not valid.
+    */
+    __ix32 load_state( const void *blob , __ix32 size ) { return __iir_load__< __type >( ( const char* )blob , size , "butterworth<fx32>" , m_sp , m_cf , m_bf , m_out ); }
+
     /*! \brief  Butterworth IIR filter filtering operator
      *  \param[input] - input samples
      *  \return The operator calls function that implements input samples filtering using Butterworth IIR filter second order sections coefficients and gains.
@@ -2012,7 +2155,7 @@ public:
             break;
         }
 
-        m_bf = ( ( m_cf.cfnum != 0 ) && ( m_cf.cfden != 0 ) && ( m_cf.gains != 0 ) ) ? __iir_bf_alloc__< __type >( m_cf.N ) : iir_bf< __type >{ 0 , 0 , -1 } ;
+        m_bf = ( ( m_cf.cfnum != 0 ) && ( m_cf.cfden != 0 ) && ( m_cf.gains != 0 ) ) ? __iir_bf_alloc__< __type >( m_cf ) : iir_bf< __type >{ 0 , 0 , -1 , 0 } ;
         return ( m_bf.bx != 0 && m_bf.by != 0 );
     }
 
@@ -2021,7 +2164,7 @@ public:
     */
     void deallocate()
     {
-        m_bf = __iir_bf_free__< __type >( m_bf );
+        m_bf = __iir_bf_free__< __type >( m_bf , m_cf );
         m_cf = __iir_cf_free__< __type >( m_cf );
     }
 
@@ -2029,7 +2172,7 @@ public:
     butterworth()
     {
         m_cf = iir_cf<__type>{ 0 , 0 , 0 , -1 , -1 , -1 };
-        m_bf = iir_bf<__type>{ 0 , 0 , -1 };
+        m_bf = iir_bf<__type>{ 0 , 0 , -1 , 0 };
         m_sp = iir_sp        { 4000 , 1 / 4000 , 50 , 100 , -1 , 1 , -1 , 4 , 0 };
     }
 
@@ -2043,6 +2186,21 @@ public:
     */
     __type filt( __type *input ) { return ( m_out = __filt__< __type >( input , m_cf.cfnum , m_cf.cfden , m_cf.gains , m_cf.N , m_bf.bx , m_bf.by ) ); }
 
+    /*! \brief  IIR filter state saving function
+     *  \param[blob] - pointer to the state memory block or null pointer to compute the state size only
+     *  \return The function stores the filter specification , coefficients , buffers and output into the state memory block
+     *          and returns the state size , bytes.
+    */
+    __ix32 save_state( void *blob ) { return __iir_save__< __type >( ( char* )blob , "butterworth<fx64>" , m_sp , m_cf , m_bf , m_out ); }
+
+    /*! \brief  IIR filter state loading function
+     *  \param[blob] - pointer to the state memory block
+     *  \param[size] - available memory size , bytes
+     *  \return The function restores the filter without the filter redesign and returns the number of the bytes read
+     *          or 0 if the state can not be restored. The filter is not changed if the state is not valid.
+    */
+    __ix32 load_state( const void *blob , __ix32 size ) { return __iir_load__< __type >( ( const char* )blob , size , "butterworth<fx64>" , m_sp , m_cf , m_bf , m_out ); }
+
     /*! \brief  Butterworth IIR filter filtering operator
      *  \param[input] - input samples
      *  \return The operator calls function that implements input samples filtering using Butterworth IIR filter second order sections coefficients and gains.
@@ -2149,7 +2307,7 @@ public:
             break;
         }
 
-        m_bf = ( ( m_cf.cfnum != 0 ) && ( m_cf.cfden != 0 ) && ( m_cf.gains != 0 ) ) ? __iir_bf_alloc__< __type >( m_cf.N ) : iir_bf< __type >{ 0 , 0 , -1 } ;
+        m_bf = ( ( m_cf.cfnum != 0 ) && ( m_cf.cfden != 0 ) && ( m_cf.gains != 0 ) ) ? __iir_bf_alloc__< __type >( m_cf ) : iir_bf< __type >{ 0 , 0 , -1 , 0 } ;
         return ( m_bf.bx != 0 && m_bf.by != 0 );
     }
 
@@ -2158,7 +2316,7 @@ public:
     */
     void deallocate()
     {
-        m_bf = __iir_bf_free__< __type >( m_bf );
+        m_bf = __iir_bf_free__< __type >( m_bf , m_cf );
         m_cf = __iir_cf_free__< __type >( m_cf );
     }
 
@@ -2166,7 +2324,7 @@ public:
     chebyshev_1()
     {
         m_cf = iir_cf< __type >{ 0 , 0 , 0 , -1 , -1 , -1 };
-        m_bf = iir_bf< __type >{ 0 , 0 , -1 };
+        m_bf = iir_bf< __type >{ 0 , 0 , -1 , 0 };
         m_sp = iir_sp          { 4000 , 1 / 4000 , 50 , 100 , -1 , 1 , -1 , 4 , 0 };
     }
 
@@ -2180,6 +2338,21 @@ public:
     */
     __type filt( __type *input ) { return ( m_out = __filt__< __type >( input , m_cf.cfnum , m_cf.cfden , m_cf.gains , m_cf.N , m_bf.bx , m_bf.by ) ); }
 
+    /*! \brief  IIR filter state saving function
+     *  \param[blob] - pointer to the state memory block or null pointer to compute the state size only
+     *  \return The function stores the filter specification , coefficients , buffers and output into the state memory block
+     *          and returns the state size , bytes.
+    */
+    __ix32 save_state( void *blob ) { return __iir_save__< __type >( ( char* )blob , "chebyshev_1<fx32>" , m_sp , m_cf , m_bf , m_out ); }
+
+    /*! \brief  IIR filter state loading function
+     *  \param[blob] - pointer to the state memory block
+     *  \param[size] - available memory size , bytes
+     *  \return The function restores the filter without the filter redesign and returns the number of the bytes read
+     *          or 0 if the state can not be restored. The filter is not changed if the state is not valid.
+    */
+    __ix32 load_state( const void *blob , __ix32 size ) { return __iir_load__< __type >( ( const char* )blob , size , "chebyshev_1<fx32>" , m_sp , m_cf , m_bf , m_out ); }
+
     /*! \brief  Chebyshev I IIR filter filtering operator
      *  \param[input] - input samples
      *  \return The operator calls function that implements input samples filtering using Chebyshev I filter second order sections coefficients and gains.
@@ -2286,7 +2459,7 @@ public:
             break;
         }
 
-        m_bf = ( ( m_cf.cfnum != 0 ) && ( m_cf.cfden != 0 ) && ( m_cf.gains != 0 ) ) ? __iir_bf_alloc__< __type >( m_cf.N ) : iir_bf< __type >{ 0 , 0 , -1 } ;
+        m_bf = ( ( m_cf.cfnum != 0 ) && ( m_cf.cfden != 0 ) && ( m_cf.gains != 0 ) ) ? __iir_bf_alloc__< __type >( m_cf ) : iir_bf< __type >{ 0 , 0 , -1 , 0 } ;
         return ( m_bf.bx != 0 && m_bf.by != 0 );
     }
 
@@ -2295,7 +2468,7 @@ public:
     */
     void deallocate()
     {
-        m_bf = __iir_bf_free__< __type >( m_bf );
+        m_bf = __iir_bf_free__< __type >( m_bf , m_cf );
         m_cf = __iir_cf_free__< __type >( m_cf );
     }
 
@@ -2303,7 +2476,7 @@ public:
     chebyshev_1()
     {
         m_cf = iir_cf< __type >{ 0 , 0 , 0 , -1 , -1 , -1 };
-        m_bf = iir_bf< __type >{ 0 , 0 , -1 };
+        m_bf = iir_bf< __type >{ 0 , 0 , -1 , 0 };
         m_sp = iir_sp          { 4000 , 1 / 4000 , 50 , 100 , -1 , 1 , -1 , 4 , 0 };
     }
 
@@ -2317,6 +2490,21 @@ public:
     */
     __type filt( __type *input ) { return ( m_out = __filt__< __type >( input , m_cf.cfnum , m_cf.cfden , m_cf.gains , m_cf.N , m_bf.bx , m_bf.by ) ); }
 
+    /*! \brief  IIR filter state saving function
+     *  \param[blob] - pointer to the state memory block or null pointer to compute the state size only
+     *  \return The function stores the filter specification , coefficients , buffers and output into the state memory block
+     *          and returns the state size , bytes.
+    */
+    __ix32 save_state( void *blob ) { return __iir_save__< __type >( ( char* )blob , "chebyshev_1<fx64>" , m_sp , m_cf , m_bf , m_out ); }
+
+    /*! \brief  IIR filter state loading function
+     *  \param[blob] - pointer to the state memory block
+     *  \param[size] - available memory size , bytes
+     *  \return The function restores the filter without the filter redesign and returns the number of the bytes read
+     *          or 0 if the state can not be restored. The filter is not changed if the state is not valid.
+    */
+    __ix32 load_state( const void *blob , __ix32 size ) { return __iir_load__< __type >( ( const char* )blob , size , "chebyshev_1<fx64>" , m_sp , m_cf , m_bf , m_out ); }
+
     /*! \brief  Chebyshev I IIR filter filtering operator
      *  \param[input] - input samples
      *  \return The operator calls function that implements input samples filtering using Chebyshev I filter second order sections coefficients and gains.
@@ -2419,7 +2607,7 @@ public:
             break;
         }
 
-        m_bf = ( ( m_cf.cfnum != 0 ) && ( m_cf.cfden != 0 ) && ( m_cf.gains != 0 ) ) ? __iir_bf_alloc__< __type >( m_cf.N ) : iir_bf< __type >{ 0 , 0 , -1 } ;
+        m_bf = ( ( m_cf.cfnum != 0 ) && ( m_cf.cfden != 0 ) && ( m_cf.gains != 0 ) ) ? __iir_bf_alloc__< __type >( m_cf ) : iir_bf< __type >{ 0 , 0 , -1 , 0 } ;
         return ( m_bf.bx != 0 && m_bf.by != 0 );
     }
 
@@ -2428,7 +2616,7 @@ public:
     */
     void deallocate()
     {
-        m_bf = __iir_bf_free__< __type >( m_bf );
+        m_bf = __iir_bf_free__< __type >( m_bf , m_cf );
         m_cf = __iir_cf_free__< __type >( m_cf );
     }
 
@@ -2436,7 +2624,7 @@ public:
     chebyshev_2()
     {
         m_cf = iir_cf< __type > { 0 , 0 , 0 , -1 , -1 , -1 };
-        m_bf = iir_bf< __type > { 0 , 0 , -1 };
+        m_bf = iir_bf< __type > { 0 , 0 , -1 , 0 };
         m_sp = iir_sp           { 4000 , 1 / 4000 , 50 , 100 , -1 , 1 , 80 , 4 , 0 };
     }
 
@@ -2450,6 +2638,21 @@ public:
     */
     __type filt( __type *input ) { return ( m_out = __filt__< __type >( input , m_cf.cfnum , m_cf.cfden , m_cf.gains , m_cf.N , m_bf.bx , m_bf.by ) ); }
 
+    /*! \brief  IIR filter state saving function
+     *  \param[blob] - pointer to the state memory block or null pointer to compute the state size only
+     *  \return The function stores the filter specification , coefficients , buffers and output into the state memory block
+     *          and returns the state size , bytes.
+    */
+    __ix32 save_state( void *blob ) { return __iir_save__< __type >( ( char* )blob , "chebyshev_2<fx32>" , m_sp , m_cf , m_bf , m_out ); }
+
+    /*! \brief  IIR filter state loading function
+     *  \param[blob] - pointer to the state memory block
+     *  \param[size] - available memory size , bytes
+     *  \return The function restores the filter without the filter redesign and returns the number of the bytes read
+     *          or 0 if the state can not be restored. The filter is not changed if the state is not valid.
+    */
+    __ix32 load_state( const void *blob , __ix32 size ) { return __iir_load__< __type >( ( const char* )blob , size , "chebyshev_2<fx32>" , m_sp , m_cf , m_bf , m_out ); }
+
     /*! \brief  Chebyshev II IIR filter filtering operator
      *  \param[input] - input samples
      *  \return The operator calls function that implements input samples filtering using Butterworth IIR filter second order sections coefficients and gains.
@@ -2552,7 +2755,7 @@ public:
             break;
         }
 
-        m_bf = ( ( m_cf.cfnum != 0 ) && ( m_cf.cfden != 0 ) && ( m_cf.gains != 0 ) ) ? __iir_bf_alloc__< __type >( m_cf.N ) : iir_bf< __type >{ 0 , 0 , -1 } ;
+        m_bf = ( ( m_cf.cfnum != 0 ) && ( m_cf.cfden != 0 ) && ( m_cf.gains != 0 ) ) ? __iir_bf_alloc__< __type >( m_cf ) : iir_bf< __type >{ 0 , 0 , -1 , 0 } ;
         return ( m_bf.bx != 0 && m_bf.by != 0 );
     }
 
@@ -2561,7 +2764,7 @@ public:
     */
     void deallocate()
     {
-        m_bf = __iir_bf_free__< __type >( m_bf );
+        m_bf = __iir_bf_free__< __type >( m_bf , m_cf );
         m_cf = __iir_cf_free__< __type >( m_cf );
     }
 
@@ -2569,7 +2772,7 @@ public:
     chebyshev_2()
     {
         m_cf = iir_cf< __type > { 0 , 0 , 0 , -1 , -1 , -1 };
-        m_bf = iir_bf< __type > { 0 , 0 , -1 };
+        m_bf = iir_bf< __type > { 0 , 0 , -1 , 0 };
         m_sp = iir_sp           { 4000 , 1 / 4000 , 50 , 100 , -1 , 1 , 80 , 4 , 0 };
     }
 
@@ -2583,6 +2786,21 @@ public:
     */
     __type filt( __type *input ) { return ( m_out = __filt__< __type >( input , m_cf.cfnum , m_cf.cfden , m_cf.gains , m_cf.N , m_bf.bx , m_bf.by ) ); }
 
+    /*! \brief  IIR filter state saving function
+     *  \param[blob] - pointer to the state memory block or null pointer to compute the state size only
+     *  \return The function stores the filter specification , coefficients , buffers and output into the state memory block
+     *          and returns the state size , bytes.
+    */
+    __ix32 save_state( void *blob ) { return __iir_save__< __type >( ( char* )blob , "chebyshev_2<fx64>" , m_sp , m_cf , m_bf , m_out ); }
+
+    /*! \brief  IIR filter state loading function
+     *  \param[blob] - pointer to the state memory block
+     *  \param[size] - available memory size , bytes
+     *  \return The function restores the filter without the filter redesign and returns the number of the bytes read
+     *          or 0 if the state can not be restored. The filter is not changed if the state is not valid.
+    */
+    __ix32 load_state( const void *blob , __ix32 size ) { return __iir_load__< __type >( ( const char* )blob , size , "chebyshev_2<fx64>" , m_sp , m_cf , m_bf , m_out ); }
+
     /*! \brief  Chebyshev II IIR filter filtering operator
      *  \param[input] - input samples
      *  \return The operator calls function that implements input samples filtering using Butterworth IIR filter second order sections coefficients and gains.
@@ -2689,7 +2907,7 @@ public:
             break;
         }
 
-        m_bf = ( ( m_cf.cfnum != 0 ) && ( m_cf.cfden != 0 ) && ( m_cf.gains != 0 ) ) ? __iir_bf_alloc__< __type >( m_cf.N ) : iir_bf< __type >{ 0 , 0 , -1 } ;
+        m_bf = ( ( m_cf.cfnum != 0 ) && ( m_cf.cfden != 0 ) && ( m_cf.gains != 0 ) ) ? __iir_bf_alloc__< __type >( m_cf ) : iir_bf< __type >{ 0 , 0 , -1 , 0 } ;
         return ( m_bf.bx != 0 && m_bf.by != 0 );
     }
 
@@ -2698,7 +2916,7 @@ public:
     */
     void deallocate()
     {
-        m_bf = __iir_bf_free__< __type >( m_bf );
+        m_bf = __iir_bf_free__< __type >( m_bf , m_cf );
         m_cf = __iir_cf_free__< __type >( m_cf );
     }
 
@@ -2706,7 +2924,7 @@ public:
     elliptic()
     {
         m_cf = iir_cf< __type >{ 0 , 0 , 0 , -1 , -1 , -1 };
-        m_bf = iir_bf< __type >{ 0 , 0 , -1 };
+        m_bf = iir_bf< __type >{ 0 , 0 , -1 , 0 };
         m_sp = iir_sp          { 4000 , 1 / 4000 , 50 , 100 , -1 , 1 , 80 , 4 , 0 };
     }
 
@@ -2720,6 +2938,21 @@ public:
     */
     __type filt( __type *input ) { return ( m_out = __filt__< __type >( input , m_cf.cfnum , m_cf.cfden , m_cf.gains , m_cf.N , m_bf.bx , m_bf.by ) ); }
 
+    /*! \brief  IIR filter state saving function
+     *  \param[blob] - pointer to the state memory block or null pointer to compute the state size only
+     *  \return The function stores the filter specification , coefficients , buffers and output into the state memory block
+     *          and returns the state size , bytes.
+    */
+    __ix32 save_state( void *blob ) { return __iir_save__< __type >( ( char* )blob , "elliptic<fx32>" , m_sp , m_cf , m_bf , m_out ); }
+
+    /*! \brief  IIR filter state loading function
+     *  \param[blob] - pointer to the state memory block
+     *  \param[size] - available memory size , bytes
+     *  \return The function restores the filter without the filter redesign and returns the number of the bytes read
+     *          or 0 if the state can not be restored. The filter is not changed if the state is not valid.
+    */
+    __ix32 load_state( const void *blob , __ix32 size ) { return __iir_load__< __type >( ( const char* )blob , size , "elliptic<fx32>" , m_sp , m_cf , m_bf , m_out ); }
+
     /*! \brief  Elliptic IIR filter filtering operator
      *  \param[input] - input samples
      *  \return The operator calls function that implements input samples filtering using Elliptic IIR filter second order sections coefficients and gains.
@@ -2827,7 +3060,7 @@ public:
             break;
         }
 
-        m_bf = ( ( m_cf.cfnum != 0 ) && ( m_cf.cfden != 0 ) && ( m_cf.gains != 0 ) ) ? __iir_bf_alloc__< __type >( m_cf.N ) : iir_bf< __type >{ 0 , 0 , -1 } ;
+        m_bf = ( ( m_cf.cfnum != 0 ) && ( m_cf.cfden != 0 ) && ( m_cf.gains != 0 ) ) ? __iir_bf_alloc__< __type >( m_cf ) : iir_bf< __type >{ 0 , 0 , -1 , 0 } ;
         return ( m_bf.bx != 0 && m_bf.by != 0 );
     }
 
@@ -2836,7 +3069,7 @@ public:
     */
     void deallocate()
     {
-        m_bf = __iir_bf_free__< __type >( m_bf );
+        m_bf = __iir_bf_free__< __type >( m_bf , m_cf );
         m_cf = __iir_cf_free__< __type >( m_cf );
     }
 
@@ -2844,7 +3077,7 @@ public:
     elliptic()
     {
         m_cf = iir_cf< __type >{ 0 , 0 , 0 , -1 , -1 , -1 };
-        m_bf = iir_bf< __type >{ 0 , 0 , -1 };
+        m_bf = iir_bf< __type >{ 0 , 0 , -1 , 0 };
         m_sp = iir_sp          { 4000 , 1 / 4000 , 50 , 100 , -1 , 1 , 80 , 4 , 0 };
     }
 
@@ -2858,6 +3091,21 @@ public:
     */
     __type filt( __type *input ) { return ( m_out = __filt__< __type >( input , m_cf.cfnum , m_cf.cfden , m_cf.gains , m_cf.N , m_bf.bx , m_bf.by ) ); }
 
+    /*! \brief  IIR filter state saving function
+     *  \param[blob] - pointer to the state memory block or null pointer to compute the state size only
+     *  \return The function stores the filter specification , coefficients , buffers and output into the state memory block
+     *          and returns the state size , bytes.
+    */
+    __ix32 save_state( void *blob ) { return __iir_save__< __type >( ( char* )blob , "elliptic<fx64>" , m_sp , m_cf , m_bf , m_out ); }
+
+    /*! \brief  IIR filter state loading function
+     *  \param[blob] - pointer to the state memory block
+     *  \param[size] - available memory size , bytes
+     *  \return The function restores the filter without the filter redesign and returns the number of the bytes read
+     *          or 0 if the state can not be restored. The filter is not changed if the state is not valid.
+    */
+    __ix32 load_state( const void *blob , __ix32 size ) { return __iir_load__< __type >( ( const char* )blob , size , "elliptic<fx64>" , m_sp , m_cf , m_bf , m_out ); }
+
     /*! \brief  Elliptic IIR filter filtering operator
      *  \param[input] - input samples
      *  \return The operator calls function that implements input samples filtering using Elliptic IIR filter second order sections coefficients and gains.
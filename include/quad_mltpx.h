@@ -117,19 +117,26 @@ private:
     __type *m_ref_sin;
 
     /*! \brief input signal real component buffer */
-    mirror_ring_buffer<__type> m_buff_re;
+    mirror_ring_buffer< __type , __DELAY_LINE_CAPACITY > m_buff_re;
     /*! \brief input signal imaginary component buffer */
-    mirror_ring_buffer<__type> m_buff_im;
+    mirror_ring_buffer< __type , __DELAY_LINE_CAPACITY > m_buff_im;
 
     /*! \brief comb filter */
     fcomb<__type> m_apfilt;
-    /*! \brief fir filter to extract input signal real component */
-    fir<__type> m_fir_re;
-    /*! \brief fir filter to extract input signal imaginary component */
-    fir<__type> m_fir_im;
+    /*! \brief decimating fir filter to extract input signal real component ( one output per cycle ) */
+    fir_decimator<__type> m_fir_re;
+    /*! \brief decimating fir filter to extract input signal imaginary component ( one output per cycle ) */
+    fir_decimator<__type> m_fir_im;
     /*! \brief fir filter to smooth the input signal frequency slip */
     fir<__type> m_fir_df;
 
+    /*! \brief input signal buffer for inter channel skew compensation */
+    mirror_ring_buffer< __type , __DELAY_LINE_CAPACITY > m_buff_skew;
+    /*! \brief inter channel skew compensation fractional delay reader */
+    frac_delay< __type > m_skew;
+    /*! \brief inter channel skew compensation flag */
+    __ix32 m_skew_on;
+
     /*! \brief auxiliary vector */
     complex< __type > m_vector1;
     /*! \brief auxiliary vector */
@@ -173,8 +180,8 @@ public:
         m_apfilt.init( m_Fs , m_Fn );
 
         // ortohonal components filters initialization:
-        m_fir_re.lp_init (m_Fs , m_Fn , 0.1 , FiltWindowWidth , true);
-        m_fir_im.lp_init (m_Fs , m_Fn , 0.1 , FiltWindowWidth , true);
+        m_fir_re.init (m_Fs , m_Fn , 0.1 , FiltWindowWidth , m_HBuffSize , true);
+        m_fir_im.init (m_Fs , m_Fn , 0.1 , FiltWindowWidth , m_HBuffSize , true);
         m_fir_re.m_wind.Chebyshev(SideLobeAtten);
         m_fir_im.m_wind.Chebyshev(SideLobeAtten);
 
@@ -200,6 +207,28 @@ public:
         // reference frame:
         m_ref_cos = nullptr;
         m_ref_sin = nullptr;
+
+        // inter channel skew compensation is disabled by default:
+        m_skew_on = 0;
+    }
+
+    /*!
+     *  \brief inter channel skew compensation initialization function
+     *  \param[delay] - inter channel delay , s
+     *  \details The input signal is delayed by the fractional number of samples by means of Lagrange interpolation
+     *           before any filtering , so the channels are time-aligned in the sample domain. Unlike the output phasor
+     *           rotation the alignment remains correct off nominal frequency. Zero intChanDelay must be passed to
+     *           the filtering function then.
+     *           The delay must lie within one nominal frequency period: 0 <= delay <= 1 / Fn.
+     *  \return The function returns 1 if the skew compensation buffer is allocated and 0 otherwise.
+     *          A negative , NaN or too long delay is rejected and the current skew compensation is kept.
+    */
+    __ix32 set_skew( __fx64 delay )
+    {
+        if( !( delay >= 0 && delay <= 1 / m_Fn ) ) return 0;
+        m_buff_skew.deallocate();
+        m_skew.init( delay * m_Fs );
+        return ( m_skew_on = m_buff_skew.allocate( m_skew.size() ) );
     }
 
     /*! \brief default constructor */
@@ -273,10 +302,11 @@ public:
         // filters and buffers memory deallocation:
         m_apfilt .deallocate();
         m_fir_re .deallocate();
-        m_fir_re .deallocate();
+        m_fir_im .deallocate();
         m_fir_df .deallocate();
         m_buff_re.deallocate();
-        m_buff_re.deallocate();
+        m_buff_im.deallocate();
+        m_buff_skew.deallocate();
 
         // reference frame and output memory deallocation:
         if( m_ref_cos != nullptr ) { free( m_ref_cos ); m_ref_cos = nullptr; }
@@ -288,6 +318,117 @@ public:
     /*! \brief default destructor */
     ~quad_mltpx() { deallocate(); }
 
+    /*!
+     *  \brief state saving function
+     *  \param[blob] - pointer to the state memory block or null pointer to compute the state size only
+     *  \return The function stores the parameters , reference frames , buffers , nested filters states and outputs
+     *          into the state memory block and returns the state size , bytes. The function returns 0 if the filter is not allocated.
+    */
+    __ix32 save_state( void *blob )
+    {
+        char  *data = ( char* )blob;
+        __ix32 pos = 0 , size = 0;
+        if( m_ref_cos == nullptr || m_ref_sin == nullptr ) return 0;
+        __state_begin__( data , pos , "quad_mltpx<fx32>" );
+
+        __fx64 params[] = { m_Fs , m_Ts , m_Fn };
+        __ix32 counts[] = { m_HBuffSize , m_SamplesPerPeriod , m_cnt , m_ElemNum };
+        __type vars  [] = { m_a , m_b , m_K , m_Km , m_A1 , m_B1 , m_C1 , m_A2 , m_B2 , m_C2 , m_Re , m_Im , m_F , m_dF };
+        __state_put__( data , pos , params , 3  );
+        __state_put__( data , pos , counts , 4  );
+        __state_put__( data , pos , vars   , 14 );
+        __state_put__( data , pos , m_ref_cos , m_SamplesPerPeriod );
+        __state_put__( data , pos , m_ref_sin , m_SamplesPerPeriod );
+        __buff_put__ ( data , pos , m_buff_re );
+        __buff_put__ ( data , pos , m_buff_im );
+        __state_put__( data , pos , &m_skew_on );
+        __state_put__( data , pos , &m_skew );
+        __buff_put__ ( data , pos , m_buff_skew );
+
+        // nested filters states:
+        if( ( size = m_apfilt.save_state( data ? data + pos : 0 ) ) == 0 ) return 0; else pos += size;
+        if( ( size = m_fir_re.save_state( data ? data + pos : 0 ) ) == 0 ) return 0; else pos += size;
+        if( ( size = m_fir_im.save_state( data ? data + pos : 0 ) ) == 0 ) return 0; else pos += size;
+        if( ( size = m_fir_df.save_state( data ? data + pos : 0 ) ) == 0 ) return 0; else pos += size;
+
+        return __state_end__( data , pos );
+    }
+
+    /*!
+     *  \brief state loading function
+     *  \param[blob] - pointer to the state memory block
+     *  \param[size] - available memory size , bytes
+     *  \return The function restores the filter without the nested filters redesign and returns the number of the bytes read
+     *          or 0 if the state can not be restored. The filter is not changed if the state is not valid.
+    */
+    __ix32 load_state( const void *blob , __ix32 size )
+    {
+        const char *data = ( const char* )blob;
+        __ix32 pos = 0 , end = __state_open__( data , size , pos , "quad_mltpx<fx32>" ) , skew_on = 0 , nested = 0 , ok = 0;
+        __fx64 params[ 3 ];
+        __ix32 counts[ 4 ];
+        __type vars  [ 14 ];
+        frac_delay< __type > skew;
+        if( end == 0 ) return 0;
+
+        if( !__state_get__( data , end , pos , params , 3 ) || !__state_get__( data , end , pos , counts , 4 ) ||
+            !__state_get__( data , end , pos , vars , 14 ) ) return 0;
+        if( counts[0] < 0 || counts[1] <= 0 || counts[2] < 0 || counts[2] > counts[3] || counts[3] >= counts[1] ||
+            !__state_room__< __type >( end , pos , counts[1] ) ) return 0;
+
+        // the state is restored into the temporaries , that replace the filter members only on success:
+        mirror_ring_buffer< __type , __DELAY_LINE_CAPACITY > buff_re , buff_im , buff_skew;
+        __type *ref_cos = ( __type* )calloc( counts[1] , sizeof ( __type ) );
+        __type *ref_sin = ( __type* )calloc( counts[1] , sizeof ( __type ) );
+        ok = ref_cos != nullptr && ref_sin != nullptr && buff_re.allocate(2) && buff_im.allocate(2) &&
+             __state_get__( data , end , pos , ref_cos , counts[1] ) && __state_get__( data , end , pos , ref_sin , counts[1] ) &&
+             __buff_get__( data , end , pos , buff_re ) && __buff_get__( data , end , pos , buff_im ) &&
+             __state_get__( data , end , pos , &skew_on ) && __state_get__( data , end , pos , &skew ) &&
+             ( !skew_on || ( __state_room__< __type >( end , pos , skew.m_base ) && buff_skew.allocate( skew.size() ) ) ) &&
+             __buff_get__( data , end , pos , buff_skew );
+
+        // the nested filters states are validated by means of the temporary filters:
+        nested = pos;
+        fcomb< __type > apfilt;
+        fir_decimator< __type > fir_re , fir_im;
+        fir< __type > fir_df;
+        ok = ok && __state_nested__( apfilt , data , end , pos ) && __state_nested__( fir_re , data , end , pos ) &&
+             __state_nested__( fir_im , data , end , pos ) && __state_nested__( fir_df , data , end , pos ) && ( pos == end ) &&
+             ( fir_re.factor() == counts[0] && fir_im.factor() == counts[0] );
+        if( !ok )
+        {
+            free( ref_cos );
+            free( ref_sin );
+            return 0;
+        }
+
+        deallocate();
+        m_Fs = params[0]; m_Ts = params[1]; m_Fn = params[2];
+        m_HBuffSize = counts[0]; m_SamplesPerPeriod = counts[1]; m_cnt = counts[2]; m_ElemNum = counts[3];
+        m_a  = vars[0] ; m_b  = vars[1] ; m_K  = vars[2] ; m_Km = vars[3] ;
+        m_A1 = vars[4] ; m_B1 = vars[5] ; m_C1 = vars[6] ;
+        m_A2 = vars[7] ; m_B2 = vars[8] ; m_C2 = vars[9] ;
+        m_Re = vars[10]; m_Im = vars[11]; m_F  = vars[12]; m_dF = vars[13];
+        m_ref_cos = ref_cos;
+        m_ref_sin = ref_sin;
+        m_skew_on = skew_on;
+        m_skew    = skew;
+        m_buff_re  .swap( buff_re   );
+        m_buff_im  .swap( buff_im   );
+        m_buff_skew.swap( buff_skew );
+
+        // the validated nested states are loaded into the nested filters , only the memory allocation can fail here:
+        pos = nested;
+        if( !__state_nested__( m_apfilt , data , end , pos ) || !__state_nested__( m_fir_re , data , end , pos ) ||
+            !__state_nested__( m_fir_im , data , end , pos ) || !__state_nested__( m_fir_df , data , end , pos ) )
+        {
+            deallocate();
+            return 0;
+        }
+
+        return end;
+    }
+
     /*!
      *  \brief template filtering function
      *  \param[input        ] - pointer to the input signal frames
@@ -298,10 +439,19 @@ public:
     {
         for ( __ix32 n = 0 ; n < m_HBuffSize; n++)
         {
-            // aperiodic component filtering:
-            m_apfilt( &input[n] );
+            // inter channel skew compensation and aperiodic component filtering:
+            if( m_skew_on )
+            {
+                m_buff_skew( &input[n] );
+                __type x = m_skew( m_buff_skew );
+                m_apfilt( &x );
+            }
+            else
+            {
+                m_apfilt( &input[n] );
+            }
 
-            // quadrature multiplication and FIR filters buffers filling:
+            // quadrature multiplication and decimating FIR filters phases filling:
             m_fir_re.fill_fir_buff( &( m_a = m_ref_sin[m_cnt] * m_apfilt.m_out ) );
             m_fir_im.fill_fir_buff( &( m_b = m_ref_cos[m_cnt] * m_apfilt.m_out ) );
 
@@ -310,14 +460,21 @@ public:
             else m_cnt = 0;
         }
 
-        // filtering:
+        // filtering ( the cycle last sample completes the decimation cycle , so the output is computed once per cycle ):
         m_fir_re.filt();
         m_fir_im.filt();
 
-        // vector computation:
+        // vector computation ( the output phasor is rotated if the inter channel delay is compensated in the frequency domain ):
         m_vector1( m_fir_re.m_out , m_fir_im.m_out );
-        m_vector2( 1 , -PI2 * m_F * intChanDelay );
-        m_vector3 = m_vector1 * m_vector2;
+        if( intChanDelay != 0 )
+        {
+            m_vector2( 1 , -PI2 * m_F * intChanDelay );
+            m_vector3 = m_vector1 * m_vector2;
+        }
+        else
+        {
+            m_vector3 = m_vector1;
+        }
         m_Re      = m_vector3.m_re;
         m_Im      = m_vector3.m_im;
 
@@ -428,19 +585,26 @@ private:
     __type *m_ref_sin;
 
     /*! \brief input signal real component buffer */
-    mirror_ring_buffer<__type> m_buff_re;
+    mirror_ring_buffer< __type , __DELAY_LINE_CAPACITY > m_buff_re;
     /*! \brief input signal imaginary component buffer */
-    mirror_ring_buffer<__type> m_buff_im;
+    mirror_ring_buffer< __type , __DELAY_LINE_CAPACITY > m_buff_im;
 
     /*! \brief comb filter */
     fcomb<__type> m_apfilt;
-    /*! \brief fir filter to extract input signal real component */
-    fir<__type> m_fir_re;
-    /*! \brief fir filter to extract input signal imaginary component */
-    fir<__type> m_fir_im;
+    /*! \brief decimating fir filter to extract input signal real component ( one output per cycle ) */
+    fir_decimator<__type> m_fir_re;
+    /*! \brief decimating fir filter to extract input signal imaginary component ( one output per cycle ) */
+    fir_decimator<__type> m_fir_im;
     /*! \brief fir filter to smooth the input signal frequency slip */
     fir<__type> m_fir_df;
 
+    /*! \brief input signal buffer for inter channel skew compensation */
+    mirror_ring_buffer< __type , __DELAY_LINE_CAPACITY > m_buff_skew;
+    /*! \brief inter channel skew compensation fractional delay reader */
+    frac_delay< __type > m_skew;
+    /*! \brief inter channel skew compensation flag */
+    __ix32 m_skew_on;
+
     /*! \brief auxiliary vector */
     complex< __type > m_vector1;
     /*! \brief auxiliary vector */
@@ -484,8 +648,8 @@ public:
         m_apfilt.init( m_Fs , m_Fn );
 
         // ortohonal components filters initialization:
-        m_fir_re.lp_init (m_Fs , m_Fn , 0.1 , FiltWindowWidth , true);
-        m_fir_im.lp_init (m_Fs , m_Fn , 0.1 , FiltWindowWidth , true);
+        m_fir_re.init (m_Fs , m_Fn , 0.1 , FiltWindowWidth , m_HBuffSize , true);
+        m_fir_im.init (m_Fs , m_Fn , 0.1 , FiltWindowWidth , m_HBuffSize , true);
         m_fir_re.m_wind.Chebyshev(SideLobeAtten);
         m_fir_im.m_wind.Chebyshev(SideLobeAtten);
 
@@ -511,6 +675,28 @@ public:
         // reference frame:
         m_ref_cos = nullptr;
         m_ref_sin = nullptr;
+
+        // inter channel skew compensation is disabled by default:
+        m_skew_on = 0;
+    }
+
+    /*!
+     *  \brief inter channel skew compensation initialization function
+     *  \param[delay] - inter channel delay , s
+     *  \details The input signal is delayed by the fractional number of samples by means of Lagrange interpolation
+     *           before any filtering , so the channels are time-aligned in the sample domain. Unlike the output phasor
+     *           rotation the alignment remains correct off nominal frequency. Zero intChanDelay must be passed to
+     *           the filtering function then.
+     *           The delay must lie within one nominal frequency period: 0 <= delay <= 1 / Fn.
+     *  \return The function returns 1 if the skew compensation buffer is allocated and 0 otherwise.
+     *          A negative , NaN or too long delay is rejected and the current skew compensation is kept.
+    */
+    __ix32 set_skew( __fx64 delay )
+    {
+        if( !( delay >= 0 && delay <= 1 / m_Fn ) ) return 0;
+        m_buff_skew.deallocate();
+        m_skew.init( delay * m_Fs );
+        return ( m_skew_on = m_buff_skew.allocate( m_skew.size() ) );
     }
 
     /*! \brief default constructor */
@@ -584,10 +770,11 @@ public:
         // filters and buffers memory deallocation:
         m_apfilt .deallocate();
         m_fir_re .deallocate();
-        m_fir_re .deallocate();
+        m_fir_im .deallocate();
         m_fir_df .deallocate();
         m_buff_re.deallocate();
-        m_buff_re.deallocate();
+        m_buff_im.deallocate();
+        m_buff_skew.deallocate();
 
         // reference frame and output memory deallocation:
         if( m_ref_cos != nullptr ) { free( m_ref_cos ); m_ref_cos = nullptr; }
@@ -599,6 +786,117 @@ public:
     /*! \brief default destructor */
     ~quad_mltpx() { deallocate(); }
 
+    /*!
+     *  \brief state saving function
+     *  \param[blob] - pointer to the state memory block or null pointer to compute the state size only
+     *  \return The function stores the parameters , reference frames , buffers , nested filters states and outputs
+     *          into the state memory block and returns the state size , bytes. The function returns 0 if the filter is not allocated.
+    */
+    __ix32 save_state( void *blob )
+    {
+        char  *data = ( char* )blob;
+        __ix32 pos = 0 , size = 0;
+        if( m_ref_cos == nullptr || m_ref_sin == nullptr ) return 0;
+        __state_begin__( data , pos , "quad_mltpx<fx64>" );
+
+        __fx64 params[] = { m_Fs , m_Ts , m_Fn };
+        __ix32 counts[] = { m_HBuffSize , m_SamplesPerPeriod , m_cnt , m_ElemNum };
+        __type vars  [] = { m_a , m_b , m_K , m_Km , m_A1 , m_B1 , m_C1 , m_A2 , m_B2 , m_C2 , m_Re , m_Im , m_F , m_dF };
+        __state_put__( data , pos , params , 3  );
+        __state_put__( data , pos , counts , 4  );
+        __state_put__( data , pos , vars   , 14 );
+        __state_put__( data , pos , m_ref_cos , m_SamplesPerPeriod );
+        __state_put__( data , pos , m_ref_sin , m_SamplesPerPeriod );
+        __buff_put__ ( data , pos , m_buff_re );
+        __buff_put__ ( data , pos , m_buff_im );
+        __state_put__( data , pos , &m_skew_on );
+        __state_put__( data , pos , &m_skew );
+        __buff_put__ ( data , pos , m_buff_skew );
+
+        // nested filters states:
+        if( ( size = m_apfilt.save_state( data ? data + pos : 0 ) ) == 0 ) return 0; else pos += size;
+        if( ( size = m_fir_re.save_state( data ? data + pos : 0 ) ) == 0 ) return 0; else pos += size;
+        if( ( size = m_fir_im.save_state( data ? data + pos : 0 ) ) == 0 ) return 0; else pos += size;
+        if( ( size = m_fir_df.save_state( data ? data + pos : 0 ) ) == 0 ) return 0; else pos += size;
+
+        return __state_end__( data , pos );
+    }
+
+    /*!
+     *  \brief state loading function
+     *  \param[blob] - pointer to the state memory block
+     *  \param[size] - available memory size , bytes
+     *  \return The function restores the filter without the nested filters redesign and returns the number of the bytes read
+     *          or 0 if the state can not be restored. The filter is not changed if the state is not valid.
+    */
+    __ix32 load_state( const void *blob , __ix32 size )
+    {
+        const char *data = ( const char* )blob;
+        __ix32 pos = 0 , end = __state_open__( data , size , pos , "quad_mltpx<fx64>" ) , skew_on = 0 , nested = 0 , ok = 0;
+        __fx64 params[ 3 ];
+        __ix32 counts[ 4 ];
+        __type vars  [ 14 ];
+        frac_delay< __type > skew;
+        if( end == 0 ) return 0;
+
+        if( !__state_get__( data , end , pos , params , 3 ) || !__state_get__( data , end , pos , counts , 4 ) ||
+            !__state_get__( data , end , pos , vars , 14 ) ) return 0;
+        if( counts[0] < 0 || counts[1] <= 0 || counts[2] < 0 || counts[2] > counts[3] || counts[3] >= counts[1] ||
+            !__state_room__< __type >( end , pos , counts[1] ) ) return 0;
+
+        // the state is restored into the temporaries , that replace the filter members only on success:
+        mirror_ring_buffer< __type , __DELAY_LINE_CAPACITY > buff_re , buff_im , buff_skew;
+        __type *ref_cos = ( __type* )calloc( counts[1] , sizeof ( __type ) );
+        __type *ref_sin = ( __type* )calloc( counts[1] , sizeof ( __type ) );
+        ok = ref_cos != nullptr && ref_sin != nullptr && buff_re.allocate(2) && buff_im.allocate(2) &&
+             __state_get__( data , end , pos , ref_cos , counts[1] ) && __state_get__( data , end , pos , ref_sin , counts[1] ) &&
+             __buff_get__( data , end , pos , buff_re ) && __buff_get__( data , end , pos , buff_im ) &&
+             __state_get__( data , end , pos , &skew_on ) && __state_get__( data , end , pos , &skew ) &&
+             ( !skew_on || ( __state_room__< __type >( end , pos , skew.m_base ) && buff_skew.allocate( skew.size() ) ) ) &&
+             __buff_get__( data , end , pos , buff_skew );
+
+        // the nested filters states are validated by means of the temporary filters:
+        nested = pos;
+        fcomb< __type > apfilt;
+        fir_decimator< __type > fir_re , fir_im;
+        fir< __type > fir_df;
+        ok = ok && __state_nested__( apfilt , data , end , pos ) && __state_nested__( fir_re , data , end , pos ) &&
+             __state_nested__( fir_im , data , end , pos ) && __state_nested__( fir_df , data , end , pos ) && ( pos == end ) &&
+             ( fir_re.factor() == counts[0] && fir_im.factor() == counts[0] );
+        if( !ok )
+        {
+            free( ref_cos );
+            free( ref_sin );
+            return 0;
+        }
+
+        deallocate();
+        m_Fs = params[0]; m_Ts = params[1]; m_Fn = params[2];
+        m_HBuffSize = counts[0]; m_SamplesPerPeriod = counts[1]; m_cnt = counts[2]; m_ElemNum = counts[3];
+        m_a  = vars[0] ; m_b  = vars[1] ; m_K  = vars[2] ; m_Km = vars[3] ;
+        m_A1 = vars[4] ; m_B1 = vars[5] ; m_C1 = vars[6] ;
+        m_A2 = vars[7] ; m_B2 = vars[8] ; m_C2 = vars[9] ;
+        m_Re = vars[10]; m_Im = vars[11]; m_F  = vars[12]; m_dF = vars[13];
+        m_ref_cos = ref_cos;
+        m_ref_sin = ref_sin;
+        m_skew_on = skew_on;
+        m_skew    = skew;
+        m_buff_re  .swap( buff_re   );
+        m_buff_im  .swap( buff_im   );
+        m_buff_skew.swap( buff_skew );
+
+        // the validated nested states are loaded into the nested filters , only the memory allocation can fail here:
+        pos = nested;
+        if( !__state_nested__( m_apfilt , data , end , pos ) || !__state_nested__( m_fir_re , data , end , pos ) ||
+            !__state_nested__( m_fir_im , data , end , pos ) || !__state_nested__( m_fir_df , data , end , pos ) )
+        {
+            deallocate();
+            return 0;
+        }
+
+        return end;
+    }
+
     /*!
      *  \brief template filtering function
      *  \param[input        ] - pointer to the input signal frames
@@ -609,10 +907,19 @@ public:
     {
         for ( __ix32 n = 0 ; n < m_HBuffSize; n++)
         {
-            // aperiodic component filtering:
-            m_apfilt( &input[n] );
+            // inter channel skew compensation and aperiodic component filtering:
+            if( m_skew_on )
+            {
+                m_buff_skew( &input[n] );
+                __type x = m_skew( m_buff_skew );
+                m_apfilt( &x );
+            }
+            else
+            {
+                m_apfilt( &input[n] );
+            }
 
-            // quadrature multiplication and FIR filters buffers filling:
+            // quadrature multiplication and decimating FIR filters phases filling:
             m_fir_re.fill_fir_buff( &( m_a = m_ref_sin[m_cnt] * m_apfilt.m_out ) );
             m_fir_im.fill_fir_buff( &( m_b = m_ref_cos[m_cnt] * m_apfilt.m_out ) );
 
@@ -621,14 +928,21 @@ public:
             else m_cnt = 0;
         }
 
-        // filtering:
+        // filtering ( the cycle last sample completes the decimation cycle , so the output is computed once per cycle ):
         m_fir_re.filt();
         m_fir_im.filt();
 
-        // vector computation:
+        // vector computation ( the output phasor is rotated if the inter channel delay is compensated in the frequency domain ):
         m_vector1( m_fir_re.m_out , m_fir_im.m_out );
-        m_vector2( 1 , -PI2 * m_F * intChanDelay );
-        m_vector3 = m_vector1 * m_vector2;
+        if( intChanDelay != 0 )
+        {
+            m_vector2( 1 , -PI2 * m_F * intChanDelay );
+            m_vector3 = m_vector1 * m_vector2;
+        }
+        else
+        {
+            m_vector3 = m_vector1;
+        }
         m_Re      = m_vector3.m_re;
         m_Im      = m_vector3.m_im;
 
@@ -723,9 +1037,9 @@ private:
     __type *m_ref_sin;
 
     /*! \brief input signal real component buffer */
-    mirror_ring_buffer<__type> m_buff_re;
+    mirror_ring_buffer< __type , __DELAY_LINE_CAPACITY > m_buff_re;
     /*! \brief input signal imaginary component buffer */
-    mirror_ring_buffer<__type> m_buff_im;
+    mirror_ring_buffer< __type , __DELAY_LINE_CAPACITY > m_buff_im;
 
     /*! \brief recursuve mean filter to extract input signal real component */
     recursive_mean<__type> m_rmean_re1;
@@ -738,6 +1052,13 @@ private:
     /*! \brief fir filter to smooth input signal frequency slip */
     fir<__type> m_fir_df;
 
+    /*! \brief input signal buffer for inter channel skew compensation */
+    mirror_ring_buffer< __type , __DELAY_LINE_CAPACITY > m_buff_skew;
+    /*! \brief inter channel skew compensation fractional delay reader */
+    frac_delay< __type > m_skew;
+    /*! \brief inter channel skew compensation flag */
+    __ix32 m_skew_on;
+
     /*! \brief auxiliary vector */
     complex< __type > m_vector1;
     /*! \brief auxiliary vector */
@@ -805,6 +1126,27 @@ public:
         // reference frame:
         m_ref_cos = nullptr;
         m_ref_sin = nullptr;
+
+        // inter channel skew compensation is disabled by default:
+        m_skew_on = 0;
+    }
+
+    /*!
+     *  \brief inter channel skew compensation initialization function
+     *  \param[delay] - inter channel delay , s
+     *  \details The input signal is delayed by the fractional number of samples by means of Lagrange interpolation
+     *           before the quadrature multiplication , so the channels are time-aligned in the sample domain.
+     *           Zero intChanDelay must be passed to the filtering function then.
+     *           The delay must lie within one nominal frequency period: 0 <= delay <= 1 / Fn.
+     *  \return The function returns 1 if the skew compensation buffer is allocated and 0 otherwise.
+     *          A negative , NaN or too long delay is rejected and the current skew compensation is kept.
+    */
+    __ix32 set_skew( __fx64 delay )
+    {
+        if( !( delay >= 0 && delay <= 1 / m_Fn ) ) return 0;
+        m_buff_skew.deallocate();
+        m_skew.init( delay * m_Fs );
+        return ( m_skew_on = m_buff_skew.allocate( m_skew.size() ) );
     }
 
     /*! \brief default constructor */
@@ -851,6 +1193,9 @@ public:
         // reference frame:
         m_ref_cos = nullptr;
         m_ref_sin = nullptr;
+
+        // inter channel skew compensation is disabled by default:
+        m_skew_on = 0;
     }
 
     /*! \brief memory allocation function */
@@ -930,7 +1275,8 @@ public:
         m_rmean_im2.deallocate();
         m_fir_df   .deallocate();
         m_buff_re  .deallocate();
-        m_buff_re  .deallocate();
+        m_buff_im  .deallocate();
+        m_buff_skew.deallocate();
 
         // reference frame and output memory deallocation:
         if( m_ref_cos != nullptr ) { free( m_ref_cos ); m_ref_cos = nullptr; }
@@ -944,6 +1290,138 @@ public:
     /*! \brief default destructor */
     ~quad_mltpx_rt() { deallocate(); }
 
+    /*!
+     *  \brief state saving function
+     *  \param[blob] - pointer to the state memory block or null pointer to compute the state size only
+     *  \return The function stores the parameters , reference frames , buffers , nested filters states and outputs
+     *          into the state memory block and returns the state size , bytes. The function returns 0 if the filter is not allocated.
+    */
+    __ix32 save_state( void *blob )
+    {
+        char  *data = ( char* )blob;
+        __ix32 pos = 0 , size = 0;
+        if( m_ref_cos == nullptr || m_ref_sin == nullptr || m_Re == nullptr || m_Im == nullptr ) return 0;
+        __state_begin__( data , pos , "quad_mltpx_rt<fx32>" );
+
+        __fx64 params[] = { m_Fs , m_Ts , m_Fn };
+        __ix32 counts[] = { m_HBuffSize , m_SamplesPerPeriod , m_cnt , m_ElemNum };
+        __type vars  [] = { m_a , m_b , m_K , m_Km , m_A1 , m_B1 , m_C1 , m_A2 , m_B2 , m_C2 , m_F , m_dF };
+        __state_put__( data , pos , params , 3  );
+        __state_put__( data , pos , counts , 4  );
+        __state_put__( data , pos , vars   , 12 );
+        __state_put__( data , pos , m_ref_cos , m_SamplesPerPeriod );
+        __state_put__( data , pos , m_ref_sin , m_SamplesPerPeriod );
+        __state_put__( data , pos , m_Re , m_HBuffSize );
+        __state_put__( data , pos , m_Im , m_HBuffSize );
+        __buff_put__ ( data , pos , m_buff_re );
+        __buff_put__ ( data , pos , m_buff_im );
+        __state_put__( data , pos , &m_skew_on );
+        __state_put__( data , pos , &m_skew );
+        __buff_put__ ( data , pos , m_buff_skew );
+
+        // nested filters states:
+        if( ( size = m_rmean_re1.save_state( data ? data + pos : 0 ) ) == 0 ) return 0; else pos += size;
+        if( ( size = m_rmean_im1.save_state( data ? data + pos : 0 ) ) == 0 ) return 0; else pos += size;
+        if( ( size = m_rmean_re2.save_state( data ? data + pos : 0 ) ) == 0 ) return 0; else pos += size;
+        if( ( size = m_rmean_im2.save_state( data ? data + pos : 0 ) ) == 0 ) return 0; else pos += size;
+        if( ( size = m_fir_df   .save_state( data ? data + pos : 0 ) ) == 0 ) return 0; else pos += size;
+
+        return __state_end__( data , pos );
+    }
+
+    /*!
+     *  \brief state loading function
+     *  \param[blob] - pointer to the state memory block
+     *  \param[size] - available memory size , bytes
+     *  \return The function restores the filter without the nested filters redesign and returns the number of the bytes read
+     *          or 0 if the state can not be restored. The filter is not changed if the state is not valid.
+    */
+    __ix32 load_state( const void *blob , __ix32 size )
+    {
+        const char *data = ( const char* )blob;
+        __ix32 pos = 0 , end = __state_open__( data , size , pos , "quad_mltpx_rt<fx32>" ) , skew_on = 0 , nested = 0 , ok = 0;
+        __fx64 params[ 3 ];
+        __ix32 counts[ 4 ];
+        __type vars  [ 12 ];
+        frac_delay< __type > skew;
+        if( end == 0 ) return 0;
+
+        if( !__state_get__( data , end , pos , params , 3 ) || !__state_get__( data , end , pos , counts , 4 ) ||
+            !__state_get__( data , end , pos , vars , 12 ) ) return 0;
+        if( counts[0] <= 0 || counts[1] <= 0 || counts[2] < 0 || counts[2] > counts[3] || counts[3] >= counts[1] ||
+            !__state_room__< __type >( end , pos , counts[1] ) || !__state_room__< __type >( end , pos , counts[0] ) ) return 0;
+
+        // the state is restored into the temporaries , that replace the filter members only on success:
+        mirror_ring_buffer< __type , __DELAY_LINE_CAPACITY > buff_re , buff_im , buff_skew;
+        __type *ref_cos = ( __type* )calloc( counts[1] , sizeof ( __type ) );
+        __type *ref_sin = ( __type* )calloc( counts[1] , sizeof ( __type ) );
+        __type *Re      = ( __type* )calloc( counts[0] , sizeof ( __type ) );
+        __type *Im      = ( __type* )calloc( counts[0] , sizeof ( __type ) );
+        ok = ref_cos != nullptr && ref_sin != nullptr && Re != nullptr && Im != nullptr && buff_re.allocate(2) && buff_im.allocate(2) &&
+             __state_get__( data , end , pos , ref_cos , counts[1] ) && __state_get__( data , end , pos , ref_sin , counts[1] ) &&
+             __state_get__( data , end , pos , Re , counts[0] ) && __state_get__( data , end , pos , Im , counts[0] ) &&
+             __buff_get__( data , end , pos , buff_re ) && __buff_get__( data , end , pos , buff_im ) &&
+             __state_get__( data , end , pos , &skew_on ) && __state_get__( data , end , pos , &skew ) &&
+             ( !skew_on || ( __state_room__< __type >( end , pos , skew.m_base ) && buff_skew.allocate( skew.size() ) ) ) &&
+             __buff_get__( data , end , pos , buff_skew );
+
+        // the nested filters states are validated by means of the temporary filters:
+        nested = pos;
+        recursive_mean< __type > rmean_re1 , rmean_im1 , rmean_re2 , rmean_im2;
+        fir< __type > fir_df;
+        ok = ok && __state_nested__( rmean_re1 , data , end , pos ) && __state_nested__( rmean_im1 , data , end , pos ) &&
+             __state_nested__( rmean_re2 , data , end , pos ) && __state_nested__( rmean_im2 , data , end , pos ) &&
+             __state_nested__( fir_df    , data , end , pos ) && ( pos == end );
+        if( !ok )
+        {
+            free( ref_cos );
+            free( ref_sin );
+            free( Re );
+            free( Im );
+            return 0;
+        }
+
+        deallocate();
+        m_Fs = params[0]; m_Ts = params[1]; m_Fn = params[2];
+        m_HBuffSize = counts[0]; m_SamplesPerPeriod = counts[1]; m_cnt = counts[2]; m_ElemNum = counts[3];
+        m_a  = vars[0] ; m_b  = vars[1] ; m_K  = vars[2] ; m_Km = vars[3] ;
+        m_A1 = vars[4] ; m_B1 = vars[5] ; m_C1 = vars[6] ;
+        m_A2 = vars[7] ; m_B2 = vars[8] ; m_C2 = vars[9] ;
+        m_F  = vars[10]; m_dF = vars[11];
+        m_ref_cos = ref_cos;
+        m_ref_sin = ref_sin;
+        m_Re      = Re;
+        m_Im      = Im;
+        m_skew_on = skew_on;
+        m_skew    = skew;
+        m_buff_re  .swap( buff_re   );
+        m_buff_im  .swap( buff_im   );
+        m_buff_skew.swap( buff_skew );
+
+        // the validated nested states are loaded into the nested filters , only the memory allocation can fail here:
+        pos = nested;
+        if( !__state_nested__( m_rmean_re1 , data , end , pos ) || !__state_nested__( m_rmean_im1 , data , end , pos ) ||
+            !__state_nested__( m_rmean_re2 , data , end , pos ) || !__state_nested__( m_rmean_im2 , data , end , pos ) ||
+            !__state_nested__( m_fir_df    , data , end , pos ) )
+        {
+            deallocate();
+            return 0;
+        }
+
+        return end;
+    }
+
+    /*!
+     *  \brief inter channel skew compensation function
+     *  \param[input] - pointer to the input signal frame
+     *  \return The function returns the time-aligned input sample or the input sample itself if the skew compensation is disabled
+    */
+    template< typename T > inline __fx64 align( T *input )
+    {
+        if( !m_skew_on ) return *input;
+        m_buff_skew( input );
+        return m_skew( m_buff_skew );
+    }
 
     /*!
      *  \brief template filtering function
@@ -957,9 +1435,12 @@ public:
         {
             for ( __ix32 n = 0 ; n < m_HBuffSize; n++)
             {
+                // inter channel skew compensation:
+                __fx64 x = align( &input[n] );
+
                 // quadrature multiplication and quadrature components filtering:
-                m_rmean_re1( &( m_a = m_ref_sin[m_cnt] * input[n] ) );
-                m_rmean_im1( &( m_b = m_ref_cos[m_cnt] * input[n] ) );
+                m_rmean_re1( &( m_a = m_ref_sin[m_cnt] * x ) );
+                m_rmean_im1( &( m_b = m_ref_cos[m_cnt] * x ) );
                 m_rmean_re2( &m_rmean_re1.m_out );
                 m_rmean_im2( &m_rmean_im1.m_out );
 
@@ -1002,9 +1483,12 @@ public:
         {
             for ( __ix32 n = 0 ; n < m_HBuffSize; n++)
             {
+                // inter channel skew compensation:
+                __fx64 x = align( &input[n] );
+
                 // quadrature multiplication:
-                m_a = m_ref_sin[m_cnt] * input[n];
-                m_b = m_ref_cos[m_cnt] * input[n];
+                m_a = m_ref_sin[m_cnt] * x;
+                m_b = m_ref_cos[m_cnt] * x;
 
                 // reference frame counter zerowing:
                 if ( m_cnt < m_ElemNum ) m_cnt++;
@@ -1109,9 +1593,9 @@ private:
     __type *m_ref_sin;
 
     /*! \brief input signal real component buffer */
-    mirror_ring_buffer<__type> m_buff_re;
+    mirror_ring_buffer< __type , __DELAY_LINE_CAPACITY > m_buff_re;
     /*! \brief input signal imaginary component buffer */
-    mirror_ring_buffer<__type> m_buff_im;
+    mirror_ring_buffer< __type , __DELAY_LINE_CAPACITY > m_buff_im;
 
     /*! \brief recursuve mean filter to extract input signal real component */
     recursive_mean<__type> m_rmean_re1;
@@ -1124,6 +1608,13 @@ private:
     /*! \brief fir filter to smooth input signal frequency slip */
     fir<__type> m_fir_df;
 
+    /*! \brief input signal buffer for inter channel skew compensation */
+    mirror_ring_buffer< __type , __DELAY_LINE_CAPACITY > m_buff_skew;
+    /*! \brief inter channel skew compensation fractional delay reader */
+    frac_delay< __type > m_skew;
+    /*! \brief inter channel skew compensation flag */
+    __ix32 m_skew_on;
+
     /*! \brief auxiliary vector */
     complex< __type > m_vector1;
     /*! \brief auxiliary vector */
@@ -1191,6 +1682,27 @@ public:
         // reference frame:
         m_ref_cos = nullptr;
         m_ref_sin = nullptr;
+
+        // inter channel skew compensation is disabled by default:
+        m_skew_on = 0;
+    }
+
+    /*!
+     *  \brief inter channel skew compensation initialization function
+     *  \param[delay] - inter channel delay , s
+     *  \details The input signal is delayed by the fractional number of samples by means of Lagrange interpolation
+     *           before the quadrature multiplication , so the channels are time-aligned in the sample domain.
+     *           Zero intChanDelay must be passed to the filtering function then.
+     *           The delay must lie within one nominal frequency period: 0 <= delay <= 1 / Fn.
+     *  \return The function returns 1 if the skew compensation buffer is allocated and 0 otherwise.
+     *          A negative , NaN or too long delay is rejected and the current skew compensation is kept.
+    */
+    __ix32 set_skew( __fx64 delay )
+    {
+        if( !( delay >= 0 && delay <= 1 / m_Fn ) ) return 0;
+        m_buff_skew.deallocate();
+        m_skew.init( delay * m_Fs );
+        return ( m_skew_on = m_buff_skew.allocate( m_skew.size() ) );
     }
 
     /*! \brief default constructor */
@@ -1237,6 +1749,9 @@ public:
         // reference frame:
         m_ref_cos = nullptr;
         m_ref_sin = nullptr;
+
+        // inter channel skew compensation is disabled by default:
+        m_skew_on = 0;
     }
 
     /*! \brief memory allocation function */
@@ -1316,7 +1831,8 @@ public:
         m_rmean_im2.deallocate();
         m_fir_df   .deallocate();
         m_buff_re  .deallocate();
-        m_buff_re  .deallocate();
+        m_buff_im  .deallocate();
+        m_buff_skew.deallocate();
 
         // reference frame and output memory deallocation:
         if( m_ref_cos != nullptr ) { free( m_ref_cos ); m_ref_cos = nullptr; }
@@ -1330,6 +1846,139 @@ public:
     /*! \brief default destructor */
     ~quad_mltpx_rt() { deallocate(); }
 
+    /*!
+     *  \brief state saving function
+     *  \param[blob] - pointer to the state memory block or null pointer to compute the state size only
+     *  \return The function stores the parameters , reference frames , buffers , nested filters states and outputs
+     *          into the state memory block and returns the state size , bytes. The function returns 0 if the filter is not allocated.
+    */
+    __ix32 save_state( void *blob )
+    {
+        char  *data = ( char* )blob;
+        __ix32 pos = 0 , size = 0;
+        if( m_ref_cos == nullptr || m_ref_sin == nullptr || m_Re == nullptr || m_Im == nullptr ) return 0;
+        __state_begin__( data , pos , "quad_mltpx_rt<fx64>" );
+
+        __fx64 params[] = { m_Fs , m_Ts , m_Fn };
+        __ix32 counts[] = { m_HBuffSize , m_SamplesPerPeriod , m_cnt , m_ElemNum };
+        __type vars  [] = { m_a , m_b , m_K , m_Km , m_A1 , m_B1 , m_C1 , m_A2 , m_B2 , m_C2 , m_F , m_dF };
+        __state_put__( data , pos , params , 3  );
+        __state_put__( data , pos , counts , 4  );
+        __state_put__( data , pos , vars   , 12 );
+        __state_put__( data , pos , m_ref_cos , m_SamplesPerPeriod );
+        __state_put__( data , pos , m_ref_sin , m_SamplesPerPeriod );
+        __state_put__( data , pos , m_Re , m_HBuffSize );
+        __state_put__( data , pos , m_Im , m_HBuffSize );
+        __buff_put__ ( data , pos , m_buff_re );
+        __buff_put__ ( data , pos , m_buff_im );
+        __state_put__( data , pos , &m_skew_on );
+        __state_put__( data , pos , &m_skew );
+        __buff_put__ ( data , pos , m_buff_skew );
+
+        // nested filters states:
+        if( ( size = m_rmean_re1.save_state( data ? data + pos : 0 ) ) == 0 ) return 0; else pos += size;
+        if( ( size = m_rmean_im1.save_state( data ? data + pos : 0 ) ) == 0 ) return 0; else pos += size;
+        if( ( size = m_rmean_re2.save_state( data ? data + pos : 0 ) ) == 0 ) return 0; else pos += size;
+        if( ( size = m_rmean_im2.save_state( data ? data + pos : 0 ) ) == 0 ) return 0; else pos += size;
+        if( ( size = m_fir_df   .save_state( data ? data + pos : 0 ) ) == 0 ) return 0; else pos += size;
+
+        return __state_end__( data , pos );
+    }
+
+    /*!
+     *  \brief state loading function
+     *  \param[blob] - pointer to the state memory block
+     *  \param[size] - available memory size , bytes
+     *  \return The function restores the filter without the nested filters redesign and returns the number of the bytes read
+     *          or 0 if the state can not be restored. The filter is not changed if the state is not valid.
+    */
+    __ix32 load_state( const void *blob , __ix32 size )
+    {
+        const char *data = ( const char* )blob;
+        __ix32 pos = 0 , end = __state_open__( data , size , pos , "quad_mltpx_rt<fx64>" ) , skew_on = 0 , nested = 0 , ok = 0;
+        __fx64 params[ 3 ];
+        __ix32 counts[ 4 ];
+        __type vars  [ 12 ];
+        frac_delay< __type > skew;
+        if( end == 0 ) return 0;
+
+        if( !__state_get__( data , end , pos , params , 3 ) || !__state_get__( data , end , pos , counts , 4 ) ||
+            !__state_get__( data , end , pos , vars , 12 ) ) return 0;
+        if( counts[0] <= 0 || counts[1] <= 0 || counts[2] < 0 || counts[2] > counts[3] || counts[3] >= counts[1] ||
+            !__state_room__< __type >( end , pos , counts[1] ) || !__state_room__< __type >( end , pos , counts[0] ) ) return 0;
+
+        // the state is restored into the temporaries , that replace the filter members only on success:
+        mirror_ring_buffer< __type , __DELAY_LINE_CAPACITY > buff_re , buff_im , buff_skew;
+        __type *ref_cos = ( __type* )calloc( counts[1] , sizeof ( __type ) );
+        __type *ref_sin = ( __type* )calloc( counts[1] , sizeof ( __type ) );
+        __type *Re      = ( __type* )calloc( counts[0] , sizeof ( __type ) );
+        __type *Im      = ( __type* )calloc( counts[0] , sizeof ( __type ) );
+        ok = ref_cos != nullptr && ref_sin != nullptr && Re != nullptr && Im != nullptr && buff_re.allocate(2) && buff_im.allocate(2) &&
+             __state_get__( data , end , pos , ref_cos , counts[1] ) && __state_get__( data , end , pos , ref_sin , counts[1] ) &&
+             __state_get__( data , end , pos , Re , counts[0] ) && __state_get__( data , end , pos , Im , counts[0] ) &&
+             __buff_get__( data , end , pos , buff_re ) && __buff_get__( data , end , pos , buff_im ) &&
+             __state_get__( data , end , pos , &skew_on ) && __state_get__( data , end , pos , &skew ) &&
+             ( !skew_on || ( __state_room__< __type >( end , pos , skew.m_base ) && buff_skew.allocate( skew.size() ) ) ) &&
+             __buff_get__( data , end , pos , buff_skew );
+
+        // the nested filters states are validated by means of the temporary filters:
+        nested = pos;
+        recursive_mean< __type > rmean_re1 , rmean_im1 , rmean_re2 , rmean_im2;
+        fir< __type > fir_df;
+        ok = ok && __state_nested__( rmean_re1 , data , end , pos ) && __state_nested__( rmean_im1 , data , end , pos ) &&
+             __state_nested__( rmean_re2 , data , end , pos ) && __state_nested__( rmean_im2 , data , end , pos ) &&
+             __state_nested__( fir_df    , data , end , pos ) && ( pos == end );
+        if( !ok )
+        {
+            free( ref_cos );
+            free( ref_sin );
+            free( Re );
+            free( Im );
+            return 0;
+        }
+
+        deallocate();
+        m_Fs = params[0]; m_Ts = params[1]; m_Fn = params[2];
+        m_HBuffSize = counts[0]; m_SamplesPerPeriod = counts[1]; m_cnt = counts[2]; m_ElemNum = counts[3];
+        m_a  = vars[0] ; m_b  = vars[1] ; m_K  = vars[2] ; m_Km = vars[3] ;
+        m_A1 = vars[4] ; m_B1 = vars[5] ; m_C1 = vars[6] ;
+        m_A2 = vars[7] ; m_B2 = vars[8] ; m_C2 = vars[9] ;
+        m_F  = vars[10]; m_dF = vars[11];
+        m_ref_cos = ref_cos;
+        m_ref_sin = ref_sin;
+        m_Re      = Re;
+        m_Im      = Im;
+        m_skew_on = skew_on;
+        m_skew    = skew;
+        m_buff_re  .swap( buff_re   );
+        m_buff_im  .swap( buff_im   );
+        m_buff_skew.swap( buff_skew );
+
+        // the validated nested states are loaded into the nested filters , only the memory allocation can fail here:
+        pos = nested;
+        if( !__state_nested__( m_rmean_re1 , data , end , pos ) || !__state_nested__( m_rmean_im1 , data , end , pos ) ||
+            !__state_nested__( m_rmean_re2 , data , end , pos ) || !__state_nested__( m_rmean_im2 , data , end , pos ) ||
+            !__state_nested__( m_fir_df    , data , end , pos ) )
+        {
+            deallocate();
+            return 0;
+        }
+
+        return end;
+    }
+
+    /*!
+     *  \brief inter channel skew compensation function
+     *  \param[input] - pointer to the input signal frame
+     *  \return The function returns the time-aligned input sample or the input sample itself if the skew compensation is disabled
+    */
+    template< typename T > inline __fx64 align( T *input )
+    {
+        if( !m_skew_on ) return *input;
+        m_buff_skew( input );
+        return m_skew( m_buff_skew );
+    }
+
     /*!
      *  \brief template filtering function
      *  \param[input        ] - pointer to the input signal frames
@@ -1342,9 +1991,12 @@ public:
         {
             for ( __ix32 n = 0 ; n < m_HBuffSize; n++)
             {
+                // inter channel skew compensation:
+                __fx64 x = align( &input[n] );
+
                 // quadrature multiplication and quadrature components filtering:
-                m_rmean_re1( &( m_a = m_ref_sin[m_cnt] * input[n] ) );
-                m_rmean_im1( &( m_b = m_ref_cos[m_cnt] * input[n] ) );
+                m_rmean_re1( &( m_a = m_ref_sin[m_cnt] * x ) );
+                m_rmean_im1( &( m_b = m_ref_cos[m_cnt] * x ) );
                 m_rmean_re2( &m_rmean_re1.m_out );
                 m_rmean_im2( &m_rmean_im1.m_out );
 
@@ -1387,9 +2039,12 @@ public:
         {
             for ( __ix32 n = 0 ; n < m_HBuffSize; n++)
             {
+                // inter channel skew compensation:
+                __fx64 x = align( &input[n] );
+
                 // quadrature multiplication:
-                m_a = m_ref_sin[m_cnt] * input[n];
-                m_b = m_ref_cos[m_cnt] * input[n];
+                m_a = m_ref_sin[m_cnt] * x;
+                m_b = m_ref_cos[m_cnt] * x;
 
                 // reference frame counter zerowing:
                 if ( m_cnt < m_ElemNum ) m_cnt++;
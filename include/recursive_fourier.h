@@ -190,6 +190,59 @@ public:
     /*! \brief  recursive Fourier filter default destructor */
     ~recursive_fourier(){ deallocate(); }
 
+    /*! \brief  recursive Fourier filter state saving function
+     *  \param[blob] - pointer to the state memory block or null pointer to compute the state size only
+     *  \return the function stores the filter parameters , buffer and accumulators into the state memory block
+     *          and returns the state size , bytes
+    */
+    __ix32 save_state( void *blob )
+    {
+        char  *data = ( char* )blob;
+        __ix32 pos  = 0;
+        __fx64 params[] = { m_Fn , m_Fs , m_Ts , m_Gain , m_Ns , m_hnum , m_Ks , m_Kc , m_a0 , m_a , m_b };
+        __state_begin__( data , pos , "recursive_fourier<fx32>" );
+        __state_put__( data , pos , params , 11 );
+        __state_put__( data , pos , &m_order );
+        __buff_put__ ( data , pos , m_buffer_sx );
+        return __state_end__( data , pos );
+    }
+
+    /*! \brief  recursive Fourier filter state loading function
+     *  \param[blob] - pointer to the state memory block
+     *  \param[size] - available memory size , bytes
+     *  \return the function restores the filter and returns the number of the bytes read
+     *          or 0 if the state can not be restored. The filter is not changed if the state is not valid.
+    */
+    __ix32 load_state( const void *blob , __ix32 size )
+    {
+        const char *data = ( const char* )blob;
+        __ix32 pos = 0 , end = __state_open__( data , size , pos , "recursive_fourier<fx32>" ) , order = 0;
+        __fx64 params[ 11 ];
+        if( end == 0 ) return 0;
+
+        if( !__state_get__( data , end , pos , params , 11 ) || !__state_get__( data , end , pos , &order ) ) return 0;
+        if( order < 0 || !__state_room__< __type >( end , pos , order ) ) return 0;
+
+        // the buffer is restored into the temporary , that replaces the filter buffer only on success:
+        mirror_ring_buffer<__type> bx;
+        if( !bx.allocate( order + 2 ) || !__buff_get__( data , end , pos , bx ) || pos != end ) return 0;
+
+        m_order = order;
+        m_Fn   = params[0];
+        m_Fs   = params[1];
+        m_Ts   = params[2];
+        m_Gain = params[3];
+        m_Ns   = params[4];
+        m_hnum = params[5];
+        m_Ks   = params[6];
+        m_Kc   = params[7];
+        m_a0   = params[8];
+        m_a    = params[9];
+        m_b    = params[10];
+        m_buffer_sx.swap( bx );
+        return end;
+    }
+
     /*! \brief  32-bit recursive Fourier filter filtering function
      *  \param[input] - pointer to the nput signal frames
      *  \return The function computes real and imaginary harmonic component
@@ -366,6 +419,59 @@ public:
     /*! \brief  recursive Fourier filter default destructor */
     ~recursive_fourier(){ deallocate(); }
 
+    /*! \brief  recursive Fourier filter state saving function
+     *  \param[blob] - pointer to the state memory block or null pointer to compute the state size only
+     *  \return the function stores the filter parameters , buffer and accumulators into the state memory block
+     *          and returns the state size , bytes
+    */
+    __ix32 save_state( void *blob )
+    {
+        char  *data = ( char* )blob;
+        __ix32 pos  = 0;
+        __fx64 params[] = { m_Fn , m_Fs , m_Ts , m_Gain , m_Ns , m_hnum , m_Ks , m_Kc , m_a0 , m_a , m_b };
+        __state_begin__( data , pos , "recursive_fourier<fx64>" );
+        __state_put__( data , pos , params , 11 );
+        __state_put__( data , pos , &m_order );
+        __buff_put__ ( data , pos , m_buffer_sx );
+        return __state_end__( data , pos );
+    }
+
+    /*! \brief  recursive Fourier filter state loading function
+     *  \param[blob] - pointer to the state memory block
+     *  \param[size] - available memory size , bytes
+     *  \return the function restores the filter and returns the number of the bytes read
+     *          or 0 if the state can not be restored. The filter is not changed if the state is not valid.
+    */
+    __ix32 load_state( const void *blob , __ix32 size )
+    {
+        const char *data = ( const char* )blob;
+        __ix32 pos = 0 , end = __state_open__( data , size , pos , "recursive_fourier<fx64>" ) , order = 0;
+        __fx64 params[ 11 ];
+        if( end == 0 ) return 0;
+
+        if( !__state_get__( data , end , pos , params , 11 ) || !__state_get__( data , end , pos , &order ) ) return 0;
+        if( order < 0 || !__state_room__< __type >( end , pos , order ) ) return 0;
+
+        // the buffer is restored into the temporary , that replaces the filter buffer only on success:
+        mirror_ring_buffer<__type> bx;
+        if( !bx.allocate( order + 2 ) || !__buff_get__( data , end , pos , bx ) || pos != end ) return 0;
+
+        m_order = order;
+        m_Fn   = params[0];
+        m_Fs   = params[1];
+        m_Ts   = params[2];
+        m_Gain = params[3];
+        m_Ns   = params[4];
+        m_hnum = params[5];
+        m_Ks   = params[6];
+        m_Kc   = params[7];
+        m_a0   = params[8];
+        m_a    = params[9];
+        m_b    = params[10];
+        m_buffer_sx.swap( bx );
+        return end;
+    }
+
     /*! \brief  32-bit recursive Fourier filter filtering function
      *  \param[input] - pointer to the nput signal frames
      *  \return The function computes real and imaginary harmonic component
@@ -137,6 +137,7 @@ public:
         m_Ns      = m_order;
         m_Ts      = 1 / m_Fs;
         m_Gain    = 1 / m_Ns;
+        m_out     = 0;
     }
 
     /*! \brief  recursive mean filter default constructor */
@@ -148,6 +149,7 @@ public:
         m_Ns      = m_order;
         m_Ts      = 1 / m_Fs;
         m_Gain    = 1 / m_Ns;
+        m_out     = 0;
     };
 
     /*! \brief  recursive Fourier filter initializing constructor
@@ -161,6 +163,54 @@ public:
     /*! \brief  recursive mean filter default destructor */
     ~recursive_mean(){ deallocate(); }
 
+    /*! \brief  recursive mean filter state saving function
+     *  \param[blob] - pointer to the state memory block or null pointer to compute the state size only
+     *  \return the function stores the filter parameters , buffer and output into the state memory block
+     *          and returns the state size , bytes
+    */
+    __ix32 save_state( void *blob )
+    {
+        char  *data = ( char* )blob;
+        __ix32 pos  = 0;
+        __fx64 params[] = { m_Fn , m_Fs , m_Ts , m_Gain , m_Ns , m_out };
+        __state_begin__( data , pos , "recursive_mean<fx32>" );
+        __state_put__( data , pos , params , 6 );
+        __state_put__( data , pos , &m_order );
+        __buff_put__ ( data , pos , m_buffer_sx );
+        return __state_end__( data , pos );
+    }
+
+    /*! \brief  recursive mean filter state loading function
+     *  \param[blob] - pointer to the state memory block
+     *  \param[size] - available memory size , bytes
+     *  \return the function restores the filter and returns the number of the bytes read
+     *          or 0 if the state can not be restored. The filter is not changed if the state is not valid.
+    */
+    __ix32 load_state( const void *blob , __ix32 size )
+    {
+        const char *data = ( const char* )blob;
+        __ix32 pos = 0 , end = __state_open__( data , size , pos , "recursive_mean<fx32>" ) , order = 0;
+        __fx64 params[ 6 ];
+        if( end == 0 ) return 0;
+
+        if( !__state_get__( data , end , pos , params , 6 ) || !__state_get__( data , end , pos , &order ) ) return 0;
+        if( order < 0 || !__state_room__< __type >( end , pos , order ) ) return 0;
+
+        // the buffer is restored into the temporary , that replaces the filter buffer only on success:
+        mirror_ring_buffer<__type> bx;
+        if( !bx.allocate( order + 2 ) || !__buff_get__( data , end , pos , bx ) || pos != end ) return 0;
+
+        m_order = order;
+        m_Fn   = params[0];
+        m_Fs   = params[1];
+        m_Ts   = params[2];
+        m_Gain = params[3];
+        m_Ns   = params[4];
+        m_out  = params[5];
+        m_buffer_sx.swap( bx );
+        return end;
+    }
+
     /*! \brief recursive mean filter frequency response computation function
      *  \param[F] - input signal frequency , Hz
      *  \return The function computes phase and amplitude frequency response for the signal having frequency F
@@ -271,6 +321,7 @@ public:
         m_Ns      = m_order;
         m_Ts      = 1 / m_Fs;
         m_Gain    = 1 / m_Ns;
+        m_out     = 0;
     }
 
     /*! \brief  recursive mean filter default constructor */
@@ -282,6 +333,7 @@ public:
         m_Ns      = m_order;
         m_Ts      = 1 / m_Fs;
         m_Gain    = 1 / m_Ns;
+        m_out     = 0;
     };
 
     /*! \brief  recursive Fourier filter initializing constructor
@@ -295,6 +347,54 @@ public:
     /*! \brief  recursive mean filter default destructor */
     ~recursive_mean(){ deallocate(); }
 
+    /*! \brief  recursive mean filter state saving function
+     *  \param[blob] - pointer to the state memory block or null pointer to compute the state size only
+     *  \return the function stores the filter parameters , buffer and output into the state memory block
+     *          and returns the state size , bytes
+    */
+    __ix32 save_state( void *blob )
+    {
+        char  *data = ( char* )blob;
+        __ix32 pos  = 0;
+        __fx64 params[] = { m_Fn , m_Fs , m_Ts , m_Gain , m_Ns , m_out };
+        __state_begin__( data , pos , "recursive_mean<fx64>" );
+        __state_put__( data , pos , params , 6 );
+        __state_put__( data , pos , &m_order );
+        __buff_put__ ( data , pos , m_buffer_sx );
+        return __state_end__( data , pos );
+    }
+
+    /*! \brief  recursive mean filter state loading function
+     *  \param[blob] - pointer to the state memory block
+     *  \param[size] - available memory size , bytes
+     *  \return the function restores the filter and returns the number of the bytes read
+     *          or 0 if the state can not be restored. The filter is not changed if the state is not valid.
+    */
+    __ix32 load_state( const void *blob , __ix32 size )
+    {
+        const char *data = ( const char* )blob;
+        __ix32 pos = 0 , end = __state_open__( data , size , pos , "recursive_mean<fx64>" ) , order = 0;
+        __fx64 params[ 6 ];
+        if( end == 0 ) return 0;
+
+        if( !__state_get__( data , end , pos , params , 6 ) || !__state_get__( data , end , pos , &order ) ) return 0;
+        if( order < 0 || !__state_room__< __type >( end , pos , order ) ) return 0;
+
+        // the buffer is restored into the temporary , that replaces the filter buffer only on success:
+        mirror_ring_buffer<__type> bx;
+        if( !bx.allocate( order + 2 ) || !__buff_get__( data , end , pos , bx ) || pos != end ) return 0;
+
+        m_order = order;
+        m_Fn   = params[0];
+        m_Fs   = params[1];
+        m_Ts   = params[2];
+        m_Gain = params[3];
+        m_Ns   = params[4];
+        m_out  = params[5];
+        m_buffer_sx.swap( bx );
+        return end;
+    }
+
     /*! \brief recursive mean filter frequency response computation function
      *  \param[F] - input signal frequency , Hz
      *  \return The function computes phase and amplitude frequency response for the signal having frequency F
@@ -166,6 +166,56 @@ public:
     /*! \brief  recursive root mean square filter default destructor */
     ~recursive_rms(){ deallocate(); }
 
+    /*! \brief  recursive root mean square filter state saving function
+     *  \param[blob] - pointer to the state memory block or null pointer to compute the state size only
+     *  \return the function stores the filter parameters , buffer , accumulator and output into the state memory block
+     *          and returns the state size , bytes
+    */
+    __ix32 save_state( void *blob )
+    {
+        char  *data = ( char* )blob;
+        __ix32 pos  = 0;
+        __fx64 params[] = { m_Fn , m_Fs , m_Ts , m_Gain , m_Ns , m_auxv , m_y , m_out };
+        __state_begin__( data , pos , "recursive_rms<fx32>" );
+        __state_put__( data , pos , params , 8 );
+        __state_put__( data , pos , &m_order );
+        __buff_put__ ( data , pos , m_buffer_sx );
+        return __state_end__( data , pos );
+    }
+
+    /*! \brief  recursive root mean square filter state loading function
+     *  \param[blob] - pointer to the state memory block
+     *  \param[size] - available memory size , bytes
+     *  \return the function restores the filter and returns the number of the bytes read
+     *          or 0 if the state can not be restored. The filter is not changed if the state is not valid.
+    */
+    __ix32 load_state( const void *blob , __ix32 size )
+    {
+        const char *data = ( const char* )blob;
+        __ix32 pos = 0 , end = __state_open__( data , size , pos , "recursive_rms<fx32>" ) , order = 0;
+        __fx64 params[ 8 ];
+        if( end == 0 ) return 0;
+
+        if( !__state_get__( data , end , pos , params , 8 ) || !__state_get__( data , end , pos , &order ) ) return 0;
+        if( order < 0 || !__state_room__< __type >( end , pos , order ) ) return 0;
+
+        // the buffer is restored into the temporary , that replaces the filter buffer only on success:
+        mirror_ring_buffer<__type> bx;
+        if( !bx.allocate( order + 2 ) || !__buff_get__( data , end , pos , bx ) || pos != end ) return 0;
+
+        m_order = order;
+        m_Fn   = params[0];
+        m_Fs   = params[1];
+        m_Ts   = params[2];
+        m_Gain = params[3];
+        m_Ns   = params[4];
+        m_auxv = params[5];
+        m_y    = params[6];
+        m_out  = params[7];
+        m_buffer_sx.swap( bx );
+        return end;
+    }
+
     /*! \brief recursive root mean square filter frequency response computation function
      *  \param[F] - input signal frequency , Hz
      *  \return The function computes phase and amplitude frequency response for the signal having frequency F
@@ -307,6 +357,56 @@ public:
     /*! \brief  recursive root mean square filter default destructor */
     ~recursive_rms(){ deallocate(); }
 
+    /*! \brief  recursive root mean square filter state saving function
+     *  \param[blob] - pointer to the state memory block or null pointer to compute the state size only
+     *  \return the function stores the filter parameters , buffer , accumulator and output into the state memory block
+     *          and returns the state size , bytes
+    */
+    __ix32 save_state( void *blob )
+    {
+        char  *data = ( char* )blob;
+        __ix32 pos  = 0;
+        __fx64 params[] = { m_Fn , m_Fs , m_Ts , m_Gain , m_Ns , m_auxv , m_y , m_out };
+        __state_begin__( data , pos , "recursive_rms<fx64>" );
+        __state_put__( data , pos , params , 8 );
+        __state_put__( data , pos , &m_order );
+        __buff_put__ ( data , pos , m_buffer_sx );
+        return __state_end__( data , pos );
+    }
+
+    /*! \brief  recursive root mean square filter state loading function
+     *  \param[blob] - pointer to the state memory block
+     *  \param[size] - available memory size , bytes
+     *  \return the function restores the filter and returns the number of the bytes read
+     *          or 0 if the state can not be restored. The filter is not changed if the state is not valid.
+    */
+    __ix32 load_state( const void *blob , __ix32 size )
+    {
+        const char *data = ( const char* )blob;
+        __ix32 pos = 0 , end = __state_open__( data , size , pos , "recursive_rms<fx64>" ) , order = 0;
+        __fx64 params[ 8 ];
+        if( end == 0 ) return 0;
+
+        if( !__state_get__( data , end , pos , params , 8 ) || !__state_get__( data , end , pos , &order ) ) return 0;
+        if( order < 0 || !__state_room__< __type >( end , pos , order ) ) return 0;
+
+        // the buffer is restored into the temporary , that replaces the filter buffer only on success:
+        mirror_ring_buffer<__type> bx;
+        if( !bx.allocate( order + 2 ) || !__buff_get__( data , end , pos , bx ) || pos != end ) return 0;
+
+        m_order = order;
+        m_Fn   = params[0];
+        m_Fs   = params[1];
+        m_Ts   = params[2];
+        m_Gain = params[3];
+        m_Ns   = params[4];
+        m_auxv = params[5];
+        m_y    = params[6];
+        m_out  = params[7];
+        m_buffer_sx.swap( bx );
+        return end;
+    }
+
     /*! \brief recursive root mean square filter frequency response computation function
      *  \param[F] - input signal frequency , Hz
      *  \return The function computes phase and amplitude frequency response for the signal having frequency F
@@ -0,0 +1,1120 @@
+/*!
+ * \file
+ * \brief   SIMD kernels
+ * \authors A.Tykvinskiy
+ * \date    21.12.2021
+ * \version 1.0
+ *
+ * The header declares floating point dot product , folded dot product , channels bank dot product and
+ * fixed point dot product kernels with the runtime instruction set selection
+*/
+
+#ifndef SIMD_H
+#define SIMD_H
+
+/*! \brief defines if the x86 SIMD kernels are compiled ( the kernels are compiled with the function target attributes ) */
+#if !defined( __ALG_PLATFORM ) && defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#define __SIMD_X86
+#include <immintrin.h>
+#endif
+
+/*! \defgroup <SIMD> ( SIMD kernels )
+ *  \brief the module contains dot product kernels and the instruction set dispatcher
+    @{
+*/
+
+/*! \brief defines 32-bit floating point type */
+#ifndef __fx32
+#define __fx32 float
+#endif
+
+/*! \brief defines 64-bit floating point type */
+#ifndef __fx64
+#define __fx64 double
+#endif
+
+/*! \brief defines 16-bit integer type */
+#ifndef __ix16
+#define __ix16 short
+#endif
+
+/*! \brief defines 32-bit integer type */
+#ifndef __ix32
+#define __ix32 int
+#endif
+
+/*! \brief defines 64-bit integer type */
+#ifndef __ix64
+#define __ix64 long long
+#endif
+
+/*! \brief enables the AVX-512 kernels selection by the dot product functions ( the kernels may be selected explicitly anyway ) */
+#ifndef __SIMD_AVX512
+#define __SIMD_AVX512 0
+#endif
+
+/*! \brief instruction sets */
+enum simd_isa { isa_scalar , isa_sse2 , isa_avx2 , isa_avx512 };
+
+/*!
+ * \brief   scalar dot product kernel
+ * \param[x] - pointer to the first  vector
+ * \param[h] - pointer to the second vector
+ * \param[n] - vectors size
+ * \return  The function returns sum( x[ i ] * h[ i ] ) computed with four accumulators
+*/
+template< typename T > T __dot_scalar__( const T *x , const T *h , __ix32 n )
+{
+    T s0 = 0 , s1 = 0 , s2 = 0 , s3 = 0;
+    __ix32 i = 0;
+    for( ; i + 3 < n ; i += 4 )
+    {
+        s0 += x[i + 0] * h[i + 0];
+        s1 += x[i + 1] * h[i + 1];
+        s2 += x[i + 2] * h[i + 2];
+        s3 += x[i + 3] * h[i + 3];
+    }
+    for( ; i < n ; i++ ) s0 += x[i] * h[i];
+    return ( s0 + s1 ) + ( s2 + s3 );
+}
+
+/*!
+ * \brief   scalar folded dot product kernel
+ * \param[x] - pointer to the history vector
+ * \param[h] - pointer to the ( anti )symmetric coefficients vector
+ * \param[n] - vectors size
+ * \param[s] - folding sign ( +1 - symmetric coefficients , -1 - antisymmetric coefficients )
+ * \return  The function returns sum( ( x[ i ] + s * x[ n - 1 - i ] ) * h[ i ] ) over the n / 2 mirrored pairs
+ *          plus the middle term x[ n / 2 ] * h[ n / 2 ] for the odd n
+*/
+template< typename T > T __fold_dot_scalar__( const T *x , const T *h , __ix32 n , __ix32 s )
+{
+    T s0 = 0 , s1 = 0 , s2 = 0 , s3 = 0;
+    __ix32 i = 0 , m = n / 2;
+    for( ; i + 3 < m ; i += 4 )
+    {
+        s0 += ( x[i + 0] + s * x[n - 1 - i] ) * h[i + 0];
+        s1 += ( x[i + 1] + s * x[n - 2 - i] ) * h[i + 1];
+        s2 += ( x[i + 2] + s * x[n - 3 - i] ) * h[i + 2];
+        s3 += ( x[i + 3] + s * x[n - 4 - i] ) * h[i + 3];
+    }
+    for( ; i < m ; i++ ) s0 += ( x[i] + s * x[n - 1 - i] ) * h[i];
+    if( n % 2 != 0 ) s1 += x[m] * h[m];
+    return ( s0 + s1 ) + ( s2 + s3 );
+}
+
+/*!
+ * \brief   scalar channels bank dot product kernel
+ * \param[x] - pointer to the channel-interleaved history ( n rows of c samples )
+ * \param[h] - pointer to the coefficients vector
+ * \param[n] - coefficients number
+ * \param[c] - channels number
+ * \param[y] - pointer to the c outputs
+ * \details The function computes y[ j ] = sum( x[ i * c + j ] * h[ i ] ) for every channel j , four channels at once
+*/
+template< typename T > void __bank_dot_scalar__( const T *x , const T *h , __ix32 n , __ix32 c , T *y )
+{
+    __ix32 j = 0;
+    for( ; j + 3 < c ; j += 4 )
+    {
+        T s0 = 0 , s1 = 0 , s2 = 0 , s3 = 0;
+        for( __ix32 i = 0 ; i < n ; i++ )
+        {
+            const T *r = x + i * c + j;
+            s0 += r[0] * h[i];
+            s1 += r[1] * h[i];
+            s2 += r[2] * h[i];
+            s3 += r[3] * h[i];
+        }
+        y[j + 0] = s0;
+        y[j + 1] = s1;
+        y[j + 2] = s2;
+        y[j + 3] = s3;
+    }
+    for( ; j < c ; j++ )
+    {
+        T s0 = 0 , s1 = 0 , s2 = 0 , s3 = 0;
+        __ix32 i = 0;
+        for( ; i + 3 < n ; i += 4 )
+        {
+            s0 += x[ ( i + 0 ) * c + j ] * h[i + 0];
+            s1 += x[ ( i + 1 ) * c + j ] * h[i + 1];
+            s2 += x[ ( i + 2 ) * c + j ] * h[i + 2];
+            s3 += x[ ( i + 3 ) * c + j ] * h[i + 3];
+        }
+        for( ; i < n ; i++ ) s0 += x[ i * c + j ] * h[i];
+        y[j] = ( s0 + s1 ) + ( s2 + s3 );
+    }
+}
+
+/*!
+ * \brief   scalar fixed point dot product kernel
+ * \param[x] - pointer to the Q15 / Q31 samples vector
+ * \param[h] - pointer to the quantized coefficients vector
+ * \param[n] - vectors size
+ * \return  The function returns sum( x[ i ] * h[ i ] ) computed exactly with four 64-bit accumulators
+*/
+template< typename T > __ix64 __qdot_scalar__( const T *x , const T *h , __ix32 n )
+{
+    __ix64 s0 = 0 , s1 = 0 , s2 = 0 , s3 = 0;
+    __ix32 i = 0;
+    for( ; i + 3 < n ; i += 4 )
+    {
+        s0 += ( __ix64 )x[i + 0] * h[i + 0];
+        s1 += ( __ix64 )x[i + 1] * h[i + 1];
+        s2 += ( __ix64 )x[i + 2] * h[i + 2];
+        s3 += ( __ix64 )x[i + 3] * h[i + 3];
+    }
+    for( ; i < n ; i++ ) s0 += ( __ix64 )x[i] * h[i];
+    return ( s0 + s1 ) + ( s2 + s3 );
+}
+
+#ifdef __SIMD_X86
+
+/*! \brief SSE2 32-bit floating point dot product kernel ( four 4-lane accumulators ) */
+__attribute__( ( target( "sse2" ) ) ) inline __fx32 __dot_sse2__( const __fx32 *x , const __fx32 *h , __ix32 n )
+{
+    __m128 a0 = _mm_setzero_ps() , a1 = _mm_setzero_ps() , a2 = _mm_setzero_ps() , a3 = _mm_setzero_ps();
+    __ix32 i = 0;
+    for( ; i + 15 < n ; i += 16 )
+    {
+        a0 = _mm_add_ps( a0 , _mm_mul_ps( _mm_loadu_ps( x + i +  0 ) , _mm_loadu_ps( h + i +  0 ) ) );
+        a1 = _mm_add_ps( a1 , _mm_mul_ps( _mm_loadu_ps( x + i +  4 ) , _mm_loadu_ps( h + i +  4 ) ) );
+        a2 = _mm_add_ps( a2 , _mm_mul_ps( _mm_loadu_ps( x + i +  8 ) , _mm_loadu_ps( h + i +  8 ) ) );
+        a3 = _mm_add_ps( a3 , _mm_mul_ps( _mm_loadu_ps( x + i + 12 ) , _mm_loadu_ps( h + i + 12 ) ) );
+    }
+    for( ; i + 3 < n ; i += 4 ) a0 = _mm_add_ps( a0 , _mm_mul_ps( _mm_loadu_ps( x + i ) , _mm_loadu_ps( h + i ) ) );
+
+    __fx32 r[4];
+    _mm_storeu_ps( r , _mm_add_ps( _mm_add_ps( a0 , a1 ) , _mm_add_ps( a2 , a3 ) ) );
+    __fx32 s = ( r[0] + r[1] ) + ( r[2] + r[3] );
+    for( ; i < n ; i++ ) s += x[i] * h[i];
+    return s;
+}
+
+/*! \brief SSE2 64-bit floating point dot product kernel ( four 2-lane accumulators ) */
+__attribute__( ( target( "sse2" ) ) ) inline __fx64 __dot_sse2__( const __fx64 *x , const __fx64 *h , __ix32 n )
+{
+    __m128d a0 = _mm_setzero_pd() , a1 = _mm_setzero_pd() , a2 = _mm_setzero_pd() , a3 = _mm_setzero_pd();
+    __ix32 i = 0;
+    for( ; i + 7 < n ; i += 8 )
+    {
+        a0 = _mm_add_pd( a0 , _mm_mul_pd( _mm_loadu_pd( x + i + 0 ) , _mm_loadu_pd( h + i + 0 ) ) );
+        a1 = _mm_add_pd( a1 , _mm_mul_pd( _mm_loadu_pd( x + i + 2 ) , _mm_loadu_pd( h + i + 2 ) ) );
+        a2 = _mm_add_pd( a2 , _mm_mul_pd( _mm_loadu_pd( x + i + 4 ) , _mm_loadu_pd( h + i + 4 ) ) );
+        a3 = _mm_add_pd( a3 , _mm_mul_pd( _mm_loadu_pd( x + i + 6 ) , _mm_loadu_pd( h + i + 6 ) ) );
+    }
+    for( ; i + 1 < n ; i += 2 ) a0 = _mm_add_pd( a0 , _mm_mul_pd( _mm_loadu_pd( x + i ) , _mm_loadu_pd( h + i ) ) );
+
+    __fx64 r[2];
+    _mm_storeu_pd( r , _mm_add_pd( _mm_add_pd( a0 , a1 ) , _mm_add_pd( a2 , a3 ) ) );
+    __fx64 s = r[0] + r[1];
+    for( ; i < n ; i++ ) s += x[i] * h[i];
+    return s;
+}
+
+/*! \brief AVX2 + FMA 32-bit floating point dot product kernel ( four 8-lane accumulators ) */
+__attribute__( ( target( "avx2,fma" ) ) ) inline __fx32 __dot_avx2__( const __fx32 *x , const __fx32 *h , __ix32 n )
+{
+    __m256 a0 = _mm256_setzero_ps() , a1 = _mm256_setzero_ps() , a2 = _mm256_setzero_ps() , a3 = _mm256_setzero_ps();
+    __ix32 i = 0;
+    for( ; i + 31 < n ; i += 32 )
+    {
+        a0 = _mm256_fmadd_ps( _mm256_loadu_ps( x + i +  0 ) , _mm256_loadu_ps( h + i +  0 ) , a0 );
+        a1 = _mm256_fmadd_ps( _mm256_loadu_ps( x + i +  8 ) , _mm256_loadu_ps( h + i +  8 ) , a1 );
+        a2 = _mm256_fmadd_ps( _mm256_loadu_ps( x + i + 16 ) , _mm256_loadu_ps( h + i + 16 ) , a2 );
+        a3 = _mm256_fmadd_ps( _mm256_loadu_ps( x + i + 24 ) , _mm256_loadu_ps( h + i + 24 ) , a3 );
+    }
+    for( ; i + 7 < n ; i += 8 ) a0 = _mm256_fmadd_ps( _mm256_loadu_ps( x + i ) , _mm256_loadu_ps( h + i ) , a0 );
+
+    __m256 a = _mm256_add_ps( _mm256_add_ps( a0 , a1 ) , _mm256_add_ps( a2 , a3 ) );
+    __m128 q = _mm_add_ps( _mm256_castps256_ps128( a ) , _mm256_extractf128_ps( a , 1 ) );
+    __fx32 r[4];
+    _mm_storeu_ps( r , q );
+    __fx32 s = ( r[0] + r[1] ) + ( r[2] + r[3] );
+    for( ; i < n ; i++ ) s += x[i] * h[i];
+    return s;
+}
+
+/*! \brief AVX2 + FMA 64-bit floating point dot product kernel ( four 4-lane accumulators ) */
+__attribute__( ( target( "avx2,fma" ) ) ) inline __fx64 __dot_avx2__( const __fx64 *x , const __fx64 *h , __ix32 n )
+{
+    __m256d a0 = _mm256_setzero_pd() , a1 = _mm256_setzero_pd() , a2 = _mm256_setzero_pd() , a3 = _mm256_setzero_pd();
+    __ix32 i = 0;
+    for( ; i + 15 < n ; i += 16 )
+    {
+        a0 = _mm256_fmadd_pd( _mm256_loadu_pd( x + i +  0 ) , _mm256_loadu_pd( h + i +  0 ) , a0 );
+        a1 = _mm256_fmadd_pd( _mm256_loadu_pd( x + i +  4 ) , _mm256_loadu_pd( h + i +  4 ) , a1 );
+        a2 = _mm256_fmadd_pd( _mm256_loadu_pd( x + i +  8 ) , _mm256_loadu_pd( h + i +  8 ) , a2 );
+        a3 = _mm256_fmadd_pd( _mm256_loadu_pd( x + i + 12 ) , _mm256_loadu_pd( h + i + 12 ) , a3 );
+    }
+    for( ; i + 3 < n ; i += 4 ) a0 = _mm256_fmadd_pd( _mm256_loadu_pd( x + i ) , _mm256_loadu_pd( h + i ) , a0 );
+
+    __fx64 r[4];
+    _mm256_storeu_pd( r , _mm256_add_pd( _mm256_add_pd( a0 , a1 ) , _mm256_add_pd( a2 , a3 ) ) );
+    __fx64 s = ( r[0] + r[1] ) + ( r[2] + r[3] );
+    for( ; i < n ; i++ ) s += x[i] * h[i];
+    return s;
+}
+
+/*! \brief AVX-512 32-bit floating point dot product kernel ( four 16-lane accumulators ) */
+__attribute__( ( target( "avx512f" ) ) ) inline __fx32 __dot_avx512__( const __fx32 *x , const __fx32 *h , __ix32 n )
+{
+    __m512 a0 = _mm512_setzero_ps() , a1 = _mm512_setzero_ps() , a2 = _mm512_setzero_ps() , a3 = _mm512_setzero_ps();
+    __ix32 i = 0;
+    for( ; i + 63 < n ; i += 64 )
+    {
+        a0 = _mm512_fmadd_ps( _mm512_loadu_ps( x + i +  0 ) , _mm512_loadu_ps( h + i +  0 ) , a0 );
+        a1 = _mm512_fmadd_ps( _mm512_loadu_ps( x + i + 16 ) , _mm512_loadu_ps( h + i + 16 ) , a1 );
+        a2 = _mm512_fmadd_ps( _mm512_loadu_ps( x + i + 32 ) , _mm512_loadu_ps( h + i + 32 ) , a2 );
+        a3 = _mm512_fmadd_ps( _mm512_loadu_ps( x + i + 48 ) , _mm512_loadu_ps( h + i + 48 ) , a3 );
+    }
+    for( ; i + 15 < n ; i += 16 ) a0 = _mm512_fmadd_ps( _mm512_loadu_ps( x + i ) , _mm512_loadu_ps( h + i ) , a0 );
+
+    // the tail is processed by means of the masked loads:
+    if( i < n )
+    {
+        __mmask16 m = ( __mmask16 )( ( 1u << ( n - i ) ) - 1 );
+        a1 = _mm512_fmadd_ps( _mm512_maskz_loadu_ps( m , x + i ) , _mm512_maskz_loadu_ps( m , h + i ) , a1 );
+    }
+
+    // horizontal sum by means of the register halves folding:
+    __m512 a = _mm512_add_ps( _mm512_add_ps( a0 , a1 ) , _mm512_add_ps( a2 , a3 ) );
+    __m256 q = _mm256_add_ps( _mm256_castpd_ps( _mm512_maskz_extractf64x4_pd( 0xFF , _mm512_castps_pd( a ) , 0 ) ) ,
+                              _mm256_castpd_ps( _mm512_maskz_extractf64x4_pd( 0xFF , _mm512_castps_pd( a ) , 1 ) ) );
+    __fx32 r[4];
+    _mm_storeu_ps( r , _mm_add_ps( _mm256_castps256_ps128( q ) , _mm256_extractf128_ps( q , 1 ) ) );
+    return ( r[0] + r[1] ) + ( r[2] + r[3] );
+}
+
+/*! \brief AVX-512 64-bit floating point dot product kernel ( four 8-lane accumulators ) */
+__attribute__( ( target( "avx512f" ) ) ) inline __fx64 __dot_avx512__( const __fx64 *x , const __fx64 *h , __ix32 n )
+{
+    __m512d a0 = _mm512_setzero_pd() , a1 = _mm512_setzero_pd() , a2 = _mm512_setzero_pd() , a3 = _mm512_setzero_pd();
+    __ix32 i = 0;
+    for( ; i + 31 < n ; i += 32 )
+    {
+        a0 = _mm512_fmadd_pd( _mm512_loadu_pd( x + i +  0 ) , _mm512_loadu_pd( h + i +  0 ) , a0 );
+        a1 = _mm512_fmadd_pd( _mm512_loadu_pd( x + i +  8 ) , _mm512_loadu_pd( h + i +  8 ) , a1 );
+        a2 = _mm512_fmadd_pd( _mm512_loadu_pd( x + i + 16 ) , _mm512_loadu_pd( h + i + 16 ) , a2 );
+        a3 = _mm512_fmadd_pd( _mm512_loadu_pd( x + i + 24 ) , _mm512_loadu_pd( h + i + 24 ) , a3 );
+    }
+    for( ; i + 7 < n ; i += 8 ) a0 = _mm512_fmadd_pd( _mm512_loadu_pd( x + i ) , _mm512_loadu_pd( h + i ) , a0 );
+
+    // the tail is processed by means of the masked loads:
+    if( i < n )
+    {
+        __mmask8 m = ( __mmask8 )( ( 1u << ( n - i ) ) - 1 );
+        a1 = _mm512_fmadd_pd( _mm512_maskz_loadu_pd( m , x + i ) , _mm512_maskz_loadu_pd( m , h + i ) , a1 );
+    }
+
+    // horizontal sum by means of the register halves folding:
+    __m512d a = _mm512_add_pd( _mm512_add_pd( a0 , a1 ) , _mm512_add_pd( a2 , a3 ) );
+    __fx64 r[4];
+    _mm256_storeu_pd( r , _mm256_add_pd( _mm512_maskz_extractf64x4_pd( 0xFF , a , 0 ) , _mm512_maskz_extractf64x4_pd( 0xFF , a , 1 ) ) );
+    return ( r[0] + r[1] ) + ( r[2] + r[3] );
+}
+
+
+/*! \brief SSE2 32-bit floating point folded dot product kernel ( four 4-lane accumulators , the mirrored samples are reversed by means of the shuffle ) */
+__attribute__( ( target( "sse2" ) ) ) inline __fx32 __fold_dot_sse2__( const __fx32 *x , const __fx32 *h , __ix32 n , __ix32 s )
+{
+    __m128 a0 = _mm_setzero_ps() , a1 = _mm_setzero_ps() , a2 = _mm_setzero_ps() , a3 = _mm_setzero_ps() , sv = _mm_set1_ps( ( __fx32 )s );
+    __ix32 i = 0 , m = n / 2;
+    for( ; i + 15 < m ; i += 16 )
+    {
+        __m128 r0 = _mm_loadu_ps( x + n - 4 - i ) , r1 = _mm_loadu_ps( x + n - 8 - i ) , r2 = _mm_loadu_ps( x + n - 12 - i ) , r3 = _mm_loadu_ps( x + n - 16 - i );
+        a0 = _mm_add_ps( a0 , _mm_mul_ps( _mm_add_ps( _mm_loadu_ps( x + i + 0 ) , _mm_mul_ps( sv , _mm_shuffle_ps( r0 , r0 , 0x1B ) ) ) , _mm_loadu_ps( h + i + 0 ) ) );
+        a1 = _mm_add_ps( a1 , _mm_mul_ps( _mm_add_ps( _mm_loadu_ps( x + i + 4 ) , _mm_mul_ps( sv , _mm_shuffle_ps( r1 , r1 , 0x1B ) ) ) , _mm_loadu_ps( h + i + 4 ) ) );
+        a2 = _mm_add_ps( a2 , _mm_mul_ps( _mm_add_ps( _mm_loadu_ps( x + i + 8 ) , _mm_mul_ps( sv , _mm_shuffle_ps( r2 , r2 , 0x1B ) ) ) , _mm_loadu_ps( h + i + 8 ) ) );
+        a3 = _mm_add_ps( a3 , _mm_mul_ps( _mm_add_ps( _mm_loadu_ps( x + i + 12 ) , _mm_mul_ps( sv , _mm_shuffle_ps( r3 , r3 , 0x1B ) ) ) , _mm_loadu_ps( h + i + 12 ) ) );
+    }
+    for( ; i + 3 < m ; i += 4 )
+    {
+        __m128 r0 = _mm_loadu_ps( x + n - 4 - i );
+        a0 = _mm_add_ps( a0 , _mm_mul_ps( _mm_add_ps( _mm_loadu_ps( x + i ) , _mm_mul_ps( sv , _mm_shuffle_ps( r0 , r0 , 0x1B ) ) ) , _mm_loadu_ps( h + i ) ) );
+    }
+
+    __m128 a = _mm_add_ps( _mm_add_ps( a0 , a1 ) , _mm_add_ps( a2 , a3 ) );
+    __fx32 r[4];
+    _mm_storeu_ps( r , a );
+    __fx32 y = ( r[0] + r[1] ) + ( r[2] + r[3] );
+    for( ; i < m ; i++ ) y += ( x[i] + s * x[n - 1 - i] ) * h[i];
+    if( n % 2 != 0 ) y += x[m] * h[m];
+    return y;
+}
+
+/*! \brief SSE2 64-bit floating point folded dot product kernel ( four 2-lane accumulators , the mirrored samples are reversed by means of the shuffle ) */
+__attribute__( ( target( "sse2" ) ) ) inline __fx64 __fold_dot_sse2__( const __fx64 *x , const __fx64 *h , __ix32 n , __ix32 s )
+{
+    __m128d a0 = _mm_setzero_pd() , a1 = _mm_setzero_pd() , a2 = _mm_setzero_pd() , a3 = _mm_setzero_pd() , sv = _mm_set1_pd( ( __fx64 )s );
+    __ix32 i = 0 , m = n / 2;
+    for( ; i + 7 < m ; i += 8 )
+    {
+        __m128d r0 = _mm_loadu_pd( x + n - 2 - i ) , r1 = _mm_loadu_pd( x + n - 4 - i ) , r2 = _mm_loadu_pd( x + n - 6 - i ) , r3 = _mm_loadu_pd( x + n - 8 - i );
+        a0 = _mm_add_pd( a0 , _mm_mul_pd( _mm_add_pd( _mm_loadu_pd( x + i + 0 ) , _mm_mul_pd( sv , _mm_shuffle_pd( r0 , r0 , 1 ) ) ) , _mm_loadu_pd( h + i + 0 ) ) );
+        a1 = _mm_add_pd( a1 , _mm_mul_pd( _mm_add_pd( _mm_loadu_pd( x + i + 2 ) , _mm_mul_pd( sv , _mm_shuffle_pd( r1 , r1 , 1 ) ) ) , _mm_loadu_pd( h + i + 2 ) ) );
+        a2 = _mm_add_pd( a2 , _mm_mul_pd( _mm_add_pd( _mm_loadu_pd( x + i + 4 ) , _mm_mul_pd( sv , _mm_shuffle_pd( r2 , r2 , 1 ) ) ) , _mm_loadu_pd( h + i + 4 ) ) );
+        a3 = _mm_add_pd( a3 , _mm_mul_pd( _mm_add_pd( _mm_loadu_pd( x + i + 6 ) , _mm_mul_pd( sv , _mm_shuffle_pd( r3 , r3 , 1 ) ) ) , _mm_loadu_pd( h + i + 6 ) ) );
+    }
+    for( ; i + 1 < m ; i += 2 )
+    {
+        __m128d r0 = _mm_loadu_pd( x + n - 2 - i );
+        a0 = _mm_add_pd( a0 , _mm_mul_pd( _mm_add_pd( _mm_loadu_pd( x + i ) , _mm_mul_pd( sv , _mm_shuffle_pd( r0 , r0 , 1 ) ) ) , _mm_loadu_pd( h + i ) ) );
+    }
+
+    __m128d a = _mm_add_pd( _mm_add_pd( a0 , a1 ) , _mm_add_pd( a2 , a3 ) );
+    __fx64 r[2];
+    _mm_storeu_pd( r , a );
+    __fx64 y = r[0] + r[1];
+    for( ; i < m ; i++ ) y += ( x[i] + s * x[n - 1 - i] ) * h[i];
+    if( n % 2 != 0 ) y += x[m] * h[m];
+    return y;
+}
+
+/*! \brief AVX2 + FMA 32-bit floating point folded dot product kernel ( four 8-lane accumulators , the mirrored samples are reversed by means of the permutation ) */
+__attribute__( ( target( "avx2,fma" ) ) ) inline __fx32 __fold_dot_avx2__( const __fx32 *x , const __fx32 *h , __ix32 n , __ix32 s )
+{
+    __m256 a0 = _mm256_setzero_ps() , a1 = _mm256_setzero_ps() , a2 = _mm256_setzero_ps() , a3 = _mm256_setzero_ps() , sv = _mm256_set1_ps( ( __fx32 )s );
+    __m256i rv = _mm256_set_epi32( 0 , 1 , 2 , 3 , 4 , 5 , 6 , 7 );
+    __ix32 i = 0 , m = n / 2;
+    for( ; i + 31 < m ; i += 32 )
+    {
+        __m256 r0 = _mm256_loadu_ps( x + n - 8 - i ) , r1 = _mm256_loadu_ps( x + n - 16 - i ) , r2 = _mm256_loadu_ps( x + n - 24 - i ) , r3 = _mm256_loadu_ps( x + n - 32 - i );
+        a0 = _mm256_fmadd_ps( _mm256_fmadd_ps( sv , _mm256_permutevar8x32_ps( r0 , rv ) , _mm256_loadu_ps( x + i + 0 ) ) , _mm256_loadu_ps( h + i + 0 ) , a0 );
+        a1 = _mm256_fmadd_ps( _mm256_fmadd_ps( sv , _mm256_permutevar8x32_ps( r1 , rv ) , _mm256_loadu_ps( x + i + 8 ) ) , _mm256_loadu_ps( h + i + 8 ) , a1 );
+        a2 = _mm256_fmadd_ps( _mm256_fmadd_ps( sv , _mm256_permutevar8x32_ps( r2 , rv ) , _mm256_loadu_ps( x + i + 16 ) ) , _mm256_loadu_ps( h + i + 16 ) , a2 );
+        a3 = _mm256_fmadd_ps( _mm256_fmadd_ps( sv , _mm256_permutevar8x32_ps( r3 , rv ) , _mm256_loadu_ps( x + i + 24 ) ) , _mm256_loadu_ps( h + i + 24 ) , a3 );
+    }
+    for( ; i + 7 < m ; i += 8 )
+    {
+        __m256 r0 = _mm256_loadu_ps( x + n - 8 - i );
+        a0 = _mm256_fmadd_ps( _mm256_fmadd_ps( sv , _mm256_permutevar8x32_ps( r0 , rv ) , _mm256_loadu_ps( x + i ) ) , _mm256_loadu_ps( h + i ) , a0 );
+    }
+
+    __m256 a = _mm256_add_ps( _mm256_add_ps( a0 , a1 ) , _mm256_add_ps( a2 , a3 ) );
+    __fx32 r[4];
+    _mm_storeu_ps( r , _mm_add_ps( _mm256_castps256_ps128( a ) , _mm256_extractf128_ps( a , 1 ) ) );
+    __fx32 y = ( r[0] + r[1] ) + ( r[2] + r[3] );
+    for( ; i < m ; i++ ) y += ( x[i] + s * x[n - 1 - i] ) * h[i];
+    if( n % 2 != 0 ) y += x[m] * h[m];
+    return y;
+}
+
+/*! \brief AVX2 + FMA 64-bit floating point folded dot product kernel ( four 4-lane accumulators , the mirrored samples are reversed by means of the permutation ) */
+__attribute__( ( target( "avx2,fma" ) ) ) inline __fx64 __fold_dot_avx2__( const __fx64 *x , const __fx64 *h , __ix32 n , __ix32 s )
+{
+    __m256d a0 = _mm256_setzero_pd() , a1 = _mm256_setzero_pd() , a2 = _mm256_setzero_pd() , a3 = _mm256_setzero_pd() , sv = _mm256_set1_pd( ( __fx64 )s );
+    __ix32 i = 0 , m = n / 2;
+    for( ; i + 15 < m ; i += 16 )
+    {
+        __m256d r0 = _mm256_loadu_pd( x + n - 4 - i ) , r1 = _mm256_loadu_pd( x + n - 8 - i ) , r2 = _mm256_loadu_pd( x + n - 12 - i ) , r3 = _mm256_loadu_pd( x + n - 16 - i );
+        a0 = _mm256_fmadd_pd( _mm256_fmadd_pd( sv , _mm256_permute4x64_pd( r0 , 0x1B ) , _mm256_loadu_pd( x + i + 0 ) ) , _mm256_loadu_pd( h + i + 0 ) , a0 );
+        a1 = _mm256_fmadd_pd( _mm256_fmadd_pd( sv , _mm256_permute4x64_pd( r1 , 0x1B ) , _mm256_loadu_pd( x + i + 4 ) ) , _mm256_loadu_pd( h + i + 4 ) , a1 );
+        a2 = _mm256_fmadd_pd( _mm256_fmadd_pd( sv , _mm256_permute4x64_pd( r2 , 0x1B ) , _mm256_loadu_pd( x + i + 8 ) ) , _mm256_loadu_pd( h + i + 8 ) , a2 );
+        a3 = _mm256_fmadd_pd( _mm256_fmadd_pd( sv , _mm256_permute4x64_pd( r3 , 0x1B ) , _mm256_loadu_pd( x + i + 12 ) ) , _mm256_loadu_pd( h + i + 12 ) , a3 );
+    }
+    for( ; i + 3 < m ; i += 4 )
+    {
+        __m256d r0 = _mm256_loadu_pd( x + n - 4 - i );
+        a0 = _mm256_fmadd_pd( _mm256_fmadd_pd( sv , _mm256_permute4x64_pd( r0 , 0x1B ) , _mm256_loadu_pd( x + i ) ) , _mm256_loadu_pd( h + i ) , a0 );
+    }
+
+    __m256d a = _mm256_add_pd( _mm256_add_pd( a0 , a1 ) , _mm256_add_pd( a2 , a3 ) );
+    __fx64 r[2];
+    _mm_storeu_pd( r , _mm_add_pd( _mm256_castpd256_pd128( a ) , _mm256_extractf128_pd( a , 1 ) ) );
+    __fx64 y = r[0] + r[1];
+    for( ; i < m ; i++ ) y += ( x[i] + s * x[n - 1 - i] ) * h[i];
+    if( n % 2 != 0 ) y += x[m] * h[m];
+    return y;
+}
+
+/*! \brief AVX-512 32-bit floating point folded dot product kernel ( four 16-lane accumulators , the mirrored samples are reversed by means of the permutation ) */
+__attribute__( ( target( "avx512f" ) ) ) inline __fx32 __fold_dot_avx512__( const __fx32 *x , const __fx32 *h , __ix32 n , __ix32 s )
+{
+    __m512 a0 = _mm512_setzero_ps() , a1 = _mm512_setzero_ps() , a2 = _mm512_setzero_ps() , a3 = _mm512_setzero_ps() , sv = _mm512_set1_ps( ( __fx32 )s );
+    __m512i rv = _mm512_set_epi32( 0 , 1 , 2 , 3 , 4 , 5 , 6 , 7 , 8 , 9 , 10 , 11 , 12 , 13 , 14 , 15 );
+    __ix32 i = 0 , m = n / 2;
+    for( ; i + 63 < m ; i += 64 )
+    {
+        __m512 r0 = _mm512_loadu_ps( x + n - 16 - i ) , r1 = _mm512_loadu_ps( x + n - 32 - i ) , r2 = _mm512_loadu_ps( x + n - 48 - i ) , r3 = _mm512_loadu_ps( x + n - 64 - i );
+        a0 = _mm512_fmadd_ps( _mm512_fmadd_ps( sv , _mm512_maskz_permutexvar_ps( 0xFFFF , rv , r0 ) , _mm512_loadu_ps( x + i + 0 ) ) , _mm512_loadu_ps( h + i + 0 ) , a0 );
+        a1 = _mm512_fmadd_ps( _mm512_fmadd_ps( sv , _mm512_maskz_permutexvar_ps( 0xFFFF , rv , r1 ) , _mm512_loadu_ps( x + i + 16 ) ) , _mm512_loadu_ps( h + i + 16 ) , a1 );
+        a2 = _mm512_fmadd_ps( _mm512_fmadd_ps( sv , _mm512_maskz_permutexvar_ps( 0xFFFF , rv , r2 ) , _mm512_loadu_ps( x + i + 32 ) ) , _mm512_loadu_ps( h + i + 32 ) , a2 );
+        a3 = _mm512_fmadd_ps( _mm512_fmadd_ps( sv , _mm512_maskz_permutexvar_ps( 0xFFFF , rv , r3 ) , _mm512_loadu_ps( x + i + 48 ) ) , _mm512_loadu_ps( h + i + 48 ) , a3 );
+    }
+    for( ; i + 15 < m ; i += 16 )
+    {
+        __m512 r0 = _mm512_loadu_ps( x + n - 16 - i );
+        a0 = _mm512_fmadd_ps( _mm512_fmadd_ps( sv , _mm512_maskz_permutexvar_ps( 0xFFFF , rv , r0 ) , _mm512_loadu_ps( x + i ) ) , _mm512_loadu_ps( h + i ) , a0 );
+    }
+
+    __m512 a = _mm512_add_ps( _mm512_add_ps( a0 , a1 ) , _mm512_add_ps( a2 , a3 ) );
+    __m256 q = _mm256_add_ps( _mm256_castpd_ps( _mm512_maskz_extractf64x4_pd( 0xFF , _mm512_castps_pd( a ) , 0 ) ) ,
+                              _mm256_castpd_ps( _mm512_maskz_extractf64x4_pd( 0xFF , _mm512_castps_pd( a ) , 1 ) ) );
+    __fx32 r[4];
+    _mm_storeu_ps( r , _mm_add_ps( _mm256_castps256_ps128( q ) , _mm256_extractf128_ps( q , 1 ) ) );
+    __fx32 y = ( r[0] + r[1] ) + ( r[2] + r[3] );
+    for( ; i < m ; i++ ) y += ( x[i] + s * x[n - 1 - i] ) * h[i];
+    if( n % 2 != 0 ) y += x[m] * h[m];
+    return y;
+}
+
+/*! \brief AVX-512 64-bit floating point folded dot product kernel ( four 8-lane accumulators , the mirrored samples are reversed by means of the permutation ) */
+__attribute__( ( target( "avx512f" ) ) ) inline __fx64 __fold_dot_avx512__( const __fx64 *x , const __fx64 *h , __ix32 n , __ix32 s )
+{
+    __m512d a0 = _mm512_setzero_pd() , a1 = _mm512_setzero_pd() , a2 = _mm512_setzero_pd() , a3 = _mm512_setzero_pd() , sv = _mm512_set1_pd( ( __fx64 )s );
+    __m512i rv = _mm512_set_epi64( 0 , 1 , 2 , 3 , 4 , 5 , 6 , 7 );
+    __ix32 i = 0 , m = n / 2;
+    for( ; i + 31 < m ; i += 32 )
+    {
+        __m512d r0 = _mm512_loadu_pd( x + n - 8 - i ) , r1 = _mm512_loadu_pd( x + n - 16 - i ) , r2 = _mm512_loadu_pd( x + n - 24 - i ) , r3 = _mm512_loadu_pd( x + n - 32 - i );
+        a0 = _mm512_fmadd_pd( _mm512_fmadd_pd( sv , _mm512_maskz_permutexvar_pd( 0xFF , rv , r0 ) , _mm512_loadu_pd( x + i + 0 ) ) , _mm512_loadu_pd( h + i + 0 ) , a0 );
+        a1 = _mm512_fmadd_pd( _mm512_fmadd_pd( sv , _mm512_maskz_permutexvar_pd( 0xFF , rv , r1 ) , _mm512_loadu_pd( x + i + 8 ) ) , _mm512_loadu_pd( h + i + 8 ) , a1 );
+        a2 = _mm512_fmadd_pd( _mm512_fmadd_pd( sv , _mm512_maskz_permutexvar_pd( 0xFF , rv , r2 ) , _mm512_loadu_pd( x + i + 16 ) ) , _mm512_loadu_pd( h + i + 16 ) , a2 );
+        a3 = _mm512_fmadd_pd( _mm512_fmadd_pd( sv , _mm512_maskz_permutexvar_pd( 0xFF , rv , r3 ) , _mm512_loadu_pd( x + i + 24 ) ) , _mm512_loadu_pd( h + i + 24 ) , a3 );
+    }
+    for( ; i + 7 < m ; i += 8 )
+    {
+        __m512d r0 = _mm512_loadu_pd( x + n - 8 - i );
+        a0 = _mm512_fmadd_pd( _mm512_fmadd_pd( sv , _mm512_maskz_permutexvar_pd( 0xFF , rv , r0 ) , _mm512_loadu_pd( x + i ) ) , _mm512_loadu_pd( h + i ) , a0 );
+    }
+
+    __m512d a = _mm512_add_pd( _mm512_add_pd( a0 , a1 ) , _mm512_add_pd( a2 , a3 ) );
+    __fx64 r[4];
+    _mm256_storeu_pd( r , _mm256_add_pd( _mm512_maskz_extractf64x4_pd( 0xFF , a , 0 ) , _mm512_maskz_extractf64x4_pd( 0xFF , a , 1 ) ) );
+    __fx64 y = ( r[0] + r[1] ) + ( r[2] + r[3] );
+    for( ; i < m ; i++ ) y += ( x[i] + s * x[n - 1 - i] ) * h[i];
+    if( n % 2 != 0 ) y += x[m] * h[m];
+    return y;
+}
+
+/*! \brief SSE2 32-bit floating point channels bank dot product kernel ( four 4-lane channel accumulators ) */
+__attribute__( ( target( "sse2" ) ) ) inline void __bank_dot_sse2__( const __fx32 *x , const __fx32 *h , __ix32 n , __ix32 c , __fx32 *y )
+{
+    __ix32 j = 0;
+    for( ; j + 15 < c ; j += 16 )
+    {
+        __m128 a0 = _mm_setzero_ps() , a1 = _mm_setzero_ps() , a2 = _mm_setzero_ps() , a3 = _mm_setzero_ps();
+        for( __ix32 i = 0 ; i < n ; i++ )
+        {
+            const __fx32 *r = x + i * c + j;
+            __m128 hv = _mm_set1_ps( h[i] );
+            a0 = _mm_add_ps( a0 , _mm_mul_ps( _mm_loadu_ps( r ) , hv ) );
+            a1 = _mm_add_ps( a1 , _mm_mul_ps( _mm_loadu_ps( r + 4 ) , hv ) );
+            a2 = _mm_add_ps( a2 , _mm_mul_ps( _mm_loadu_ps( r + 8 ) , hv ) );
+            a3 = _mm_add_ps( a3 , _mm_mul_ps( _mm_loadu_ps( r + 12 ) , hv ) );
+        }
+        _mm_storeu_ps( y + j , a0 );
+        _mm_storeu_ps( y + j + 4 , a1 );
+        _mm_storeu_ps( y + j + 8 , a2 );
+        _mm_storeu_ps( y + j + 12 , a3 );
+    }
+    for( ; j + 3 < c ; j += 4 )
+    {
+        __m128 a0 = _mm_setzero_ps() , a1 = _mm_setzero_ps() , a2 = _mm_setzero_ps() , a3 = _mm_setzero_ps();
+        __ix32 i = 0;
+        for( ; i + 3 < n ; i += 4 )
+        {
+            a0 = _mm_add_ps( a0 , _mm_mul_ps( _mm_loadu_ps( x + ( i + 0 ) * c + j ) , _mm_set1_ps( h[i + 0] ) ) );
+            a1 = _mm_add_ps( a1 , _mm_mul_ps( _mm_loadu_ps( x + ( i + 1 ) * c + j ) , _mm_set1_ps( h[i + 1] ) ) );
+            a2 = _mm_add_ps( a2 , _mm_mul_ps( _mm_loadu_ps( x + ( i + 2 ) * c + j ) , _mm_set1_ps( h[i + 2] ) ) );
+            a3 = _mm_add_ps( a3 , _mm_mul_ps( _mm_loadu_ps( x + ( i + 3 ) * c + j ) , _mm_set1_ps( h[i + 3] ) ) );
+        }
+        for( ; i < n ; i++ ) a0 = _mm_add_ps( a0 , _mm_mul_ps( _mm_loadu_ps( x + i * c + j ) , _mm_set1_ps( h[i] ) ) );
+        __m128 a = _mm_add_ps( _mm_add_ps( a0 , a1 ) , _mm_add_ps( a2 , a3 ) );
+        _mm_storeu_ps( y + j , a );
+    }
+    for( ; j < c ; j++ )
+    {
+        __fx32 s0 = 0 , s1 = 0 , s2 = 0 , s3 = 0;
+        __ix32 i = 0;
+        for( ; i + 3 < n ; i += 4 )
+        {
+            s0 += x[ ( i + 0 ) * c + j ] * h[i + 0];
+            s1 += x[ ( i + 1 ) * c + j ] * h[i + 1];
+            s2 += x[ ( i + 2 ) * c + j ] * h[i + 2];
+            s3 += x[ ( i + 3 ) * c + j ] * h[i + 3];
+        }
+        for( ; i < n ; i++ ) s0 += x[ i * c + j ] * h[i];
+        y[j] = ( s0 + s1 ) + ( s2 + s3 );
+    }
+}
+
+/*! \brief SSE2 64-bit floating point channels bank dot product kernel ( four 2-lane channel accumulators ) */
+__attribute__( ( target( "sse2" ) ) ) inline void __bank_dot_sse2__( const __fx64 *x , const __fx64 *h , __ix32 n , __ix32 c , __fx64 *y )
+{
+    __ix32 j = 0;
+    for( ; j + 7 < c ; j += 8 )
+    {
+        __m128d a0 = _mm_setzero_pd() , a1 = _mm_setzero_pd() , a2 = _mm_setzero_pd() , a3 = _mm_setzero_pd();
+        for( __ix32 i = 0 ; i < n ; i++ )
+        {
+            const __fx64 *r = x + i * c + j;
+            __m128d hv = _mm_set1_pd( h[i] );
+            a0 = _mm_add_pd( a0 , _mm_mul_pd( _mm_loadu_pd( r ) , hv ) );
+            a1 = _mm_add_pd( a1 , _mm_mul_pd( _mm_loadu_pd( r + 2 ) , hv ) );
+            a2 = _mm_add_pd( a2 , _mm_mul_pd( _mm_loadu_pd( r + 4 ) , hv ) );
+            a3 = _mm_add_pd( a3 , _mm_mul_pd( _mm_loadu_pd( r + 6 ) , hv ) );
+        }
+        _mm_storeu_pd( y + j , a0 );
+        _mm_storeu_pd( y + j + 2 , a1 );
+        _mm_storeu_pd( y + j + 4 , a2 );
+        _mm_storeu_pd( y + j + 6 , a3 );
+    }
+    for( ; j + 1 < c ; j += 2 )
+    {
+        __m128d a0 = _mm_setzero_pd() , a1 = _mm_setzero_pd() , a2 = _mm_setzero_pd() , a3 = _mm_setzero_pd();
+        __ix32 i = 0;
+        for( ; i + 3 < n ; i += 4 )
+        {
+            a0 = _mm_add_pd( a0 , _mm_mul_pd( _mm_loadu_pd( x + ( i + 0 ) * c + j ) , _mm_set1_pd( h[i + 0] ) ) );
+            a1 = _mm_add_pd( a1 , _mm_mul_pd( _mm_loadu_pd( x + ( i + 1 ) * c + j ) , _mm_set1_pd( h[i + 1] ) ) );
+            a2 = _mm_add_pd( a2 , _mm_mul_pd( _mm_loadu_pd( x + ( i + 2 ) * c + j ) , _mm_set1_pd( h[i + 2] ) ) );
+            a3 = _mm_add_pd( a3 , _mm_mul_pd( _mm_loadu_pd( x + ( i + 3 ) * c + j ) , _mm_set1_pd( h[i + 3] ) ) );
+        }
+        for( ; i < n ; i++ ) a0 = _mm_add_pd( a0 , _mm_mul_pd( _mm_loadu_pd( x + i * c + j ) , _mm_set1_pd( h[i] ) ) );
+        __m128d a = _mm_add_pd( _mm_add_pd( a0 , a1 ) , _mm_add_pd( a2 , a3 ) );
+        _mm_storeu_pd( y + j , a );
+    }
+    for( ; j < c ; j++ )
+    {
+        __fx64 s0 = 0 , s1 = 0 , s2 = 0 , s3 = 0;
+        __ix32 i = 0;
+        for( ; i + 3 < n ; i += 4 )
+        {
+            s0 += x[ ( i + 0 ) * c + j ] * h[i + 0];
+            s1 += x[ ( i + 1 ) * c + j ] * h[i + 1];
+            s2 += x[ ( i + 2 ) * c + j ] * h[i + 2];
+            s3 += x[ ( i + 3 ) * c + j ] * h[i + 3];
+        }
+        for( ; i < n ; i++ ) s0 += x[ i * c + j ] * h[i];
+        y[j] = ( s0 + s1 ) + ( s2 + s3 );
+    }
+}
+
+/*! \brief AVX2 + FMA 32-bit floating point channels bank dot product kernel ( four 8-lane channel accumulators ) */
+__attribute__( ( target( "avx2,fma" ) ) ) inline void __bank_dot_avx2__( const __fx32 *x , const __fx32 *h , __ix32 n , __ix32 c , __fx32 *y )
+{
+    __ix32 j = 0;
+    for( ; j + 31 < c ; j += 32 )
+    {
+        __m256 a0 = _mm256_setzero_ps() , a1 = _mm256_setzero_ps() , a2 = _mm256_setzero_ps() , a3 = _mm256_setzero_ps();
+        for( __ix32 i = 0 ; i < n ; i++ )
+        {
+            const __fx32 *r = x + i * c + j;
+            __m256 hv = _mm256_set1_ps( h[i] );
+            a0 = _mm256_fmadd_ps( _mm256_loadu_ps( r ) , hv , a0 );
+            a1 = _mm256_fmadd_ps( _mm256_loadu_ps( r + 8 ) , hv , a1 );
+            a2 = _mm256_fmadd_ps( _mm256_loadu_ps( r + 16 ) , hv , a2 );
+            a3 = _mm256_fmadd_ps( _mm256_loadu_ps( r + 24 ) , hv , a3 );
+        }
+        _mm256_storeu_ps( y + j , a0 );
+        _mm256_storeu_ps( y + j + 8 , a1 );
+        _mm256_storeu_ps( y + j + 16 , a2 );
+        _mm256_storeu_ps( y + j + 24 , a3 );
+    }
+    for( ; j + 7 < c ; j += 8 )
+    {
+        __m256 a0 = _mm256_setzero_ps() , a1 = _mm256_setzero_ps() , a2 = _mm256_setzero_ps() , a3 = _mm256_setzero_ps();
+        __ix32 i = 0;
+        for( ; i + 3 < n ; i += 4 )
+        {
+            a0 = _mm256_fmadd_ps( _mm256_loadu_ps( x + ( i + 0 ) * c + j ) , _mm256_set1_ps( h[i + 0] ) , a0 );
+            a1 = _mm256_fmadd_ps( _mm256_loadu_ps( x + ( i + 1 ) * c + j ) , _mm256_set1_ps( h[i + 1] ) , a1 );
+            a2 = _mm256_fmadd_ps( _mm256_loadu_ps( x + ( i + 2 ) * c + j ) , _mm256_set1_ps( h[i + 2] ) , a2 );
+            a3 = _mm256_fmadd_ps( _mm256_loadu_ps( x + ( i + 3 ) * c + j ) , _mm256_set1_ps( h[i + 3] ) , a3 );
+        }
+        for( ; i < n ; i++ ) a0 = _mm256_fmadd_ps( _mm256_loadu_ps( x + i * c + j ) , _mm256_set1_ps( h[i] ) , a0 );
+        __m256 a = _mm256_add_ps( _mm256_add_ps( a0 , a1 ) , _mm256_add_ps( a2 , a3 ) );
+        _mm256_storeu_ps( y + j , a );
+    }
+    for( ; j < c ; j++ )
+    {
+        __fx32 s0 = 0 , s1 = 0 , s2 = 0 , s3 = 0;
+        __ix32 i = 0;
+        for( ; i + 3 < n ; i += 4 )
+        {
+            s0 += x[ ( i + 0 ) * c + j ] * h[i + 0];
+            s1 += x[ ( i + 1 ) * c + j ] * h[i + 1];
+            s2 += x[ ( i + 2 ) * c + j ] * h[i + 2];
+            s3 += x[ ( i + 3 ) * c + j ] * h[i + 3];
+        }
+        for( ; i < n ; i++ ) s0 += x[ i * c + j ] * h[i];
+        y[j] = ( s0 + s1 ) + ( s2 + s3 );
+    }
+}
+
+/*! \brief AVX2 + FMA 64-bit floating point channels bank dot product kernel ( four 4-lane channel accumulators ) */
+__attribute__( ( target( "avx2,fma" ) ) ) inline void __bank_dot_avx2__( const __fx64 *x , const __fx64 *h , __ix32 n , __ix32 c , __fx64 *y )
+{
+    __ix32 j = 0;
+    for( ; j + 15 < c ; j += 16 )
+    {
+        __m256d a0 = _mm256_setzero_pd() , a1 = _mm256_setzero_pd() , a2 = _mm256_setzero_pd() , a3 = _mm256_setzero_pd();
+        for( __ix32 i = 0 ; i < n ; i++ )
+        {
+            const __fx64 *r = x + i * c + j;
+            __m256d hv = _mm256_set1_pd( h[i] );
+            a0 = _mm256_fmadd_pd( _mm256_loadu_pd( r ) , hv , a0 );
+            a1 = _mm256_fmadd_pd( _mm256_loadu_pd( r + 4 ) , hv , a1 );
+            a2 = _mm256_fmadd_pd( _mm256_loadu_pd( r + 8 ) , hv , a2 );
+            a3 = _mm256_fmadd_pd( _mm256_loadu_pd( r + 12 ) , hv , a3 );
+        }
+        _mm256_storeu_pd( y + j , a0 );
+        _mm256_storeu_pd( y + j + 4 , a1 );
+        _mm256_storeu_pd( y + j + 8 , a2 );
+        _mm256_storeu_pd( y + j + 12 , a3 );
+    }
+    for( ; j + 3 < c ; j += 4 )
+    {
+        __m256d a0 = _mm256_setzero_pd() , a1 = _mm256_setzero_pd() , a2 = _mm256_setzero_pd() , a3 = _mm256_setzero_pd();
+        __ix32 i = 0;
+        for( ; i + 3 < n ; i += 4 )
+        {
+            a0 = _mm256_fmadd_pd( _mm256_loadu_pd( x + ( i + 0 ) * c + j ) , _mm256_set1_pd( h[i + 0] ) , a0 );
+            a1 = _mm256_fmadd_pd( _mm256_loadu_pd( x + ( i + 1 ) * c + j ) , _mm256_set1_pd( h[i + 1] ) , a1 );
+            a2 = _mm256_fmadd_pd( _mm256_loadu_pd( x + ( i + 2 ) * c + j ) , _mm256_set1_pd( h[i + 2] ) , a2 );
+            a3 = _mm256_fmadd_pd( _mm256_loadu_pd( x + ( i + 3 ) * c + j ) , _mm256_set1_pd( h[i + 3] ) , a3 );
+        }
+        for( ; i < n ; i++ ) a0 = _mm256_fmadd_pd( _mm256_loadu_pd( x + i * c + j ) , _mm256_set1_pd( h[i] ) , a0 );
+        __m256d a = _mm256_add_pd( _mm256_add_pd( a0 , a1 ) , _mm256_add_pd( a2 , a3 ) );
+        _mm256_storeu_pd( y + j , a );
+    }
+    for( ; j < c ; j++ )
+    {
+        __fx64 s0 = 0 , s1 = 0 , s2 = 0 , s3 = 0;
+        __ix32 i = 0;
+        for( ; i + 3 < n ; i += 4 )
+        {
+            s0 += x[ ( i + 0 ) * c + j ] * h[i + 0];
+            s1 += x[ ( i + 1 ) * c + j ] * h[i + 1];
+            s2 += x[ ( i + 2 ) * c + j ] * h[i + 2];
+            s3 += x[ ( i + 3 ) * c + j ] * h[i + 3];
+        }
+        for( ; i < n ; i++ ) s0 += x[ i * c + j ] * h[i];
+        y[j] = ( s0 + s1 ) + ( s2 + s3 );
+    }
+}
+
+/*! \brief AVX-512 32-bit floating point channels bank dot product kernel ( four 16-lane channel accumulators , the channels tail is processed by means of the masked loads ) */
+__attribute__( ( target( "avx512f" ) ) ) inline void __bank_dot_avx512__( const __fx32 *x , const __fx32 *h , __ix32 n , __ix32 c , __fx32 *y )
+{
+    __ix32 j = 0;
+    for( ; j + 63 < c ; j += 64 )
+    {
+        __m512 a0 = _mm512_setzero_ps() , a1 = _mm512_setzero_ps() , a2 = _mm512_setzero_ps() , a3 = _mm512_setzero_ps();
+        for( __ix32 i = 0 ; i < n ; i++ )
+        {
+            const __fx32 *r = x + i * c + j;
+            __m512 hv = _mm512_set1_ps( h[i] );
+            a0 = _mm512_fmadd_ps( _mm512_loadu_ps( r ) , hv , a0 );
+            a1 = _mm512_fmadd_ps( _mm512_loadu_ps( r + 16 ) , hv , a1 );
+            a2 = _mm512_fmadd_ps( _mm512_loadu_ps( r + 32 ) , hv , a2 );
+            a3 = _mm512_fmadd_ps( _mm512_loadu_ps( r + 48 ) , hv , a3 );
+        }
+        _mm512_storeu_ps( y + j , a0 );
+        _mm512_storeu_ps( y + j + 16 , a1 );
+        _mm512_storeu_ps( y + j + 32 , a2 );
+        _mm512_storeu_ps( y + j + 48 , a3 );
+    }
+    for( ; j + 15 < c ; j += 16 )
+    {
+        __m512 a0 = _mm512_setzero_ps() , a1 = _mm512_setzero_ps() , a2 = _mm512_setzero_ps() , a3 = _mm512_setzero_ps();
+        __ix32 i = 0;
+        for( ; i + 3 < n ; i += 4 )
+        {
+            a0 = _mm512_fmadd_ps( _mm512_loadu_ps( x + ( i + 0 ) * c + j ) , _mm512_set1_ps( h[i + 0] ) , a0 );
+            a1 = _mm512_fmadd_ps( _mm512_loadu_ps( x + ( i + 1 ) * c + j ) , _mm512_set1_ps( h[i + 1] ) , a1 );
+            a2 = _mm512_fmadd_ps( _mm512_loadu_ps( x + ( i + 2 ) * c + j ) , _mm512_set1_ps( h[i + 2] ) , a2 );
+            a3 = _mm512_fmadd_ps( _mm512_loadu_ps( x + ( i + 3 ) * c + j ) , _mm512_set1_ps( h[i + 3] ) , a3 );
+        }
+        for( ; i < n ; i++ ) a0 = _mm512_fmadd_ps( _mm512_loadu_ps( x + i * c + j ) , _mm512_set1_ps( h[i] ) , a0 );
+        __m512 a = _mm512_add_ps( _mm512_add_ps( a0 , a1 ) , _mm512_add_ps( a2 , a3 ) );
+        _mm512_storeu_ps( y + j , a );
+    }
+    if( j < c )
+    {
+        __mmask16 m = ( __mmask16 )( ( 1u << ( c - j ) ) - 1 );
+        __m512 a0 = _mm512_setzero_ps() , a1 = _mm512_setzero_ps() , a2 = _mm512_setzero_ps() , a3 = _mm512_setzero_ps();
+        __ix32 i = 0;
+        for( ; i + 3 < n ; i += 4 )
+        {
+            a0 = _mm512_fmadd_ps( _mm512_maskz_loadu_ps( m , x + ( i + 0 ) * c + j ) , _mm512_set1_ps( h[i + 0] ) , a0 );
+            a1 = _mm512_fmadd_ps( _mm512_maskz_loadu_ps( m , x + ( i + 1 ) * c + j ) , _mm512_set1_ps( h[i + 1] ) , a1 );
+            a2 = _mm512_fmadd_ps( _mm512_maskz_loadu_ps( m , x + ( i + 2 ) * c + j ) , _mm512_set1_ps( h[i + 2] ) , a2 );
+            a3 = _mm512_fmadd_ps( _mm512_maskz_loadu_ps( m , x + ( i + 3 ) * c + j ) , _mm512_set1_ps( h[i + 3] ) , a3 );
+        }
+        for( ; i < n ; i++ ) a0 = _mm512_fmadd_ps( _mm512_maskz_loadu_ps( m , x + i * c + j ) , _mm512_set1_ps( h[i] ) , a0 );
+        __m512 a = _mm512_add_ps( _mm512_add_ps( a0 , a1 ) , _mm512_add_ps( a2 , a3 ) );
+        _mm512_mask_storeu_ps( y + j , m , a );
+    }
+}
+
+/*! \brief AVX-512 64-bit floating point channels bank dot product kernel ( four 8-lane channel accumulators , the channels tail is processed by means of the masked loads ) */
+__attribute__( ( target( "avx512f" ) ) ) inline void __bank_dot_avx512__( const __fx64 *x , const __fx64 *h , __ix32 n , __ix32 c , __fx64 *y )
+{
+    __ix32 j = 0;
+    for( ; j + 31 < c ; j += 32 )
+    {
+        __m512d a0 = _mm512_setzero_pd() , a1 = _mm512_setzero_pd() , a2 = _mm512_setzero_pd() , a3 = _mm512_setzero_pd();
+        for( __ix32 i = 0 ; i < n ; i++ )
+        {
+            const __fx64 *r = x + i * c + j;
+            __m512d hv = _mm512_set1_pd( h[i] );
+            a0 = _mm512_fmadd_pd( _mm512_loadu_pd( r ) , hv , a0 );
+            a1 = _mm512_fmadd_pd( _mm512_loadu_pd( r + 8 ) , hv , a1 );
+            a2 = _mm512_fmadd_pd( _mm512_loadu_pd( r + 16 ) , hv , a2 );
+            a3 = _mm512_fmadd_pd( _mm512_loadu_pd( r + 24 ) , hv , a3 );
+        }
+        _mm512_storeu_pd( y + j , a0 );
+        _mm512_storeu_pd( y + j + 8 , a1 );
+        _mm512_storeu_pd( y + j + 16 , a2 );
+        _mm512_storeu_pd( y + j + 24 , a3 );
+    }
+    for( ; j + 7 < c ; j += 8 )
+    {
+        __m512d a0 = _mm512_setzero_pd() , a1 = _mm512_setzero_pd() , a2 = _mm512_setzero_pd() , a3 = _mm512_setzero_pd();
+        __ix32 i = 0;
+        for( ; i + 3 < n ; i += 4 )
+        {
+            a0 = _mm512_fmadd_pd( _mm512_loadu_pd( x + ( i + 0 ) * c + j ) , _mm512_set1_pd( h[i + 0] ) , a0 );
+            a1 = _mm512_fmadd_pd( _mm512_loadu_pd( x + ( i + 1 ) * c + j ) , _mm512_set1_pd( h[i + 1] ) , a1 );
+            a2 = _mm512_fmadd_pd( _mm512_loadu_pd( x + ( i + 2 ) * c + j ) , _mm512_set1_pd( h[i + 2] ) , a2 );
+            a3 = _mm512_fmadd_pd( _mm512_loadu_pd( x + ( i + 3 ) * c + j ) , _mm512_set1_pd( h[i + 3] ) , a3 );
+        }
+        for( ; i < n ; i++ ) a0 = _mm512_fmadd_pd( _mm512_loadu_pd( x + i * c + j ) , _mm512_set1_pd( h[i] ) , a0 );
+        __m512d a = _mm512_add_pd( _mm512_add_pd( a0 , a1 ) , _mm512_add_pd( a2 , a3 ) );
+        _mm512_storeu_pd( y + j , a );
+    }
+    if( j < c )
+    {
+        __mmask8 m = ( __mmask8 )( ( 1u << ( c - j ) ) - 1 );
+        __m512d a0 = _mm512_setzero_pd() , a1 = _mm512_setzero_pd() , a2 = _mm512_setzero_pd() , a3 = _mm512_setzero_pd();
+        __ix32 i = 0;
+        for( ; i + 3 < n ; i += 4 )
+        {
+            a0 = _mm512_fmadd_pd( _mm512_maskz_loadu_pd( m , x + ( i + 0 ) * c + j ) , _mm512_set1_pd( h[i + 0] ) , a0 );
+            a1 = _mm512_fmadd_pd( _mm512_maskz_loadu_pd( m , x + ( i + 1 ) * c + j ) , _mm512_set1_pd( h[i + 1] ) , a1 );
+            a2 = _mm512_fmadd_pd( _mm512_maskz_loadu_pd( m , x + ( i + 2 ) * c + j ) , _mm512_set1_pd( h[i + 2] ) , a2 );
+            a3 = _mm512_fmadd_pd( _mm512_maskz_loadu_pd( m , x + ( i + 3 ) * c + j ) , _mm512_set1_pd( h[i + 3] ) , a3 );
+        }
+        for( ; i < n ; i++ ) a0 = _mm512_fmadd_pd( _mm512_maskz_loadu_pd( m , x + i * c + j ) , _mm512_set1_pd( h[i] ) , a0 );
+        __m512d a = _mm512_add_pd( _mm512_add_pd( a0 , a1 ) , _mm512_add_pd( a2 , a3 ) );
+        _mm512_mask_storeu_pd( y + j , m , a );
+    }
+}
+
+
+/*!
+ * \brief SSE2 Q15 dot product kernel ( four pmaddwd 4-lane accumulators )
+ * \details the 32-bit lanes sums are exact as long as sum( | x[ i ] * h[ i ] | ) < 2^31 that is provided by the
+ *          coefficients headroom , the lanes are summed up with the 64-bit precision
+*/
+__attribute__( ( target( "sse2" ) ) ) inline __ix64 __qdot_sse2__( const __ix16 *x , const __ix16 *h , __ix32 n )
+{
+    __m128i a0 = _mm_setzero_si128() , a1 = _mm_setzero_si128() , a2 = _mm_setzero_si128() , a3 = _mm_setzero_si128();
+    __ix32 i = 0;
+    for( ; i + 31 < n ; i += 32 )
+    {
+        a0 = _mm_add_epi32( a0 , _mm_madd_epi16( _mm_loadu_si128( ( const __m128i* )( x + i +  0 ) ) , _mm_loadu_si128( ( const __m128i* )( h + i +  0 ) ) ) );
+        a1 = _mm_add_epi32( a1 , _mm_madd_epi16( _mm_loadu_si128( ( const __m128i* )( x + i +  8 ) ) , _mm_loadu_si128( ( const __m128i* )( h + i +  8 ) ) ) );
+        a2 = _mm_add_epi32( a2 , _mm_madd_epi16( _mm_loadu_si128( ( const __m128i* )( x + i + 16 ) ) , _mm_loadu_si128( ( const __m128i* )( h + i + 16 ) ) ) );
+        a3 = _mm_add_epi32( a3 , _mm_madd_epi16( _mm_loadu_si128( ( const __m128i* )( x + i + 24 ) ) , _mm_loadu_si128( ( const __m128i* )( h + i + 24 ) ) ) );
+    }
+    for( ; i + 7 < n ; i += 8 ) a0 = _mm_add_epi32( a0 , _mm_madd_epi16( _mm_loadu_si128( ( const __m128i* )( x + i ) ) , _mm_loadu_si128( ( const __m128i* )( h + i ) ) ) );
+
+    __ix32 r[4];
+    _mm_storeu_si128( ( __m128i* )r , _mm_add_epi32( _mm_add_epi32( a0 , a1 ) , _mm_add_epi32( a2 , a3 ) ) );
+    __ix64 s = ( ( __ix64 )r[0] + r[1] ) + ( ( __ix64 )r[2] + r[3] );
+    for( ; i < n ; i++ ) s += ( __ix64 )x[i] * h[i];
+    return s;
+}
+
+/*! \brief SSE2 Q31 dot product kernel ( SSE2 has no signed 32-bit widening multiplication , so the scalar kernel is used ) */
+inline __ix64 __qdot_sse2__( const __ix32 *x , const __ix32 *h , __ix32 n ) { return __qdot_scalar__< __ix32 >( x , h , n ); }
+
+/*!
+ * \brief AVX2 Q15 dot product kernel ( four pmaddwd 8-lane accumulators )
+ * \details the 32-bit lanes sums are exact as long as sum( | x[ i ] * h[ i ] | ) < 2^31 that is provided by the
+ *          coefficients headroom , the lanes are summed up with the 64-bit precision
+*/
+__attribute__( ( target( "avx2" ) ) ) inline __ix64 __qdot_avx2__( const __ix16 *x , const __ix16 *h , __ix32 n )
+{
+    __m256i a0 = _mm256_setzero_si256() , a1 = _mm256_setzero_si256() , a2 = _mm256_setzero_si256() , a3 = _mm256_setzero_si256();
+    __ix32 i = 0;
+    for( ; i + 63 < n ; i += 64 )
+    {
+        a0 = _mm256_add_epi32( a0 , _mm256_madd_epi16( _mm256_loadu_si256( ( const __m256i* )( x + i +  0 ) ) , _mm256_loadu_si256( ( const __m256i* )( h + i +  0 ) ) ) );
+        a1 = _mm256_add_epi32( a1 , _mm256_madd_epi16( _mm256_loadu_si256( ( const __m256i* )( x + i + 16 ) ) , _mm256_loadu_si256( ( const __m256i* )( h + i + 16 ) ) ) );
+        a2 = _mm256_add_epi32( a2 , _mm256_madd_epi16( _mm256_loadu_si256( ( const __m256i* )( x + i + 32 ) ) , _mm256_loadu_si256( ( const __m256i* )( h + i + 32 ) ) ) );
+        a3 = _mm256_add_epi32( a3 , _mm256_madd_epi16( _mm256_loadu_si256( ( const __m256i* )( x + i + 48 ) ) , _mm256_loadu_si256( ( const __m256i* )( h + i + 48 ) ) ) );
+    }
+    for( ; i + 15 < n ; i += 16 ) a0 = _mm256_add_epi32( a0 , _mm256_madd_epi16( _mm256_loadu_si256( ( const __m256i* )( x + i ) ) , _mm256_loadu_si256( ( const __m256i* )( h + i ) ) ) );
+
+    __m256i a = _mm256_add_epi32( _mm256_add_epi32( a0 , a1 ) , _mm256_add_epi32( a2 , a3 ) );
+    __ix32 r[8];
+    _mm256_storeu_si256( ( __m256i* )r , a );
+    __ix64 s = ( ( ( __ix64 )r[0] + r[1] ) + ( ( __ix64 )r[2] + r[3] ) ) + ( ( ( __ix64 )r[4] + r[5] ) + ( ( __ix64 )r[6] + r[7] ) );
+    for( ; i < n ; i++ ) s += ( __ix64 )x[i] * h[i];
+    return s;
+}
+
+/*! \brief AVX2 Q31 dot product kernel ( four 4-lane 64-bit accumulators , the even and the odd lanes are multiplied separately ) */
+__attribute__( ( target( "avx2" ) ) ) inline __ix64 __qdot_avx2__( const __ix32 *x , const __ix32 *h , __ix32 n )
+{
+    __m256i a0 = _mm256_setzero_si256() , a1 = _mm256_setzero_si256() , a2 = _mm256_setzero_si256() , a3 = _mm256_setzero_si256();
+    __ix32 i = 0;
+    for( ; i + 15 < n ; i += 16 )
+    {
+        __m256i x0 = _mm256_loadu_si256( ( const __m256i* )( x + i + 0 ) ) , h0 = _mm256_loadu_si256( ( const __m256i* )( h + i + 0 ) );
+        __m256i x1 = _mm256_loadu_si256( ( const __m256i* )( x + i + 8 ) ) , h1 = _mm256_loadu_si256( ( const __m256i* )( h + i + 8 ) );
+        a0 = _mm256_add_epi64( a0 , _mm256_mul_epi32( x0 , h0 ) );
+        a1 = _mm256_add_epi64( a1 , _mm256_mul_epi32( _mm256_srli_epi64( x0 , 32 ) , _mm256_srli_epi64( h0 , 32 ) ) );
+        a2 = _mm256_add_epi64( a2 , _mm256_mul_epi32( x1 , h1 ) );
+        a3 = _mm256_add_epi64( a3 , _mm256_mul_epi32( _mm256_srli_epi64( x1 , 32 ) , _mm256_srli_epi64( h1 , 32 ) ) );
+    }
+    for( ; i + 7 < n ; i += 8 )
+    {
+        __m256i x0 = _mm256_loadu_si256( ( const __m256i* )( x + i ) ) , h0 = _mm256_loadu_si256( ( const __m256i* )( h + i ) );
+        a0 = _mm256_add_epi64( a0 , _mm256_mul_epi32( x0 , h0 ) );
+        a1 = _mm256_add_epi64( a1 , _mm256_mul_epi32( _mm256_srli_epi64( x0 , 32 ) , _mm256_srli_epi64( h0 , 32 ) ) );
+    }
+
+    __ix64 r[4];
+    _mm256_storeu_si256( ( __m256i* )r , _mm256_add_epi64( _mm256_add_epi64( a0 , a1 ) , _mm256_add_epi64( a2 , a3 ) ) );
+    __ix64 s = ( r[0] + r[1] ) + ( r[2] + r[3] );
+    for( ; i < n ; i++ ) s += ( __ix64 )x[i] * h[i];
+    return s;
+}
+
+/*! \brief AVX-512 Q15 dot product kernel ( the 16-bit AVX-512 instructions require AVX512BW , so the AVX2 kernel is used ) */
+inline __ix64 __qdot_avx512__( const __ix16 *x , const __ix16 *h , __ix32 n ) { return __qdot_avx2__( x , h , n ); }
+
+/*! \brief AVX-512 Q31 dot product kernel ( four 8-lane 64-bit accumulators , the even and the odd lanes are multiplied separately ) */
+__attribute__( ( target( "avx512f" ) ) ) inline __ix64 __qdot_avx512__( const __ix32 *x , const __ix32 *h , __ix32 n )
+{
+    __m512i a0 = _mm512_setzero_si512() , a1 = _mm512_setzero_si512() , a2 = _mm512_setzero_si512() , a3 = _mm512_setzero_si512();
+    __ix32 i = 0;
+    for( ; i + 31 < n ; i += 32 )
+    {
+        __m512i x0 = _mm512_loadu_si512( x + i +  0 ) , h0 = _mm512_loadu_si512( h + i +  0 );
+        __m512i x1 = _mm512_loadu_si512( x + i + 16 ) , h1 = _mm512_loadu_si512( h + i + 16 );
+        a0 = _mm512_add_epi64( a0 , _mm512_maskz_mul_epi32( 0xFF , x0 , h0 ) );
+        a1 = _mm512_add_epi64( a1 , _mm512_maskz_mul_epi32( 0xFF , _mm512_maskz_srli_epi64( 0xFF , x0 , 32 ) , _mm512_maskz_srli_epi64( 0xFF , h0 , 32 ) ) );
+        a2 = _mm512_add_epi64( a2 , _mm512_maskz_mul_epi32( 0xFF , x1 , h1 ) );
+        a3 = _mm512_add_epi64( a3 , _mm512_maskz_mul_epi32( 0xFF , _mm512_maskz_srli_epi64( 0xFF , x1 , 32 ) , _mm512_maskz_srli_epi64( 0xFF , h1 , 32 ) ) );
+    }
+    for( ; i + 15 < n ; i += 16 )
+    {
+        __m512i x0 = _mm512_loadu_si512( x + i ) , h0 = _mm512_loadu_si512( h + i );
+        a0 = _mm512_add_epi64( a0 , _mm512_maskz_mul_epi32( 0xFF , x0 , h0 ) );
+        a1 = _mm512_add_epi64( a1 , _mm512_maskz_mul_epi32( 0xFF , _mm512_maskz_srli_epi64( 0xFF , x0 , 32 ) , _mm512_maskz_srli_epi64( 0xFF , h0 , 32 ) ) );
+    }
+
+    __ix64 r[8];
+    _mm512_storeu_si512( r , _mm512_add_epi64( _mm512_add_epi64( a0 , a1 ) , _mm512_add_epi64( a2 , a3 ) ) );
+    __ix64 s = ( ( r[0] + r[1] ) + ( r[2] + r[3] ) ) + ( ( r[4] + r[5] ) + ( r[6] + r[7] ) );
+    for( ; i < n ; i++ ) s += ( __ix64 )x[i] * h[i];
+    return s;
+}
+
+#endif
+
+/*!
+ * \brief   instruction set detection function
+ * \return  The function returns the best instruction set supported by the CPU. The detection is implemented once.
+*/
+inline simd_isa __simd_isa_cpu__()
+{
+#ifdef __SIMD_X86
+    static const simd_isa isa = __builtin_cpu_supports( "avx512f" ) ? isa_avx512 :
+                                ( __builtin_cpu_supports( "avx2" ) && __builtin_cpu_supports( "fma" ) ) ? isa_avx2 :
+                                __builtin_cpu_supports( "sse2" ) ? isa_sse2 : isa_scalar;
+    return isa;
+#else
+    return isa_scalar;
+#endif
+}
+
+/*!
+ * \brief   kernels instruction set selection function
+ * \return  The function returns the instruction set of the kernels selected by the dot product functions. The AVX-512
+ *          kernels are not faster than the AVX2 ones for the filter orders up to a few thousands ( example11 ) , so
+ *          they are selected only if __SIMD_AVX512 is set , the AVX2 kernels are selected otherwise.
+*/
+inline simd_isa __simd_isa__()
+{
+    simd_isa isa = __simd_isa_cpu__();
+    return ( isa == isa_avx512 && !__SIMD_AVX512 ) ? isa_avx2 : isa;
+}
+
+/*! \brief template dot product kernel pointer type */
+template< typename T > struct dot_kernel { typedef T ( *type )( const T* , const T* , __ix32 ); };
+
+/*!
+ * \brief      dot product kernel selection function
+ * \param[isa] - instruction set
+ * \return     The function returns the dot product kernel for the instruction set. The scalar kernel is returned
+ *             if the instruction set kernels are not compiled.
+*/
+template< typename T > typename dot_kernel< T >::type __dot_kernel__( simd_isa isa )
+{
+#ifdef __SIMD_X86
+    switch( isa )
+    {
+        case isa_avx512: return static_cast< typename dot_kernel< T >::type >( __dot_avx512__ );
+        case isa_avx2  : return static_cast< typename dot_kernel< T >::type >( __dot_avx2__   );
+        case isa_sse2  : return static_cast< typename dot_kernel< T >::type >( __dot_sse2__   );
+        default        : break;
+    }
+#else
+    ( void )isa;
+#endif
+    return __dot_scalar__< T >;
+}
+
+/*!
+ * \brief   dot product function
+ * \param[x] - pointer to the first  vector
+ * \param[h] - pointer to the second vector
+ * \param[n] - vectors size
+ * \return  The function returns sum( x[ i ] * h[ i ] ) computed by means of the best kernel supported by the CPU.
+ *          The kernel is selected at the first call.
+*/
+template< typename T > inline T __dot__( const T *x , const T *h , __ix32 n )
+{
+    static const typename dot_kernel< T >::type kernel = __dot_kernel__< T >( __simd_isa__() );
+    return kernel( x , h , n );
+}
+
+
+/*! \brief template folded dot product kernel pointer type */
+template< typename T > struct fold_kernel { typedef T ( *type )( const T* , const T* , __ix32 , __ix32 ); };
+
+/*!
+ * \brief      folded dot product kernel selection function
+ * \param[isa] - instruction set
+ * \return     The function returns the folded dot product kernel for the instruction set. The scalar kernel is returned
+ *             if the instruction set kernels are not compiled.
+*/
+template< typename T > typename fold_kernel< T >::type __fold_kernel__( simd_isa isa )
+{
+#ifdef __SIMD_X86
+    switch( isa )
+    {
+        case isa_avx512: return static_cast< typename fold_kernel< T >::type >( __fold_dot_avx512__ );
+        case isa_avx2  : return static_cast< typename fold_kernel< T >::type >( __fold_dot_avx2__   );
+        case isa_sse2  : return static_cast< typename fold_kernel< T >::type >( __fold_dot_sse2__   );
+        default        : break;
+    }
+#else
+    ( void )isa;
+#endif
+    return __fold_dot_scalar__< T >;
+}
+
+/*!
+ * \brief   folded dot product function
+ * \param[x] - pointer to the history vector
+ * \param[h] - pointer to the ( anti )symmetric coefficients vector
+ * \param[n] - vectors size
+ * \param[s] - folding sign ( +1 - symmetric coefficients , -1 - antisymmetric coefficients )
+ * \return  The function returns sum( x[ i ] * h[ i ] ) for the ( anti )symmetric h by means of the mirrored samples
+ *          pre-addition , so only the first ( n + 1 ) / 2 coefficients are multiplied. The kernel is selected at the first call.
+*/
+template< typename T > inline T __fold_dot__( const T *x , const T *h , __ix32 n , __ix32 s )
+{
+    static const typename fold_kernel< T >::type kernel = __fold_kernel__< T >( __simd_isa__() );
+    return kernel( x , h , n , s );
+}
+
+/*! \brief template channels bank dot product kernel pointer type */
+template< typename T > struct bank_kernel { typedef void ( *type )( const T* , const T* , __ix32 , __ix32 , T* ); };
+
+/*!
+ * \brief      channels bank dot product kernel selection function
+ * \param[isa] - instruction set
+ * \return     The function returns the channels bank dot product kernel for the instruction set. The scalar kernel is returned
+ *             if the instruction set kernels are not compiled.
+*/
+template< typename T > typename bank_kernel< T >::type __bank_kernel__( simd_isa isa )
+{
+#ifdef __SIMD_X86
+    switch( isa )
+    {
+        case isa_avx512: return static_cast< typename bank_kernel< T >::type >( __bank_dot_avx512__ );
+        case isa_avx2  : return static_cast< typename bank_kernel< T >::type >( __bank_dot_avx2__   );
+        case isa_sse2  : return static_cast< typename bank_kernel< T >::type >( __bank_dot_sse2__   );
+        default        : break;
+    }
+#else
+    ( void )isa;
+#endif
+    return __bank_dot_scalar__< T >;
+}
+
+/*!
+ * \brief   channels bank dot product function
+ * \param[x] - pointer to the channel-interleaved history ( n rows of c samples )
+ * \param[h] - pointer to the coefficients vector
+ * \param[n] - coefficients number
+ * \param[c] - channels number
+ * \param[y] - pointer to the c outputs
+ * \details The function computes y[ j ] = sum( x[ i * c + j ] * h[ i ] ) for all the channels at once , the channels
+ *          are mapped onto the SIMD lanes , so every coefficient is broadcast once per row. The kernel is selected at the first call.
+*/
+template< typename T > inline void __bank_dot__( const T *x , const T *h , __ix32 n , __ix32 c , T *y )
+{
+    static const typename bank_kernel< T >::type kernel = __bank_kernel__< T >( __simd_isa__() );
+    kernel( x , h , n , c , y );
+}
+
+/*! \brief template fixed point dot product kernel pointer type */
+template< typename T > struct qdot_kernel { typedef __ix64 ( *type )( const T* , const T* , __ix32 ); };
+
+/*!
+ * \brief      fixed point dot product kernel selection function
+ * \param[isa] - instruction set
+ * \return     The function returns the Q15 / Q31 dot product kernel for the instruction set. The scalar kernel is returned
+ *             if the instruction set kernels are not compiled.
+*/
+template< typename T > typename qdot_kernel< T >::type __qdot_kernel__( simd_isa isa )
+{
+#ifdef __SIMD_X86
+    switch( isa )
+    {
+        case isa_avx512: return static_cast< typename qdot_kernel< T >::type >( __qdot_avx512__ );
+        case isa_avx2  : return static_cast< typename qdot_kernel< T >::type >( __qdot_avx2__   );
+        case isa_sse2  : return static_cast< typename qdot_kernel< T >::type >( __qdot_sse2__   );
+        default        : break;
+    }
+#else
+    ( void )isa;
+#endif
+    return __qdot_scalar__< T >;
+}
+
+/*!
+ * \brief   fixed point dot product function
+ * \param[x] - pointer to the Q15 / Q31 samples vector
+ * \param[h] - pointer to the quantized coefficients vector
+ * \param[n] - vectors size
+ * \return  The function returns the exact 64-bit sum( x[ i ] * h[ i ] ) computed by means of the best kernel supported
+ *          by the CPU. The kernel is selected at the first call.
+*/
+template< typename T > inline __ix64 __qdot__( const T *x , const T *h , __ix32 n )
+{
+    static const typename qdot_kernel< T >::type kernel = __qdot_kernel__< T >( __simd_isa__() );
+    return kernel( x , h , n );
+}
+
+/*! @} */
+
+#undef __fx32
+#undef __fx64
+#undef __ix16
+#undef __ix32
+#undef __ix64
+
+#endif // SIMD_H
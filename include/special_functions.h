@@ -16,6 +16,27 @@
 #ifndef __ALG_PLATFORM
 #include "cmath"
 #include "malloc.h"
+#include "string.h"
+#include <mutex>
+#endif
+
+/*! \brief enables the process-wide design cache ( the cache requires the standard library mutex ) */
+#ifndef __DESIGN_CACHE
+#ifndef __ALG_PLATFORM
+#define __DESIGN_CACHE 1
+#else
+#define __DESIGN_CACHE 0
+#endif
+#endif
+
+/*! \brief defines the design cache key size ( number of the 64-bit floating point key fields ) */
+#ifndef __DESIGN_KEY_SIZE
+#define __DESIGN_KEY_SIZE 10
+#endif
+
+/*! \brief defines the design cache capacity ( maximum number of the cached arrays of every type ) */
+#ifndef __DESIGN_CACHE_SIZE
+#define __DESIGN_CACHE_SIZE 256
 #endif
 
 /*! \brief converts radians to degrees */
@@ -897,6 +918,73 @@ extern __fxx64 __modified_bessel_in__( __fxx64 x  , __ix32 order )
     return sum;
 }
 
+/*!
+ * \brief compile-time absolute value function
+ * \param[x] input
+ * \return the function returns | x |
+*/
+constexpr __fx64 __cx_fabs__( __fx64 x ) { return ( x < 0 ) ? -x : x; }
+
+/*!
+ * \brief compile-time sine Taylor series function
+ * \param[x2]   squared argument , | x | <= pi / 2
+ * \param[term] current series term x^( 2k - 1 ) / ( 2k - 1 )!
+ * \param[k]    current series term number
+ * \return the function returns the series sum starting from the k-th term , 13 terms give the 64-bit precision
+*/
+constexpr __fx64 __cx_sin_series__( __fx64 x2 , __fx64 term , __ix32 k )
+{
+    return ( k > 13 ) ? term : term + __cx_sin_series__( x2 , -term * x2 / ( ( 2 * k ) * ( 2 * k + 1 ) ) , k + 1 );
+}
+
+/*!
+ * \brief compile-time sine function
+ * \param[x] input , rad
+ * \return the function reduces the argument to [ -pi / 2 ; pi / 2 ] and returns sin( x ) computed by means of the Taylor series
+*/
+constexpr __fx64 __cx_sin_reduced__( __fx64 x )
+{
+    return ( x > PI0 / 2 ) ? __cx_sin_series__( ( PI0 - x ) * ( PI0 - x ) , PI0 - x , 1 ) :
+           ( x < -PI0 / 2 ) ? __cx_sin_series__( ( PI0 + x ) * ( PI0 + x ) , -PI0 - x , 1 ) :
+           __cx_sin_series__( x * x , x , 1 );
+}
+
+/*!
+ * \brief compile-time sine function
+ * \param[x] input , rad
+ * \return the function returns sin( x )
+*/
+constexpr __fx64 __cx_sin__( __fx64 x )
+{
+    return __cx_sin_reduced__( x - PI2 * ( __fx64 )( __ix64 )( ( x < 0 ) ? ( x / PI2 - 0.5 ) : ( x / PI2 + 0.5 ) ) );
+}
+
+/*!
+ * \brief compile-time cosine function
+ * \param[x] input , rad
+ * \return the function returns cos( x ) = sin( pi / 2 - x )
+*/
+constexpr __fx64 __cx_cos__( __fx64 x ) { return __cx_sin__( PI0 / 2 - x ); }
+
+/*!
+ * \brief compile-time square root Newton iterations function
+ * \param[x] input , x >= 0
+ * \param[g] current approximation
+ * \param[k] remaining iterations number
+ * \return the function iterates g = ( g + x / g ) / 2 until the approximation stops changing
+*/
+constexpr __fx64 __cx_sqrt_newton__( __fx64 x , __fx64 g , __ix32 k )
+{
+    return ( k == 0 || g == 0.5 * ( g + x / g ) ) ? g : __cx_sqrt_newton__( x , 0.5 * ( g + x / g ) , k - 1 );
+}
+
+/*!
+ * \brief compile-time square root function
+ * \param[x] input , x >= 0
+ * \return the function returns sqrt( x )
+*/
+constexpr __fx64 __cx_sqrt__( __fx64 x ) { return ( x <= 0 ) ? 0 : __cx_sqrt_newton__( x , ( x > 1 ) ? x : 1 , 128 ); }
+
 /*! @} */
 
 /*! \defgroup <Window_fcn> ( Window functions )
@@ -904,6 +992,182 @@ extern __fxx64 __modified_bessel_in__( __fxx64 x  , __ix32 order )
     @{
 */
 
+/*! \brief window function types */
+enum wind_type { wind_none , wind_bartlett , wind_bartlett_hanning , wind_blackman , wind_blackman_harris , wind_bohman ,
+                 wind_chebyshev , wind_flat_top , wind_gaussian , wind_hamming , wind_hann , wind_kaiser , wind_nutall ,
+                 wind_parzen , wind_rectangular , wind_triangular , wind_tukey };
+
+/*!
+ * \brief compile-time window support check function
+ * \param[type] window function type
+ * \return the function returns true if the window has no parameters and its coefficients are computed by
+ *         the compile-time __cx_wind__ function
+*/
+constexpr bool __cx_wind_supported__( wind_type type )
+{
+    return type == wind_bartlett || type == wind_bartlett_hanning || type == wind_blackman || type == wind_blackman_harris ||
+           type == wind_hamming  || type == wind_hann             || type == wind_nutall   || type == wind_rectangular     ||
+           type == wind_triangular;
+}
+
+/*!
+ * \brief compile-time window function coefficient computation
+ * \param[type] window function type ( __cx_wind_supported__( type ) must be true )
+ * \param[n]    coefficient number , n = 0 ... Ns - 1
+ * \param[Ns]   window function length
+ * \return the function returns the n-th window coefficient computed by the same formula as the wind_fcn class does
+*/
+constexpr __fx64 __cx_wind__( wind_type type , __ix32 n , __ix32 Ns )
+{
+    return ( type == wind_bartlett )         ? ( ( n <= ( Ns - 1 ) / 2.0 ) ? ( 2.0 * n / ( Ns - 1 ) ) : ( 2 - 2.0 * n / ( Ns - 1 ) ) ) :
+           ( type == wind_bartlett_hanning ) ? ( 0.62 - 0.48 * __cx_fabs__( ( __fx64 )n / ( Ns - 1 ) - 0.5 ) + 0.38 * __cx_cos__( PI2 * ( ( __fx64 )n / ( Ns - 1 ) - 0.5 ) ) ) :
+           ( type == wind_blackman )         ? ( 0.42 - 0.50 * __cx_cos__( 2 * PI0 * n / ( Ns - 1 ) ) + 0.08 * __cx_cos__( 4 * PI0 * n / ( Ns - 1 ) ) ) :
+           ( type == wind_blackman_harris )  ? ( 0.35875 - 0.48829 * __cx_cos__( 2 * PI0 * n / ( Ns - 1 ) ) + 0.14128 * __cx_cos__( 4 * PI0 * n / ( Ns - 1 ) ) - 0.01168 * __cx_cos__( 6 * PI0 * n / ( Ns - 1 ) ) ) :
+           ( type == wind_hamming )          ? ( 0.54 - 0.46 * __cx_cos__( PI2 * n / ( Ns - 1 ) ) ) :
+           ( type == wind_hann )             ? ( 0.5 - 0.5 * __cx_cos__( PI2 * n / ( Ns - 1 ) ) ) :
+           ( type == wind_nutall )           ? ( 0.3635819 - 0.4891775 * __cx_cos__( 2 * PI0 * n / ( Ns - 1 ) ) + 0.1365995 * __cx_cos__( 4 * PI0 * n / ( Ns - 1 ) ) - 0.0106411 * __cx_cos__( 6 * PI0 * n / ( Ns - 1 ) ) ) :
+           ( type == wind_triangular )       ? ( 1.0 - __cx_fabs__( ( n - ( Ns - 1.0 ) / 2 ) / ( ( Ns % 2 == 0 ) ? ( Ns / 2.0 ) : ( ( Ns + 1.0 ) / 2 ) ) ) ) :
+           1.0;
+}
+
+#if __DESIGN_CACHE
+
+/*!
+ * \brief process-wide thread-safe memoization cache of the design arrays
+ * \details The cache keeps one copy of every designed array ( window function , filter coefficients ) under the key
+ *          of __DESIGN_KEY_SIZE 64-bit floating point fields , so the objects with the same design parameters compute
+ *          the array once per process. The arrays are copied in and out under the lock , so no pointer to the cached
+ *          memory leaves the cache. It makes the cache bounded: if __DESIGN_CACHE_SIZE arrays are cached , the least
+ *          recently used one is evicted , and clear() may be called at any time.
+*/
+template< typename T > class design_cache
+{
+    /*! \brief cache entry */
+    struct entry { __fx64 key[ __DESIGN_KEY_SIZE ]; __ix32 n; T *data; entry *next; };
+
+    /*! \brief entries list head ( the most recently used entry ) */
+    entry *m_head;
+
+    /*! \brief entries number */
+    __ix32 m_size;
+
+    /*! \brief entries list lock */
+    std::mutex m_lock;
+
+    /*! \brief entry search function , the found entry is moved to the list head ( the lock must be held ) */
+    entry *search( const __fx64 *key )
+    {
+        for( entry *e = m_head , *prev = 0 ; e != 0 ; prev = e , e = e->next )
+        {
+            if( memcmp( e->key , key , sizeof ( e->key ) ) != 0 ) continue;
+            if( prev != 0 )
+            {
+                prev->next = e->next;
+                e->next    = m_head;
+                m_head     = e;
+            }
+            return e;
+        }
+        return 0;
+    }
+
+    /*! \brief least recently used entry eviction function ( the lock must be held ) */
+    void evict()
+    {
+        if( m_head == 0 ) return;
+        entry **last = &m_head;
+        while( ( *last )->next != 0 ) last = &( *last )->next;
+        free( ( *last )->data );
+        free( *last );
+        *last = 0;
+        m_size--;
+    }
+
+    /*! \brief default constructor */
+    design_cache() : m_head( 0 ) , m_size( 0 ) {}
+
+public:
+
+    /*! \brief destructor */
+    ~design_cache() { clear(); }
+
+    /*!
+     *  \brief  cache instance getting function
+     *  \return the function returns the process-wide cache of the T arrays
+    */
+    static design_cache &instance()
+    {
+        static design_cache cache;
+        return cache;
+    }
+
+    /*!
+     *  \brief  cached array search function
+     *  \param[key ] - pointer to the __DESIGN_KEY_SIZE key fields
+     *  \param[data] - pointer to the output array
+     *  \param[n   ] - expected array size
+     *  \return the function copies the cached array into the output array and returns 1 or returns 0 if the array is not cached
+    */
+    __ix32 find( const __fx64 *key , T *data , __ix32 n )
+    {
+        std::lock_guard< std::mutex > lock( m_lock );
+        entry *e = search( key );
+        if( e == 0 || e->n != n ) return 0;
+        memcpy( data , e->data , n * sizeof ( T ) );
+        return 1;
+    }
+
+    /*!
+     *  \brief  array caching function
+     *  \param[key ] - pointer to the __DESIGN_KEY_SIZE key fields
+     *  \param[data] - pointer to the designed array
+     *  \param[n   ] - array size
+     *  \return the function stores the copy of the array and returns 1 or returns 0 if the memory is not allocated.
+     *          If the same key has been stored by another thread meanwhile , the earlier array is kept.
+    */
+    __ix32 insert( const __fx64 *key , const T *data , __ix32 n )
+    {
+        std::lock_guard< std::mutex > lock( m_lock );
+        if( search( key ) != 0 ) return 1;
+
+        entry *e = ( entry* ) calloc( 1 , sizeof ( entry ) );
+        T *copy = ( T* ) calloc( n , sizeof ( T ) );
+        if( e == 0 || copy == 0 ) { free( e ); free( copy ); return 0; }
+        while( m_size >= __DESIGN_CACHE_SIZE ) evict();
+        memcpy( e->key , key , sizeof ( e->key ) );
+        memcpy( copy , data , n * sizeof ( T ) );
+        e->n    = n;
+        e->data = copy;
+        e->next = m_head;
+        m_head  = e;
+        m_size++;
+        return 1;
+    }
+
+    /*! \brief cached arrays number getting function */
+    __ix32 size()
+    {
+        std::lock_guard< std::mutex > lock( m_lock );
+        return m_size;
+    }
+
+    /*! \brief cache clearing function , the function frees all the cached arrays */
+    void clear()
+    {
+        std::lock_guard< std::mutex > lock( m_lock );
+        while( m_head != 0 )
+        {
+            entry *e = m_head;
+            m_head = e->next;
+            free( e->data );
+            free( e );
+        }
+        m_size = 0;
+    }
+};
+
+#endif
+
 /*!
 * \brief Window function class
 * \details Window function class implements the range of window functions coefficients computation and storing
@@ -921,6 +1185,69 @@ protected:
 
     /*! \brief window function coefficients buffer */
     __fx64 *m_buff;
+
+    /*! \brief window function type */
+    wind_type m_type;
+
+    /*! \brief window function parameter ( attenuation , alpha , betta , R or 0 if the window has no parameter ) */
+    __fx64 m_param;
+
+    /*! \brief window function design cache key computation function */
+    void cache_key( __fx64 *key )
+    {
+        for( __ix32 i = 0 ; i < __DESIGN_KEY_SIZE ; i++ ) key[i] = 0;
+        key[1] = m_type;
+        key[2] = m_param;
+        key[3] = m_order;
+    }
+
+    /*!
+     * \brief window function selection function
+     * \param[type  ] window function type
+     * \param[param ] window function parameter
+     * \param[cached] design cache usage flag ( used by the windows that are expensive to compute )
+     * \return The function sets the window type and returns 1 if the window coefficients are copied out of the design cache
+    */
+    __ix32 select( wind_type type , __fx64 param , __bool cached = false )
+    {
+        m_type  = type;
+        m_param = param;
+#if __DESIGN_CACHE
+        if( cached )
+        {
+            __fx64 key[ __DESIGN_KEY_SIZE ];
+            cache_key( key );
+            if( allocate() == 0 )
+            {
+                if( design_cache< __fx64 >::instance().find( key , m_buff , m_order ) )
+                {
+                    m_wind_ready = true;
+                    return 1;
+                }
+                deallocate();
+            }
+        }
+#else
+        ( void )cached;
+#endif
+        return 0;
+    }
+
+    /*!
+     * \brief window function caching function
+     * \return The function stores the computed window into the design cache , sets m_wind_ready = 1 and returns it
+    */
+    __ix32 store()
+    {
+#if __DESIGN_CACHE
+        __fx64 key[ __DESIGN_KEY_SIZE ];
+        cache_key( key );
+        design_cache< __fx64 >::instance().insert( key , m_buff , m_order );
+#endif
+        m_wind_ready = true;
+        return m_wind_ready;
+    }
+
 public:
 
     // constructor and destructor:
@@ -928,6 +1255,8 @@ public:
     {
         m_wind_ready = 0;
         m_buff       = 0;
+        m_type       = wind_none;
+        m_param      = 0;
     }
 
     ~wind_fcn() { deallocate(); }
@@ -935,11 +1264,15 @@ public:
     /*!
      * \brief window function class object initialization function
      * \param[order] window function length ( in samples )
+     * \details the previously computed window is discarded , since it does not fit the new length
     */
     void init( __ix32 order )
     {
-        m_order = order;
-        m_buff  = 0;
+        deallocate();
+        m_order      = order;
+        m_wind_ready = 0;
+        m_type       = wind_none;
+        m_param      = 0;
     }
 
     /*!
@@ -985,6 +1318,9 @@ public:
     */
     __ix32 Bartlett()
     {
+        // window type selection:
+        select( wind_bartlett , 0 );
+
         // memory allocation:
         allocate();
 
@@ -1009,6 +1345,9 @@ public:
 
     __ix32 BartlettHanning()
     {
+        // window type selection:
+        select( wind_bartlett_hanning , 0 );
+
         // memory allocation:
         allocate();
 
@@ -1032,6 +1371,9 @@ public:
     */
     __ix32 Blackman()
     {
+        // window type selection:
+        select( wind_blackman , 0 );
+
         // memory allocation:
         allocate();
 
@@ -1056,6 +1398,9 @@ public:
     */
     __ix32 BlackmanHarris()
     {
+        // window type selection:
+        select( wind_blackman_harris , 0 );
+
         // memory allocation:
         allocate();
 
@@ -1083,6 +1428,9 @@ public:
     */
     __ix32 Bohman()
     {
+        // window type selection:
+        select( wind_bohman , 0 );
+
         // memory allocation:
         allocate();
 
@@ -1129,6 +1477,9 @@ public:
     */
     __ix32 Chebyshev( __fx64 atten )
     {
+        // window type selection , the window is copied out of the design cache if it has been computed before:
+        if( select( wind_chebyshev , atten , true ) ) return m_wind_ready;
+
         // memory allocation:
         allocate();
 
@@ -1151,9 +1502,8 @@ public:
         }
         for (nn = 0; nn < Ns; nn++) m_buff[nn] /= max;
 
-        // window is ready to use:
-        m_wind_ready = true;
-        return m_wind_ready;
+        // window is ready to use and cached:
+        return store();
     }
 
     /*!
@@ -1170,6 +1520,9 @@ public:
     */
     __ix32 FlatTop()
     {
+        // window type selection:
+        select( wind_flat_top , 0 );
+
         // memory allocation:
         allocate();
 
@@ -1202,6 +1555,9 @@ public:
     */
     __ix32 Gaussian( __fx64 alpha )
     {
+        // window type selection:
+        select( wind_gaussian , alpha );
+
         // memory allocation:
         allocate();
 
@@ -1233,6 +1589,9 @@ public:
     */
     __ix32 Hamming()
     {
+        // window type selection:
+        select( wind_hamming , 0 );
+
         // memory allocation:
         allocate();
 
@@ -1256,6 +1615,9 @@ public:
     */
     __ix32 Hann()
     {
+        // window type selection:
+        select( wind_hann , 0 );
+
         // memory allocation:
         allocate();
 
@@ -1283,6 +1645,9 @@ public:
     */
     __ix32 Kaiser( __fx64 betta )
     {
+        // window type selection , the window is copied out of the design cache if it has been computed before:
+        if( select( wind_kaiser , betta , true ) ) return m_wind_ready;
+
         // memory allocation:
         allocate();
 
@@ -1299,9 +1664,8 @@ public:
             m_buff[n] = __modified_bessel_in__( B , 0 ) / __modified_bessel_in__( C , 0 );
         }
 
-        // window is ready to use:
-        m_wind_ready = true;
-        return m_wind_ready;
+        // window is ready to use and cached:
+        return store();
     }
 
     /*!
@@ -1318,6 +1682,9 @@ public:
     */
     __ix32 Nutall()
     {
+        // window type selection:
+        select( wind_nutall , 0 );
+
         // memory allocation:
         allocate();
 
@@ -1353,6 +1720,9 @@ public:
     */
     __ix32 Parzen()
     {
+        // window type selection:
+        select( wind_parzen , 0 );
+
         // memory allocation:
         allocate();
 
@@ -1390,6 +1760,9 @@ public:
     */
     __ix32 Rectangular()
     {
+        // window type selection:
+        select( wind_rectangular , 0 );
+
         // memory allocation:
         allocate();
 
@@ -1417,6 +1790,9 @@ public:
     */
     __ix32 Triangular()
     {
+        // window type selection:
+        select( wind_triangular , 0 );
+
         // memory allocation:
         allocate();
 
@@ -1460,6 +1836,9 @@ public:
     */
     __ix32 Tukey( __fx64 R )
     {
+        // window type selection:
+        select( wind_tukey , R );
+
         // memory allocation:
         allocate();
 
@@ -1488,11 +1867,65 @@ public:
         return m_wind_ready;
     }
 
+    /*!
+     * \brief window function computation by type function
+     * \param[type]  window function type ( wind_none - the default 100 dB Chebyshev window )
+     * \param[param] window function parameter ( attenuation , alpha , betta , R )
+     * \return the function computes the window of the given type and returns m_wind_ready flag
+    */
+    __ix32 compute( wind_type type , __fx64 param )
+    {
+        switch( type )
+        {
+            case wind_bartlett         : Bartlett();        break;
+            case wind_bartlett_hanning : BartlettHanning(); break;
+            case wind_blackman         : Blackman();        break;
+            case wind_blackman_harris  : BlackmanHarris();  break;
+            case wind_bohman           : Bohman();          break;
+            case wind_chebyshev        : Chebyshev( param );break;
+            case wind_flat_top         : FlatTop();         break;
+            case wind_gaussian         : Gaussian( param ); break;
+            case wind_hamming          : Hamming();         break;
+            case wind_hann             : Hann();            break;
+            case wind_kaiser           : Kaiser( param );   break;
+            case wind_nutall           : Nutall();          break;
+            case wind_parzen           : Parzen();          break;
+            case wind_rectangular      : Rectangular();     break;
+            case wind_triangular       : Triangular();      break;
+            case wind_tukey            : Tukey( param );    break;
+            default                    : Chebyshev( 100 );  break;
+        }
+        return m_wind_ready;
+    }
+
     /*!
      * \brief the function returns m_wind_ready flag
     */
     bool is_ready() { return m_wind_ready; }
 
+    /*!
+     * \brief the function returns the window function type
+    */
+    inline wind_type type() { return m_type; }
+
+    /*!
+     * \brief the function returns the window function parameter
+    */
+    inline __fx64 param() { return m_param; }
+
+    /*!
+     * \brief window function type restoring function
+     * \param[type ] window function type
+     * \param[param] window function parameter
+     * \details the function records the type and the parameter without the window computation , so the filter
+     *          restored from the saved state redesigns its coefficients with the same window
+    */
+    inline void restore( wind_type type , __fx64 param )
+    {
+        m_type  = type;
+        m_param = param;
+    }
+
     /*!
      * \brief operator extracts n-th value out of woindow function object buffer
     */
@@ -22,6 +22,26 @@ int main()
     // example7();
     // example8();
     // example9();
+    // example10();
+    // example11();
+    // example12();
+    // example13();
+    // example14();
+    // example15();
+    // example16();
+    // example17();
+    // example18();
+    // example19();
+    // example20();
+    // example21();
+    // example22();
+    // example23();
+    // example24();
+    // example25();
+    // example26();
+    // example27();
+    // example28();
+    // example29();
 
     return 0;
 }